@@ -0,0 +1,177 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+
+/* Raw decoded signals the derived values can depend on */
+enum Signal : uint8_t
+{
+  SIG_SPEED, // km/h
+  SIG_RPM,   // rpm
+  SIG_MAF,   // g/s
+  SIG_COUNT
+};
+
+#define SIG_BIT(sig) (1UL << (sig))
+
+/* Latest value and sample time of every raw signal */
+struct DerivedInputs
+{
+  float value[SIG_COUNT];
+  uint32_t time[SIG_COUNT];
+  uint32_t valid; // signals that have received at least one sample
+};
+
+struct DerivedNode;
+
+/* Recompute a node from the inputs, return true if its value changed */
+typedef bool (*derived_eval_t)(DerivedNode &node, const DerivedInputs &in);
+
+struct DerivedNode
+{
+  uint32_t inputs;     // SIG_BIT mask of the signals it depends on
+  derived_eval_t eval; // update function
+  void *target;        // where the value is published, opaque to the engine
+  int32_t value;       // last computed value
+  float state;         // per-node memory, e.g. the previous sample
+  uint32_t stamp;      // time of that memory, 0 when empty
+};
+
+/**
+ * Incremental dataflow over the decoded PIDs
+ *
+ * Samples only mark their signal dirty. update() then evaluates the nodes
+ * depending on a dirty signal, once each, and hands the ones whose value
+ * changed to the publish callback. Every node keeps its own running state,
+ * so an update is O(nodes) regardless of history, and nothing here ever
+ * talks to the adapter.
+ */
+template <size_t N>
+class DerivedEngine
+{
+public:
+  DerivedEngine(DerivedNode (&nodes)[N]) : nodes(nodes)
+  {
+    inputs.valid = 0;
+  }
+
+  void set(Signal sig, float value, uint32_t time)
+  {
+    inputs.value[sig] = value;
+    inputs.time[sig] = time;
+    inputs.valid |= SIG_BIT(sig);
+    dirty |= SIG_BIT(sig);
+  }
+
+  template <typename F>
+  void update(F publish)
+  {
+    if (!dirty)
+      return;
+
+    for (size_t i = 0; i < N; i++)
+    {
+      DerivedNode &node = nodes[i];
+      if (!(node.inputs & dirty))
+        continue;
+      if ((node.inputs & inputs.valid) != node.inputs)
+        continue;
+      if (node.eval(node, inputs))
+        publish(node);
+    }
+    dirty = 0;
+  }
+
+  const DerivedInputs &raw() const
+  {
+    return inputs;
+  }
+
+private:
+  DerivedNode (&nodes)[N];
+  DerivedInputs inputs;
+  uint32_t dirty = 0;
+};
+
+/* ---------- DERIVED VALUES ---------- */
+
+/*
+ * Overall ratio (rpm per km/h) for each gear, 1st first.
+ * Vehicle specific, these match a typical 6 speed manual.
+ */
+static const float GEAR_RATIOS[] = {125.0f, 72.0f, 50.0f, 38.0f, 31.0f, 26.0f};
+static const float GEAR_TOLERANCE = 0.12f; // relative distance still matched to a gear
+
+static const float AFR_PETROL = 14.7f;    // stoichiometric air/fuel ratio
+static const float PETROL_DENSITY = 740.0f; // g/L
+
+static inline bool derived_store(DerivedNode &node, int32_t value)
+{
+  if (value == node.value)
+    return false;
+  node.value = value;
+  return true;
+}
+
+/* Current gear, 0 when stopped or the clutch is slipping */
+static inline bool derived_gear(DerivedNode &node, const DerivedInputs &in)
+{
+  float speed = in.value[SIG_SPEED];
+  float rpm = in.value[SIG_RPM];
+  int32_t gear = 0;
+
+  if (speed >= 5 && rpm > 0)
+  {
+    float ratio = rpm / speed;
+    float best = GEAR_TOLERANCE;
+    for (size_t i = 0; i < sizeof(GEAR_RATIOS) / sizeof(GEAR_RATIOS[0]); i++)
+    {
+      float d = (ratio - GEAR_RATIOS[i]) / GEAR_RATIOS[i];
+      if (d < 0)
+        d = -d;
+      if (d < best)
+      {
+        best = d;
+        gear = i + 1;
+      }
+    }
+  }
+  return derived_store(node, gear);
+}
+
+/* Instantaneous consumption in 0.1 L/100km, 0 below walking pace */
+static inline bool derived_economy(DerivedNode &node, const DerivedInputs &in)
+{
+  float speed = in.value[SIG_SPEED];
+  float maf = in.value[SIG_MAF];
+  int32_t economy = 0;
+
+  if (speed >= 3)
+  {
+    float litresPerHour = maf * 3600.0f / (AFR_PETROL * PETROL_DENSITY);
+    economy = (int32_t)(litresPerHour * 100.0f / speed * 10.0f + 0.5f);
+  }
+  return derived_store(node, economy);
+}
+
+/* Longitudinal acceleration in 0.1 m/s2 from the speed derivative */
+static inline bool derived_acceleration(DerivedNode &node, const DerivedInputs &in)
+{
+  float speed = in.value[SIG_SPEED] / 3.6f; // m/s
+  uint32_t t = in.time[SIG_SPEED];
+
+  if (node.stamp == 0)
+  {
+    node.state = speed;
+    node.stamp = t ? t : 1;
+    return false;
+  }
+
+  float dt = (uint32_t)(t - node.stamp) / 1000.0f;
+  if (dt <= 0)
+    return false;
+
+  float accel = (speed - node.state) / dt;
+  node.state = speed;
+  node.stamp = t ? t : 1;
+  return derived_store(node, (int32_t)(accel * 10.0f + (accel < 0 ? -0.5f : 0.5f)));
+}
@@ -185,6 +185,8 @@
 #define TOUCH_IRQ 42
 
 #define LV_BUFFER_SIZE (SCREEN_WIDTH * 20)
+#define ROUND_DISPLAY 1 // flush only the visible circle
+#define FRAME_RATE 30   // half the panel refresh, 466x466 frames over QSPI
 
 #elif VIEWE_KNOB_15
 #define SCREEN_WIDTH 466
@@ -208,6 +210,8 @@
 #define ENCODER_B 5
 
 #define LV_BUFFER_SIZE (SCREEN_WIDTH * 40)
+#define ROUND_DISPLAY 1 // flush only the visible circle
+#define FRAME_RATE 30   // half the panel refresh, 466x466 frames over QSPI
 
 
 #else
@@ -6,6 +6,7 @@
 #include "TouchDrvCSTXXX.hpp"
 
 #include "pins.h"
+#include "round_span.hpp"
 
 #define TFT_BLACK 0x00000
 
@@ -17,6 +18,10 @@
 #define FLIP_Y 2
 #define FLIP_XY 3
 
+#define DISPLAY_HW_FLIP 1 // setFlipMode mirrors in the panel, getTouch follows
+#define DISPLAY_PUSH_RUNS 1 // pushRunsDMA sends a run list in one job
+#define FLUSH_CORE 0 // shared with the OBD task, LVGL renders on core 1
+
 class DisplayWrapper
 {
 public:
@@ -57,10 +62,35 @@ public:
         return state;
     }
 
-    void initDMA(void) {}
+    /*
+     * The QSPI bus driver blocks for the whole transfer, so transfers run on
+     * their own task instead. pushImageDMA() then returns at once and
+     * waitDMA() blocks until the bus is done, as with LovyanGFX.
+     */
+    void initDMA(void)
+    {
+        done = xSemaphoreCreateBinary();
+        jobs = xQueueCreate(1, sizeof(Job));
+        xTaskCreatePinnedToCore(flushTask, "flush", 3072, this, 2, &worker, FLUSH_CORE);
+    }
+
+    bool dmaBusy(void)
+    {
+        return pending && uxSemaphoreGetCount(done) == 0;
+    }
+
+    void waitDMA(void)
+    {
+        if (pending)
+        {
+            xSemaphoreTake(done, portMAX_DELAY);
+            pending = false;
+        }
+    }
 
     void fillScreen(uint16_t color)
     {
+        waitDMA();
         gfx->fillScreen(color);
     }
 
@@ -96,6 +126,7 @@ public:
         default:
             break;
         }
+        waitDMA();
         bus->beginWrite();
         bus->writeC8D8(CO5300_W_MADCTL, cmd);
         bus->endWrite();
@@ -103,12 +134,37 @@ public:
 
     void pushImage(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t *data)
     {
+        waitDMA();
         gfx->draw16bitBeRGBBitmap(x, y, data, w, h);
     }
 
+    /* `data` must stay untouched until waitDMA() returns */
     void pushImageDMA(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t *data)
     {
-        gfx->draw16bitBeRGBBitmap(x, y, data, w, h);
+        waitDMA();
+        if (!worker)
+        {
+            gfx->draw16bitBeRGBBitmap(x, y, data, w, h);
+            return;
+        }
+        Job job = {x, y, w, h, data, nullptr, 0};
+        pending = true;
+        xQueueSend(jobs, &job, portMAX_DELAY);
+    }
+
+    /* One window per run, pixels packed back to back in `data`. Both must
+       stay untouched until waitDMA() returns */
+    void pushRunsDMA(const SpanRun *runs, uint16_t count, uint16_t *data)
+    {
+        waitDMA();
+        if (!worker)
+        {
+            drawRuns(runs, count, data);
+            return;
+        }
+        Job job = {0, 0, 0, 0, data, runs, count};
+        pending = true;
+        xQueueSend(jobs, &job, portMAX_DELAY);
     }
 
     void startWrite(void) {}
@@ -122,11 +178,13 @@ public:
 
     void setBrightness(uint8_t brightness)
     {
+        waitDMA();
         ((Arduino_CO5300 *)gfx)->setBrightness(brightness);
     }
 
     void writePixel(int32_t x, int32_t y, const uint16_t color)
     {
+        waitDMA();
         gfx->writePixel(x, y, color);
     }
 
@@ -157,8 +215,45 @@ public:
     }
 
 private:
+    struct Job
+    {
+        int32_t x, y, w, h;
+        uint16_t *data;
+        const SpanRun *runs; // instead of x/y/w/h when set
+        uint16_t count;
+    };
+
     bool flip_x = false;
     bool flip_y = false;
+
+    TaskHandle_t worker = nullptr;
+    QueueHandle_t jobs;
+    SemaphoreHandle_t done;
+    bool pending = false; // a transfer was queued and not waited for
+
+    void drawRuns(const SpanRun *runs, uint16_t count, uint16_t *data)
+    {
+        for (uint16_t i = 0; i < count; i++)
+        {
+            gfx->draw16bitBeRGBBitmap(runs[i].x, runs[i].y, data, runs[i].w, runs[i].h);
+            data += runs[i].w * runs[i].h;
+        }
+    }
+
+    static void flushTask(void *param)
+    {
+        DisplayWrapper *self = (DisplayWrapper *)param;
+        Job job;
+        for (;;)
+        {
+            xQueueReceive(self->jobs, &job, portMAX_DELAY);
+            if (job.runs)
+                self->drawRuns(job.runs, job.count, job.data);
+            else
+                self->gfx->draw16bitBeRGBBitmap(job.x, job.y, job.data, job.w, job.h);
+            xSemaphoreGive(self->done);
+        }
+    }
 };
 
 DisplayWrapper tft;
\ No newline at end of file
@@ -0,0 +1,65 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+
+enum DrawBufferMemory : uint8_t
+{
+  DRAW_BUF_INTERNAL, // DMA capable internal RAM
+  DRAW_BUF_PSRAM,    // external RAM, room for full frames
+};
+
+struct DrawBufferPlan
+{
+  uint32_t lines; // rows per buffer
+  size_t bytes;   // size of one of the two buffers
+  DrawBufferMemory memory;
+};
+
+/**
+ * Size the two LVGL draw buffers from what the board has free
+ *
+ * With enough PSRAM both buffers hold a full frame, so every invalidated
+ * area is rendered and flushed in one go. Otherwise the strips get as tall
+ * as internal RAM allows after `reserve`, never below the board's own
+ * minimum. Heights are kept even to match the 2x2 rounder.
+ *
+ * @param width     Screen width in pixels
+ * @param height    Screen height in pixels
+ * @param bpp       Bytes per pixel of the render format
+ * @param minLines  Smallest strip the board is configured for
+ * @param psram     Free PSRAM in bytes, 0 when there is none
+ * @param internal  Free internal DMA capable RAM in bytes
+ * @param largest   Largest free internal DMA capable block
+ * @param reserve   Internal RAM to leave for BLE, LVGL objects and stacks
+ */
+static inline DrawBufferPlan drawBufferPlan(uint32_t width, uint32_t height, uint8_t bpp,
+                                            uint32_t minLines, size_t psram, size_t internal,
+                                            size_t largest, size_t reserve)
+{
+  DrawBufferPlan plan;
+  size_t row = (size_t)width * bpp;
+
+  if (psram >= 2 * row * height)
+  {
+    plan.lines = height;
+    plan.memory = DRAW_BUF_PSRAM;
+  }
+  else
+  {
+    size_t budget = internal > reserve ? (internal - reserve) / 2 : 0;
+    if (budget > largest)
+      budget = largest;
+    uint32_t lines = budget / row;
+    if (lines > height)
+      lines = height;
+    if (lines < minLines)
+      lines = minLines;
+    plan.lines = lines;
+    plan.memory = DRAW_BUF_INTERNAL;
+  }
+
+  if (plan.lines > 2)
+    plan.lines &= ~1u;
+  plan.bytes = row * plan.lines;
+  return plan;
+}
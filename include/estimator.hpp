@@ -0,0 +1,136 @@
+#pragma once
+#include <stdint.h>
+
+/**
+ * Smooth display of a slowly sampled signal, one sample behind
+ *
+ * OBD values arrive a few times per second at best. Rather than guess where
+ * the signal goes next, every sample starts a straight line from the value
+ * on screen to the sample, drawn over the time the sample took to come
+ * since the one before, at most `horizon` ms. The display is one sample
+ * interval behind, but never jumps, never overshoots and never freezes in
+ * between as long as `horizon` is at least the poll period.
+ *
+ * Only depends on the caller supplying timestamps, so it can be fed recorded
+ * traces on the host.
+ */
+class SignalEstimator
+{
+public:
+  /**
+   * @param horizon  Longest interpolation in ms, at least the poll period
+   * @param min      Lowest value that will be published
+   * @param max      Highest value that will be published
+   * @param gap      Sample gap in ms after which the state is reset
+   */
+  SignalEstimator(uint32_t horizon, float min, float max, uint32_t gap = 1000)
+      : horizon(horizon), min(min), max(max), gap(gap)
+  {
+  }
+
+  void reset()
+  {
+    primed = false;
+    from = 0;
+    to = 0;
+    resetStats();
+  }
+
+  void resetStats()
+  {
+    samples = 0;
+    errorSum = 0;
+    errorMax = 0;
+  }
+
+  /**
+   * Feed a new measurement
+   *
+   * @param z  Measured value
+   * @param t  Sample timestamp in ms
+   */
+  void addSample(float z, uint32_t t)
+  {
+    uint32_t interval = t - t0;
+    if (!primed || interval > gap)
+    {
+      from = z;
+      to = z;
+      t0 = t;
+      span = 0;
+      primed = true;
+      return;
+    }
+
+    // error of what was on screen when the sample arrived
+    float shown = estimate(t);
+    float err = shown - z;
+    if (err < 0)
+      err = -err;
+    errorSum += err;
+    if (err > errorMax)
+      errorMax = err;
+    samples++;
+
+    from = shown;
+    to = z;
+    t0 = t;
+    span = interval < horizon ? interval : horizon;
+  }
+
+  /**
+   * Value to publish at time `t`
+   */
+  float estimate(uint32_t t) const
+  {
+    if (!primed)
+      return min;
+
+    uint32_t dt = t - t0;
+    float e = dt >= span ? to : from + (to - from) * (float)dt / (float)span;
+
+    if (e > max)
+      e = max;
+    else if (e < min)
+      e = min;
+    return e;
+  }
+
+  bool valid() const
+  {
+    return primed;
+  }
+
+  /* ---------- ERROR METRICS ---------- */
+  uint32_t sampleCount() const
+  {
+    return samples;
+  }
+
+  /* Mean absolute error between the published value and each new sample */
+  float meanAbsError() const
+  {
+    return samples ? errorSum / samples : 0;
+  }
+
+  float maxAbsError() const
+  {
+    return errorMax;
+  }
+
+private:
+  uint32_t horizon;
+  float min;
+  float max;
+  uint32_t gap;
+
+  bool primed = false;
+  float from = 0;    // on screen when the last sample came
+  float to = 0;      // the last sample
+  uint32_t t0 = 0;   // time of the last sample
+  uint32_t span = 0; // ms from `from` to `to`
+
+  uint32_t samples = 0;
+  float errorSum = 0;
+  float errorMax = 0;
+};
@@ -0,0 +1,156 @@
+#pragma once
+#include <stdint.h>
+
+/**
+ * When to start a frame
+ *
+ * The frame clock ticks at the panel's refresh (its tearing effect line) or
+ * at the target rate (a timer), and the UI task asks on every tick whether
+ * to draw. Frames are started on a grid of one target period: ticks that
+ * come faster than that are passed over, and a tick that comes too late for
+ * its slot, because the last frame ran long, is skipped rather than starting
+ * a frame halfway through a refresh. Skipped slots are counted, never
+ * caught up on.
+ *
+ * All times are passed in, like IdlePolicy, so it runs against a virtual
+ * clock on the host.
+ */
+class FramePacer
+{
+public:
+  /**
+   * @param period  Target frame period in us
+   */
+  explicit FramePacer(uint32_t period) : period(period), slack(period / 4)
+  {
+  }
+
+  uint32_t framePeriod() const
+  {
+    return period;
+  }
+
+  /* The clock was stopped, the next tick starts a new grid */
+  void restart()
+  {
+    next = 0;
+  }
+
+  /**
+   * A tick of the frame clock
+   *
+   * @param tick  When the clock ticked in us, the last tick if several went by
+   * @param now   Current time in us
+   * @return      Start a frame now, and call done() when it is flushed
+   */
+  bool due(uint64_t tick, uint64_t now)
+  {
+    if (!next)
+      next = tick;
+    if (tick + slack < next)
+      return false; // between frames of a faster clock
+    if (tick > next + slack)
+    {
+      /* Slots whose ticks went by while the last frame was still drawing */
+      uint32_t missed = (uint32_t)((tick - next - slack) / period) + 1;
+      skippedSlots += missed;
+      next += (uint64_t)missed * period;
+      if (tick + slack < next)
+        return false;
+    }
+    /* Follow the clock's phase, a panel never runs at exactly its nominal rate */
+    next = tick + period;
+    uint32_t late = (uint32_t)(now - tick);
+    if (late > slack)
+    {
+      skippedSlots++; // too late to start before the refresh is under way
+      return false;
+    }
+    lateTotal += late;
+    if (late > lateMax)
+      lateMax = late;
+    started = now;
+    return true;
+  }
+
+  /**
+   * The frame due() started is done
+   *
+   * @param now  Current time in us
+   */
+  void done(uint64_t now)
+  {
+    uint32_t took = (uint32_t)(now - started);
+    frameCount++;
+    frameTotal += took;
+    if (took > frameMax)
+      frameMax = took;
+    if (took > period)
+      overBudget++;
+  }
+
+  uint32_t frames() const
+  {
+    return frameCount;
+  }
+
+  uint32_t skipped() const
+  {
+    return skippedSlots;
+  }
+
+  /* Frames that took longer than the period, each costs the next slot */
+  uint32_t overruns() const
+  {
+    return overBudget;
+  }
+
+  /* Mean and worst frame time in us */
+  uint32_t frameAvg() const
+  {
+    return frameCount ? (uint32_t)(frameTotal / frameCount) : 0;
+  }
+
+  uint32_t frameWorst() const
+  {
+    return frameMax;
+  }
+
+  /* Mean and worst start of a frame after its tick, in us */
+  uint32_t lateAvg() const
+  {
+    return frameCount ? (uint32_t)(lateTotal / frameCount) : 0;
+  }
+
+  uint32_t lateWorst() const
+  {
+    return lateMax;
+  }
+
+  /* Start a new measurement window */
+  void resetStats()
+  {
+    frameCount = 0;
+    skippedSlots = 0;
+    overBudget = 0;
+    frameTotal = 0;
+    frameMax = 0;
+    lateTotal = 0;
+    lateMax = 0;
+  }
+
+private:
+  uint32_t period; // us
+  uint32_t slack;  // us a tick may be early or late and still start its slot
+
+  uint64_t next = 0; // us, start of the next slot, 0 before the first tick
+  uint64_t started = 0;
+
+  uint32_t frameCount = 0;
+  uint32_t skippedSlots = 0;
+  uint32_t overBudget = 0;
+  uint64_t frameTotal = 0; // us
+  uint32_t frameMax = 0;   // us
+  uint64_t lateTotal = 0;  // us
+  uint32_t lateMax = 0;    // us
+};
@@ -0,0 +1,113 @@
+#pragma once
+#include <stdint.h>
+#include <string.h>
+
+/**
+ * Robust filter for the raw fuel level byte (PID 012F)
+ *
+ * The last N samples are kept in a fixed ring and counted in a Fenwick tree
+ * over the 256 possible raw values, so adding a sample and finding the
+ * median are both O(log 256) with no allocation. The median is then followed
+ * by an EMA that starts fast (a plain average of the first 1 / `alpha`
+ * medians, 20 at 0.05, whatever N is) and settles to `alpha`, which removes
+ * the slosh on corners and braking.
+ */
+template <uint8_t N>
+class FuelFilter
+{
+public:
+  FuelFilter(float alpha) : alpha(alpha)
+  {
+    reset();
+  }
+
+  void reset()
+  {
+    memset(tree, 0, sizeof(tree));
+    head = 0;
+    count = 0;
+    samples = 0;
+    level = 0;
+  }
+
+  /**
+   * Add a raw sample (0-255)
+   *
+   * @return  Filtered level in percent
+   */
+  float add(uint8_t raw)
+  {
+    if (count == N)
+    {
+      adjust(ring[head], -1);
+    }
+    else
+    {
+      count++;
+    }
+    ring[head] = raw;
+    adjust(raw, 1);
+    head = (head + 1) % N;
+
+    float median = this->median() * 100.0f / 255.0f;
+
+    // plain average of the first 1 / alpha medians, then the slow EMA
+    if (samples < 0xFFFF)
+      samples++;
+    float k = 1.0f / samples;
+    if (k < alpha)
+      k = alpha;
+
+    level += k * (median - level);
+    return level;
+  }
+
+  /* Filtered level in percent */
+  float value() const
+  {
+    return level;
+  }
+
+  bool valid() const
+  {
+    return count > 0;
+  }
+
+  /* Median raw value of the window */
+  uint8_t median() const
+  {
+    return find((count + 1) / 2);
+  }
+
+private:
+  static const uint16_t BINS = 256;
+
+  float alpha;
+  uint8_t ring[N];
+  uint8_t head;
+  uint8_t count;
+  uint16_t samples;
+  float level;
+  uint8_t tree[BINS + 1]; // Fenwick tree of sample counts per raw value
+
+  void adjust(uint8_t raw, int8_t delta)
+  {
+    for (uint16_t i = raw + 1; i <= BINS; i += i & -i)
+      tree[i] += delta;
+  }
+
+  /* Smallest raw value with at least k samples at or below it */
+  uint8_t find(uint8_t k) const
+  {
+    uint16_t pos = 0;
+    for (uint16_t step = BINS; step; step >>= 1)
+    {
+      if (pos + step <= BINS && tree[pos + step] < k)
+      {
+        pos += step;
+        k -= tree[pos];
+      }
+    }
+    return pos; // pos + 1 is the 1-based bin, i.e. raw value pos
+  }
+};
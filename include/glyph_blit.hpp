@@ -0,0 +1,79 @@
+#pragma once
+#include <stdint.h>
+
+/*
+ * Glyph masks straight to RGB565
+ *
+ * Text on the dashboard is one opaque color over black. Mixed over black,
+ * each of the 256 mask values gives one pixel, so a table replaces the
+ * blend wherever the layer is still black underneath. Other pixels are
+ * mixed the way LVGL's software renderer mixes them, so the result is the
+ * same to the bit.
+ */
+
+/* lv_color_16_16_mix: `fg` over `bg` by `mix`, 5 bit steps */
+static inline uint16_t glyphMix(uint16_t fg, uint16_t bg, uint8_t mix)
+{
+  if (mix == 255)
+    return fg;
+  if (mix == 0)
+    return bg;
+  if (fg == bg)
+    return fg;
+  uint32_t m = ((uint32_t)mix + 4) >> 3;
+  uint32_t b = (bg | (uint32_t)bg << 16) & 0x7E0F81F;
+  uint32_t f = (fg | (uint32_t)fg << 16) & 0x7E0F81F;
+  uint32_t r = ((((f - b) * m) >> 5) + b) & 0x7E0F81F;
+  return (uint16_t)((r >> 16) | r);
+}
+
+static inline uint16_t glyphSwap(uint16_t c)
+{
+  return (uint16_t)((c >> 8) | (c << 8));
+}
+
+/* Pixels of `color` (RGB565) over black for every mask value, bytes swapped if `swapped` */
+static inline void glyphTable(uint16_t *lut, uint16_t color, bool swapped)
+{
+  for (uint32_t a = 0; a < 256; a++)
+  {
+    uint16_t c = glyphMix(color, 0, (uint8_t)a);
+    lut[a] = swapped ? glyphSwap(c) : c;
+  }
+}
+
+/**
+ * Draw an A8 mask
+ *
+ * @param dst        First pixel, `dstStride` pixels per row
+ * @param mask       First mask byte, `maskStride` bytes per row
+ * @param lut        glyphTable of `color`
+ * @param color      RGB565, in the byte order of the layer
+ * @param swapped    The layer is RGB565 with the bytes swapped
+ */
+static inline void glyphBlit(uint16_t *dst, int32_t dstStride, const uint8_t *mask,
+                             int32_t maskStride, int32_t w, int32_t h, const uint16_t *lut,
+                             uint16_t color, bool swapped)
+{
+  for (int32_t y = 0; y < h; y++, dst += dstStride, mask += maskStride)
+  {
+    for (int32_t x = 0; x < w; x++)
+    {
+      uint8_t a = mask[x];
+      if (a == 0)
+        continue;
+      if (a == 255)
+      {
+        dst[x] = color;
+        continue;
+      }
+      uint16_t d = dst[x];
+      if (d == 0)
+        dst[x] = lut[a];
+      else if (swapped)
+        dst[x] = glyphSwap(glyphMix(glyphSwap(color), glyphSwap(d), a));
+      else
+        dst[x] = glyphMix(color, d, a);
+    }
+  }
+}
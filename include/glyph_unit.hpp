@@ -0,0 +1,113 @@
+#pragma once
+#include <stdint.h>
+#include "lvgl_private.h"
+#include "fonts/glyph_cache.h"
+#include "glyph_blit.hpp"
+
+/*
+ * Glyph draw unit
+ *
+ * Draws labels of one opaque color on an RGB565 layer with glyphBlit, a
+ * table lookup wherever the layer is still black. Selections, underlines,
+ * recolor, rotation, other blend modes and fonts that are not plain bitmaps
+ * stay with the software renderer. Build with -D NO_GLYPH_UNIT to leave all
+ * text to LVGL.
+ */
+
+static uint32_t glyphLabels; // labels drawn by the glyph unit, the UI task reads and clears it
+
+#define GLYPH_UNIT_ID 65
+
+static uint16_t glyphLut[256];
+static uint32_t glyphLutKey = UINT32_MAX; // color and byte order of glyphLut
+
+/* Bitmap fonts, the cached ones included, all the way down the fallbacks */
+static bool glyphFontFits(const lv_font_t *font)
+{
+  for (; font; font = font->fallback)
+  {
+    if (font->get_glyph_bitmap != lv_font_get_bitmap_fmt_txt &&
+        font->get_glyph_bitmap != glyph_cache_get_bitmap)
+      return false;
+  }
+  return true;
+}
+
+static int32_t glyphEvaluate(lv_draw_unit_t *unit, lv_draw_task_t *t)
+{
+  if (t->type != LV_DRAW_TASK_TYPE_LABEL)
+    return 0;
+  const lv_draw_label_dsc_t *dsc = (const lv_draw_label_dsc_t *)t->draw_dsc;
+  lv_color_format_t cf = t->target_layer->color_format;
+  if ((cf != LV_COLOR_FORMAT_RGB565 && cf != LV_COLOR_FORMAT_RGB565_SWAPPED) ||
+      dsc->opa < LV_OPA_MAX || dsc->blend_mode != LV_BLEND_MODE_NORMAL ||
+      dsc->decor != LV_TEXT_DECOR_NONE || dsc->sel_start != LV_DRAW_LABEL_NO_TXT_SEL ||
+      (dsc->flag & LV_TEXT_FLAG_RECOLOR) || dsc->rotation || !glyphFontFits(dsc->font))
+    return 0;
+  /* The software unit asks for 100 */
+  if (t->preference_score > 50)
+  {
+    t->preference_score = 50;
+    t->preferred_draw_unit_id = GLYPH_UNIT_ID;
+  }
+  return 0;
+}
+
+/* One letter, as the software unit's callback but for A8 masks only */
+static void glyphLetter(lv_draw_task_t *t, lv_draw_glyph_dsc_t *g, lv_draw_fill_dsc_t *fill,
+                        const lv_area_t *fill_area)
+{
+  /* Bitmap fonts decode every format to A8, NONE is a glyph the font lacks */
+  if (g == NULL || g->glyph_data == NULL || g->format == LV_FONT_GLYPH_FORMAT_NONE ||
+      g->format > LV_FONT_GLYPH_FORMAT_A8)
+    return;
+  const lv_draw_buf_t *glyph = (const lv_draw_buf_t *)g->glyph_data;
+  lv_area_t clip;
+  if (!lv_area_intersect(&clip, g->letter_coords, &t->clip_area))
+    return;
+
+  lv_layer_t *layer = t->target_layer;
+  bool swapped = layer->color_format == LV_COLOR_FORMAT_RGB565_SWAPPED;
+  uint16_t color = lv_color_to_u16(g->color);
+  uint32_t key = color | (uint32_t)swapped << 16;
+  if (key != glyphLutKey)
+  {
+    glyphTable(glyphLut, color, swapped);
+    glyphLutKey = key;
+  }
+
+  lv_draw_buf_t *buf = layer->draw_buf;
+  int32_t stride = buf->header.stride / 2;
+  uint16_t *dst = (uint16_t *)buf->data + (clip.y1 - layer->buf_area.y1) * stride +
+                  (clip.x1 - layer->buf_area.x1);
+  const uint8_t *mask = glyph->data + (clip.y1 - g->letter_coords->y1) * glyph->header.stride +
+                        (clip.x1 - g->letter_coords->x1);
+  glyphBlit(dst, stride, mask, glyph->header.stride, lv_area_get_width(&clip),
+            lv_area_get_height(&clip), glyphLut, swapped ? glyphSwap(color) : color, swapped);
+}
+
+/* Synchronous like the ring unit: the label is drawn by the time this returns */
+static int32_t glyphDispatch(lv_draw_unit_t *unit, lv_layer_t *layer)
+{
+  lv_draw_task_t *t = lv_draw_get_available_task(layer, NULL, GLYPH_UNIT_ID);
+  if (t == NULL || t->preferred_draw_unit_id != GLYPH_UNIT_ID)
+    return LV_DRAW_UNIT_IDLE;
+  if (lv_draw_layer_alloc_buf(layer) == NULL)
+    return LV_DRAW_UNIT_IDLE;
+
+  t->state = LV_DRAW_TASK_STATE_IN_PROGRESS;
+  lv_draw_label_iterate_characters(t, (const lv_draw_label_dsc_t *)t->draw_dsc, &t->area,
+                                   glyphLetter);
+  glyphLabels++;
+  t->state = LV_DRAW_TASK_STATE_FINISHED;
+  lv_draw_dispatch_request();
+  return 1;
+}
+
+static void glyphUnitInit()
+{
+  lv_draw_unit_t *unit = (lv_draw_unit_t *)lv_draw_create_unit(sizeof(lv_draw_unit_t));
+  unit->name = "GLYPH";
+  unit->evaluate_cb = glyphEvaluate;
+  unit->dispatch_cb = glyphDispatch;
+}
@@ -0,0 +1,134 @@
+#pragma once
+#include <stdint.h>
+
+/* Why the UI task woke up, also used as its notification bits */
+#define IDLE_EVT_SAMPLE (1 << 0) // OBD task queued something
+#define IDLE_EVT_TOUCH (1 << 1)  // touch controller interrupt
+#define IDLE_EVT_FRAME (1 << 2)  // frame clock tick
+
+/**
+ * Sleep/wake policy of the UI task
+ *
+ * The task sleeps until a sample arrives, the panel is touched, the frame
+ * clock ticks or the next LVGL timer is due, whichever comes first. While a finger is down there is
+ * no interrupt for the release, so the touch is polled instead.
+ *
+ * All times are passed in, so the policy runs the same against a virtual
+ * clock on the host. Busy and idle time are accumulated for the duty cycle.
+ */
+class IdlePolicy
+{
+public:
+  /**
+   * @param minWait    Shortest sleep in ms, lets lower priority tasks run
+   * @param maxWait    Longest sleep in ms when no LVGL timer is pending
+   * @param touchPoll  Touch polling period in ms while pressed
+   */
+  IdlePolicy(uint32_t minWait, uint32_t maxWait, uint32_t touchPoll)
+      : minWait(minWait), maxWait(maxWait), touchPoll(touchPoll)
+  {
+  }
+
+  /**
+   * The task is about to sleep
+   *
+   * @param now        Current time in us
+   * @param timerIdle  lv_timer_handler() return value, ms until the next timer
+   * @param touching   Touch is currently pressed
+   * @return           How long to wait for a notification, in ms
+   */
+  uint32_t sleep(uint64_t now, uint32_t timerIdle, bool touching)
+  {
+    if (awake)
+      busy += now - since;
+    awake = false;
+    since = now;
+
+    uint32_t wait = timerIdle < maxWait ? timerIdle : maxWait;
+    if (touching && touchPoll < wait)
+      wait = touchPoll;
+    if (wait < minWait)
+      wait = minWait;
+    return wait;
+  }
+
+  /**
+   * The task woke up
+   *
+   * @param now     Current time in us
+   * @param events  IDLE_EVT_* bits it was notified with, 0 on timeout
+   */
+  void wake(uint64_t now, uint32_t events)
+  {
+    if (!awake)
+      idle += now - since;
+    awake = true;
+    since = now;
+
+    if (events & IDLE_EVT_SAMPLE)
+      wakeups[WAKE_SAMPLE]++;
+    if (events & IDLE_EVT_TOUCH)
+      wakeups[WAKE_TOUCH]++;
+    if (events & IDLE_EVT_FRAME)
+      wakeups[WAKE_FRAME]++;
+    if (!(events & (IDLE_EVT_SAMPLE | IDLE_EVT_TOUCH | IDLE_EVT_FRAME)))
+      wakeups[WAKE_TIMER]++;
+  }
+
+  /* Share of time spent awake since the last reset, 0-1 */
+  float dutyCycle() const
+  {
+    uint64_t total = busy + idle;
+    return total ? (float)busy / total : 0;
+  }
+
+  uint32_t sampleWakeups() const
+  {
+    return wakeups[WAKE_SAMPLE];
+  }
+
+  uint32_t touchWakeups() const
+  {
+    return wakeups[WAKE_TOUCH];
+  }
+
+  uint32_t frameWakeups() const
+  {
+    return wakeups[WAKE_FRAME];
+  }
+
+  uint32_t timerWakeups() const
+  {
+    return wakeups[WAKE_TIMER];
+  }
+
+  /* Start a new measurement window, keeps the current awake/asleep state */
+  void resetStats(uint64_t now)
+  {
+    busy = 0;
+    idle = 0;
+    since = now;
+    for (uint8_t i = 0; i < WAKE_COUNT; i++)
+      wakeups[i] = 0;
+  }
+
+private:
+  enum
+  {
+    WAKE_SAMPLE,
+    WAKE_TOUCH,
+    WAKE_FRAME,
+    WAKE_TIMER,
+    WAKE_COUNT
+  };
+
+  uint32_t minWait;
+  uint32_t maxWait;
+  uint32_t touchPoll;
+
+  bool awake = true;
+  uint64_t since = 0;
+  uint64_t busy = 0; // us
+  uint64_t idle = 0; // us
+  uint32_t wakeups[WAKE_COUNT] = {};
+};
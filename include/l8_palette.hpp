@@ -0,0 +1,53 @@
+#pragma once
+#include <stdint.h>
+
+/*
+ * Expansion of L8 draw buffers to the panel's RGB565
+ *
+ * With -D RENDER_L8 LVGL renders luminance only, one byte per pixel, and
+ * the flush looks every byte up in a 256 entry palette on its way to the
+ * bus. The palette is a ramp from black to the HUD color, in the byte order
+ * of the panel.
+ */
+
+/* Fill `lut` with 256 steps from black to `color` (RGB565), bytes swapped if `swapped` */
+static inline void l8PaletteRamp(uint16_t *lut, uint16_t color, bool swapped)
+{
+  uint32_t r = color >> 11, g = (color >> 5) & 0x3F, b = color & 0x1F;
+  for (uint32_t i = 0; i < 256; i++)
+  {
+    uint16_t c = (uint16_t)(((r * i + 127) / 255) << 11 | ((g * i + 127) / 255) << 5 |
+                            ((b * i + 127) / 255));
+    lut[i] = swapped ? (uint16_t)((c >> 8) | (c << 8)) : c;
+  }
+}
+
+/**
+ * Expand one row
+ *
+ * @param src      `w` luminance bytes
+ * @param dst      `w` pixels
+ * @param reverse  Write the row right to left, for the HUD mirror
+ */
+static inline void l8Expand(const uint8_t *src, uint16_t *dst, int32_t w, const uint16_t *lut,
+                            bool reverse)
+{
+  int32_t i = 0;
+  /* Two pixels per 32 bit store, rows are even after the rounder */
+  if (((uintptr_t)dst & 3) == 0)
+  {
+    uint32_t *out = (uint32_t *)dst;
+    if (reverse)
+    {
+      for (; i + 1 < w; i += 2)
+        out[i / 2] = lut[src[w - 1 - i]] | (uint32_t)lut[src[w - 2 - i]] << 16;
+    }
+    else
+    {
+      for (; i + 1 < w; i += 2)
+        out[i / 2] = lut[src[i]] | (uint32_t)lut[src[i + 1]] << 16;
+    }
+  }
+  for (; i < w; i++)
+    dst[i] = lut[src[reverse ? w - 1 - i : i]];
+}
@@ -0,0 +1,163 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include "obd.hpp"
+
+/*
+ * Performance counters behind the overlay and the serial "perf" command
+ *
+ * The render path and the OBD task only add to fixed counters. Once a
+ * second while the overlay is shown, or when "perf" asks, what was added
+ * since the last time becomes a PerfSnapshot, with LVGL locked like the
+ * render path. Every counter has one writer and only ever grows (32 bit,
+ * differences wrap correctly), so the OBD task's counters are read without
+ * a lock. Nothing allocates.
+ */
+
+/* One window, as rates */
+template <size_t PIDS>
+struct PerfSnapshot
+{
+  float fps;
+  float renderMs;     // per frame, mean
+  float renderMaxMs;  // per frame, worst
+  float flushMs;      // per frame, in the flush callback and waiting for the bus
+  uint32_t pxPerFrame; // put on the bus
+  uint32_t heapUsed;  // bytes, LVGL allocates from the system heap
+  uint32_t heapFree;  // bytes
+  float requests[PIDS]; // OBD requests per second, in the order of the PID table
+  float rttMs;        // request written to answer received, mean
+  uint32_t rttMaxMs;  // worst
+};
+
+template <size_t PIDS>
+class PerfMetrics
+{
+public:
+  /* A frame was rendered, UI task */
+  void frame(uint32_t renderUs)
+  {
+    now.frames++;
+    now.renderUs += renderUs;
+    if (renderUs > renderMax)
+      renderMax = renderUs;
+  }
+
+  /* Time spent flushing and pixels sent, UI task */
+  void flush(uint32_t us, uint32_t px)
+  {
+    now.flushUs += us;
+    now.pixels += px;
+  }
+
+  /* A request for the PID at `index` of the table went out, OBD task */
+  void request(size_t index)
+  {
+    if (index < PIDS)
+      now.requests[index]++;
+  }
+
+  /* Its answer came back `rttMs` later, OBD task */
+  void answer(uint32_t rttMs)
+  {
+    now.answers++;
+    now.rttMs += rttMs;
+    if (rttMs > rttMax)
+      rttMax = rttMs; // reset by snapshot(), may miss an answer at the edge of a window
+  }
+
+  /**
+   * Rates since the last call, with LVGL locked
+   *
+   * @param elapsed  us since the last call
+   * @param s        Filled in, except the heap
+   */
+  void snapshot(uint64_t elapsed, PerfSnapshot<PIDS> &s)
+  {
+    Counters c = now;
+    uint32_t frames = c.frames - last.frames;
+    uint32_t answers = c.answers - last.answers;
+    float seconds = elapsed / 1e6f;
+
+    s.fps = seconds > 0 ? frames / seconds : 0;
+    s.renderMs = frames ? (c.renderUs - last.renderUs) / 1000.0f / frames : 0;
+    s.renderMaxMs = renderMax / 1000.0f;
+    s.flushMs = frames ? (c.flushUs - last.flushUs) / 1000.0f / frames : 0;
+    s.pxPerFrame = frames ? (c.pixels - last.pixels) / frames : 0;
+    for (size_t i = 0; i < PIDS; i++)
+      s.requests[i] = seconds > 0 ? (c.requests[i] - last.requests[i]) / seconds : 0;
+    s.rttMs = answers ? (float)(c.rttMs - last.rttMs) / answers : 0;
+    s.rttMaxMs = rttMax;
+
+    last = c;
+    renderMax = 0;
+    rttMax = 0;
+  }
+
+private:
+  struct Counters
+  {
+    uint32_t frames;
+    uint32_t renderUs;
+    uint32_t flushUs;
+    uint32_t pixels;
+    uint32_t requests[PIDS];
+    uint32_t answers;
+    uint32_t rttMs;
+  };
+
+  Counters now = {};
+  Counters last = {};
+  uint32_t renderMax = 0; // us
+  uint32_t rttMax = 0;    // ms
+};
+
+static inline int perfPidName(char *buf, size_t len, uint8_t pid)
+{
+  return pid == OBD_PID_VOLTAGE ? snprintf(buf, len, "volt") : snprintf(buf, len, "%02x", pid);
+}
+
+/**
+ * A snapshot as one line of `key=value` pairs, for scraping
+ *
+ * @param pids  PID of every entry of the table, named pid_XX (pid_volt for the battery)
+ * @return      As snprintf
+ */
+template <size_t PIDS>
+static inline int perfFormatLine(char *buf, size_t len, const PerfSnapshot<PIDS> &s,
+                                 const uint8_t *pids)
+{
+  int n = snprintf(buf, len,
+                   "fps=%.1f render_ms=%.2f render_max_ms=%.2f flush_ms=%.2f px_per_frame=%u "
+                   "heap_used=%u heap_free=%u rtt_ms=%.1f rtt_max_ms=%u",
+                   s.fps, s.renderMs, s.renderMaxMs, s.flushMs, s.pxPerFrame, s.heapUsed,
+                   s.heapFree, s.rttMs, s.rttMaxMs);
+  for (size_t i = 0; i < PIDS && n >= 0 && (size_t)n < len; i++)
+  {
+    char name[8];
+    perfPidName(name, sizeof(name), pids[i]);
+    n += snprintf(buf + n, len - n, " pid_%s_per_s=%.1f", name, s.requests[i]);
+  }
+  return n;
+}
+
+/* The same, a few short lines for the overlay */
+template <size_t PIDS>
+static inline int perfFormatOverlay(char *buf, size_t len, const PerfSnapshot<PIDS> &s,
+                                    const uint8_t *pids)
+{
+  int n = snprintf(buf, len,
+                   "%.1f fps  render %.1f/%.1f ms\n"
+                   "flush %.1f ms  %u px\n"
+                   "heap %u/%u KB  rtt %.0f/%u ms\n",
+                   s.fps, s.renderMs, s.renderMaxMs, s.flushMs, s.pxPerFrame, s.heapUsed / 1024,
+                   (s.heapUsed + s.heapFree) / 1024, s.rttMs, s.rttMaxMs);
+  for (size_t i = 0; i < PIDS && n >= 0 && (size_t)n < len; i++)
+  {
+    char name[8];
+    perfPidName(name, sizeof(name), pids[i]);
+    n += snprintf(buf + n, len - n, "%s%s %.1f", i % 3 ? "  " : i ? "\n" : "", name, s.requests[i]);
+  }
+  return n;
+}
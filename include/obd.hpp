@@ -0,0 +1,579 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+/* ---------- RESPONSE CLASSIFIER ---------- */
+enum ObdStatus : uint8_t
+{
+  OBD_OK,                // mode 01 data ("41 ...")
+  OBD_NO_DATA,           // ECU did not answer this PID
+  OBD_CAN_ERROR,         // bus level failure
+  OBD_BUS_INIT,          // protocol init failed ("BUS INIT: ...ERROR")
+  OBD_BUS_ERROR,         // "BUS ERROR", "BUS BUSY", "DATA ERROR", "<RX ERROR"
+  OBD_STOPPED,           // request interrupted by a new command
+  OBD_SEARCHING,         // protocol search in progress, answer follows
+  OBD_UNKNOWN,           // "?", command not understood
+  OBD_BUFFER_FULL,       // adapter overran its buffer
+  OBD_UNABLE_TO_CONNECT, // no ECU found
+  OBD_ERROR,             // "ERRxx" internal error
+  OBD_NEGATIVE,          // "7F" negative response from the ECU
+  OBD_VOLTAGE,           // ATRV answer ("12.6V")
+  OBD_PROMPT,            // nothing but whitespace and the ">" prompt
+  OBD_OTHER,             // other AT replies ("OK", version...)
+};
+
+static const char *const OBD_STATUS_NAMES[] = {
+    "OK", "NO DATA", "CAN ERROR", "BUS INIT", "BUS ERROR", "STOPPED", "SEARCHING",
+    "?", "BUFFER FULL", "UNABLE TO CONNECT", "ERR", "NEGATIVE", "VOLTAGE", "PROMPT", "OTHER"};
+
+/* Pseudo PID for the adapter voltage (ATRV) in the scheduler table */
+#define OBD_PID_VOLTAGE 0xFF
+
+static inline const char *obdStatusName(ObdStatus status)
+{
+  return OBD_STATUS_NAMES[status];
+}
+
+/* Errors that say something about the CAN link rather than one PID */
+static inline bool obdBusError(ObdStatus status)
+{
+  return status == OBD_CAN_ERROR || status == OBD_BUS_INIT || status == OBD_BUS_ERROR ||
+         status == OBD_UNABLE_TO_CONNECT;
+}
+
+/* Errors worth retrying at the normal rate */
+static inline bool obdTransient(ObdStatus status)
+{
+  return status == OBD_STOPPED || status == OBD_BUFFER_FULL || status == OBD_SEARCHING;
+}
+
+static inline bool obdStartsWith(const uint8_t *data, size_t len, const char *prefix)
+{
+  size_t n = strlen(prefix);
+  return len >= n && memcmp(data, prefix, n) == 0;
+}
+
+static inline ObdStatus obdClassifyLine(const uint8_t *line, size_t len)
+{
+  if (obdStartsWith(line, len, "41"))
+    return OBD_OK;
+  if (obdStartsWith(line, len, "NO DATA"))
+    return OBD_NO_DATA;
+  if (obdStartsWith(line, len, "CAN ERROR"))
+    return OBD_CAN_ERROR;
+  if (obdStartsWith(line, len, "BUS INIT"))
+    return OBD_BUS_INIT;
+  if (obdStartsWith(line, len, "BUS ") || obdStartsWith(line, len, "DATA ERROR") ||
+      obdStartsWith(line, len, "<RX ERROR") || obdStartsWith(line, len, "FB ERROR"))
+    return OBD_BUS_ERROR;
+  if (obdStartsWith(line, len, "STOPPED"))
+    return OBD_STOPPED;
+  if (obdStartsWith(line, len, "SEARCHING"))
+    return OBD_SEARCHING;
+  if (obdStartsWith(line, len, "?"))
+    return OBD_UNKNOWN;
+  if (obdStartsWith(line, len, "BUFFER FULL"))
+    return OBD_BUFFER_FULL;
+  if (obdStartsWith(line, len, "UNABLE TO CONNECT"))
+    return OBD_UNABLE_TO_CONNECT;
+  if (obdStartsWith(line, len, "ERR"))
+    return OBD_ERROR;
+  if (obdStartsWith(line, len, "7F"))
+    return OBD_NEGATIVE;
+  if (len >= 2 && line[0] >= '0' && line[0] <= '9' && memchr(line, 'V', len))
+    return OBD_VOLTAGE;
+  return OBD_OTHER;
+}
+
+/* Parse an ATRV answer ("12.6V"), data starts at the classified line */
+static inline bool obdParseVoltage(const uint8_t *data, size_t len, float *volts)
+{
+  float v = 0;
+  float scale = 0; // 0 before the decimal point
+  size_t i = 0;
+  for (; i < len && data[i] != 'V'; i++)
+  {
+    if (data[i] == '.' && scale == 0)
+      scale = 0.1f;
+    else if (data[i] >= '0' && data[i] <= '9')
+    {
+      if (scale == 0)
+        v = v * 10 + (data[i] - '0');
+      else
+      {
+        v += (data[i] - '0') * scale;
+        scale /= 10;
+      }
+    }
+    else
+      return false;
+  }
+  if (i == len)
+    return false;
+  *volts = v;
+  return true;
+}
+
+static inline bool obdBlank(uint8_t c)
+{
+  return c == '\r' || c == '\n' || c == ' ' || c == '>' || c == 0;
+}
+
+/**
+ * Classify an adapter response
+ *
+ * Looks at the first meaningful line, skipping a "SEARCHING..." line when
+ * the actual answer follows it.
+ *
+ * @param data    Response bytes
+ * @param len     Number of bytes
+ * @param offset  Set to the start of the classified line
+ */
+static inline ObdStatus obdClassify(const uint8_t *data, size_t len, size_t *offset)
+{
+  ObdStatus status = OBD_PROMPT;
+  size_t i = 0;
+
+  while (i < len)
+  {
+    while (i < len && obdBlank(data[i]))
+      i++;
+    if (i >= len)
+      break;
+
+    size_t end = i;
+    while (end < len && data[end] != '\r' && data[end] != '\n')
+      end++;
+
+    status = obdClassifyLine(data + i, end - i);
+    if (offset)
+      *offset = i;
+    if (status != OBD_SEARCHING)
+      break;
+    i = end;
+  }
+  return status;
+}
+
+/**
+ * Collects adapter output up to the ">" prompt
+ *
+ * Notifications split an answer wherever the link likes ("41 0C 1", then
+ * "A F8\r>"), so bytes are gathered until the prompt and only the whole
+ * response is classified. An answer longer than N keeps its first N bytes.
+ */
+template <size_t N>
+class ObdAssembler
+{
+public:
+  /**
+   * Append bytes up to and including the next prompt
+   *
+   * @return  Number of bytes taken, the rest belongs to the next response
+   */
+  size_t add(const uint8_t *bytes, size_t len)
+  {
+    if (done)
+      clear();
+
+    size_t i = 0;
+    while (i < len && !done)
+    {
+      uint8_t c = bytes[i++];
+      if (count < N)
+        buf[count++] = c;
+      done = c == '>';
+    }
+    return i;
+  }
+
+  /* True once the prompt arrived, until the next add() or clear() */
+  bool complete() const
+  {
+    return done;
+  }
+
+  const uint8_t *data() const
+  {
+    return buf;
+  }
+
+  size_t length() const
+  {
+    return count;
+  }
+
+  /* Drop a response that never got its prompt */
+  void clear()
+  {
+    count = 0;
+    done = false;
+  }
+
+private:
+  uint8_t buf[N];
+  size_t count = 0;
+  bool done = false;
+};
+
+/* ---------- PID SCHEDULER ---------- */
+struct ObdPid
+{
+  uint8_t pid;
+  const uint8_t *cmd; // request bytes (ASCII + CR)
+  size_t cmdLen;
+  uint32_t period;   // nominal poll period in ms
+  void *target;      // stale flag sink, opaque to the scheduler
+  bool heartbeat;    // still polled while the engine is off
+  uint32_t lastRequest;
+  uint32_t lastValid; // 0 until the first valid answer
+  uint8_t failures;   // consecutive failed requests
+  bool stale;
+};
+
+/**
+ * Polls a table of PIDs one request at a time
+ *
+ * Every answer is attributed to the request in flight, so "NO DATA" and
+ * friends count against the PID that caused them. A request stays in flight
+ * until the adapter's ">" prompt, as any byte written before it aborts the
+ * command with "STOPPED". PIDs that keep failing
+ * back off exponentially (up to 2^maxShift times their period) and a PID is
+ * stale once its last valid answer is older than `staleFactor` periods.
+ *
+ * In heartbeat mode only the PIDs flagged `heartbeat` are polled, at the
+ * heartbeat period and without back-off, so a waking engine is seen on the
+ * next poll.
+ */
+template <size_t N>
+class ObdScheduler
+{
+public:
+  ObdScheduler(ObdPid (&pids)[N], uint32_t timeout, uint8_t staleFactor = 3, uint8_t maxShift = 5)
+      : pids(pids), timeout(timeout), staleFactor(staleFactor), maxShift(maxShift)
+  {
+  }
+
+  /* Forget the in-flight request and all failures, e.g. after reconnecting */
+  void reset()
+  {
+    inFlight = nullptr;
+    answered = false;
+    for (size_t i = 0; i < N; i++)
+    {
+      pids[i].failures = 0;
+      pids[i].lastRequest = 0;
+    }
+  }
+
+  /* Effective period including back-off */
+  uint32_t period(const ObdPid &p) const
+  {
+    if (heartbeat)
+      return p.period > heartbeat ? p.period : heartbeat;
+    uint8_t shift = p.failures < maxShift ? p.failures : maxShift;
+    return p.period << shift;
+  }
+
+  /* Poll only the heartbeat PIDs every `period` ms, 0 to go back to normal */
+  void setHeartbeat(uint32_t period)
+  {
+    heartbeat = period;
+  }
+
+  /* A request is waiting for its answer or the prompt after it */
+  bool busy() const
+  {
+    return inFlight != nullptr;
+  }
+
+  /**
+   * PID to request now, nullptr if a request is outstanding or nothing is due
+   */
+  ObdPid *next(uint32_t now)
+  {
+    if (inFlight)
+    {
+      if ((uint32_t)(now - sent) < timeout)
+        return nullptr;
+      if (!answered)
+      {
+        fail(*inFlight); // no answer at all
+        timeouts++;
+      }
+      inFlight = nullptr; // answered but the prompt got lost
+    }
+
+    ObdPid *best = nullptr;
+    uint32_t bestLate = 0;
+    for (size_t i = 0; i < N; i++)
+    {
+      ObdPid &p = pids[i];
+      if (heartbeat && !p.heartbeat)
+        continue;
+      uint32_t since = now - p.lastRequest;
+      uint32_t per = period(p);
+      if (p.lastRequest && since < per)
+        continue;
+      uint32_t late = p.lastRequest ? since - per : UINT32_MAX;
+      if (!best || late > bestLate)
+      {
+        best = &p;
+        bestLate = late;
+      }
+    }
+
+    if (best)
+    {
+      best->lastRequest = now ? now : 1;
+      inFlight = best;
+      answered = false;
+      sent = now;
+      requests++;
+    }
+    return best;
+  }
+
+  /* Time until next() has something to do, 0 if it has now */
+  uint32_t idle(uint32_t now) const
+  {
+    if (inFlight)
+    {
+      uint32_t elapsed = now - sent;
+      return elapsed >= timeout ? 0 : timeout - elapsed;
+    }
+
+    uint32_t best = UINT32_MAX;
+    for (size_t i = 0; i < N; i++)
+    {
+      const ObdPid &p = pids[i];
+      if (heartbeat && !p.heartbeat)
+        continue;
+      uint32_t since = now - p.lastRequest;
+      uint32_t per = period(p);
+      if (!p.lastRequest || since >= per)
+        return 0;
+      if (per - since < best)
+        best = per - since;
+    }
+    return best;
+  }
+
+  /**
+   * Account an adapter answer to the request in flight
+   *
+   * @param status  Classified response
+   * @param pid     PID found in an OBD_OK answer
+   * @return        The PID the answer belonged to, nullptr if unattributed
+   */
+  ObdPid *onResponse(ObdStatus status, uint8_t pid, uint32_t now)
+  {
+    ObdPid *p = inFlight;
+    if (!p || answered || status == OBD_PROMPT || status == OBD_OTHER)
+      return nullptr; // lines after the first answer are from other ECUs
+
+    if (status == OBD_SEARCHING)
+    {
+      sent = now; // still working on it
+      return nullptr;
+    }
+
+    answered = true;
+    if (status == OBD_OK && pid == p->pid)
+    {
+      p->lastValid = now ? now : 1;
+      p->failures = 0;
+    }
+    else if (!obdTransient(status))
+    {
+      fail(*p);
+    }
+    return p;
+  }
+
+  /* The adapter printed its ">" prompt and takes the next command */
+  void onPrompt()
+  {
+    inFlight = nullptr;
+    answered = false;
+  }
+
+  /* Recompute the stale flag, true if it changed */
+  bool updateStale(ObdPid &p, uint32_t now)
+  {
+    bool stale = !p.lastValid || (uint32_t)(now - p.lastValid) > p.period * staleFactor;
+    if (stale == p.stale)
+      return false;
+    p.stale = stale;
+    return true;
+  }
+
+  ObdPid *get(size_t i)
+  {
+    return &pids[i];
+  }
+
+  static size_t size()
+  {
+    return N;
+  }
+
+  uint32_t requestCount() const
+  {
+    return requests;
+  }
+
+  uint32_t timeoutCount() const
+  {
+    return timeouts;
+  }
+
+private:
+  ObdPid (&pids)[N];
+  uint32_t timeout;
+  uint8_t staleFactor;
+  uint8_t maxShift;
+  uint32_t heartbeat = 0;
+
+  ObdPid *inFlight = nullptr;
+  bool answered = false; // the request in flight has its answer, waiting for the prompt
+  uint32_t sent = 0;
+  uint32_t requests = 0;
+  uint32_t timeouts = 0;
+
+  void fail(ObdPid &p)
+  {
+    if (p.failures < 255)
+      p.failures++;
+  }
+};
+
+/* ---------- ADAPTER LOW POWER ---------- */
+enum ObdWrite : uint8_t
+{
+  OBD_WRITE_NONE,
+  OBD_WRITE_REQUEST, // the PID next() returned
+  OBD_WRITE_SLEEP,   // ATLP
+  OBD_WRITE_WAKE,    // a throwaway CR
+};
+
+/**
+ * Heartbeat polling with the adapter in low power in between
+ *
+ * On engine-off the scheduler switches to heartbeats and ATLP goes out once,
+ * after the request in flight. A sleeping ELM327 drops the character that
+ * wakes it, and it may also doze off again on its own inactivity timer, so
+ * each heartbeat is preceded by a CR and written at the prompt that follows,
+ * or `wakeTimeout` ms later without one. On an adapter that was awake the CR
+ * repeats the last command; that answer is dropped with the wake prompt.
+ */
+template <size_t N>
+class AdapterSleep
+{
+public:
+  AdapterSleep(ObdScheduler<N> &scheduler, uint32_t heartbeat, uint32_t wakeTimeout)
+      : scheduler(scheduler), heartbeat(heartbeat), wakeTimeout(wakeTimeout)
+  {
+  }
+
+  /* Full rate with the adapter awake, e.g. after (re)connecting */
+  void reset()
+  {
+    setSleeping(false);
+  }
+
+  /* Engine off: heartbeats and ATLP; engine on: full rate */
+  void setSleeping(bool sleeping)
+  {
+    scheduler.setHeartbeat(sleeping ? heartbeat : 0);
+    state = sleeping ? SLEEP_DUE : AWAKE;
+  }
+
+  /**
+   * What to write to the adapter now
+   *
+   * @param request  Set to the PID to request for OBD_WRITE_REQUEST
+   */
+  ObdWrite next(uint32_t now, ObdPid **request)
+  {
+    *request = nullptr;
+    if (state == WAKING)
+    {
+      if ((uint32_t)(now - wakeSent) < wakeTimeout)
+        return OBD_WRITE_NONE;
+      state = POLLING; // no prompt, try the heartbeat anyway
+    }
+
+    if (state == DOZING)
+    {
+      if (scheduler.idle(now))
+        return OBD_WRITE_NONE;
+      state = WAKING;
+      wakeSent = now;
+      wakes++;
+      return OBD_WRITE_WAKE;
+    }
+
+    *request = scheduler.next(now);
+    if (*request)
+      return OBD_WRITE_REQUEST;
+    if (scheduler.busy())
+      return OBD_WRITE_NONE;
+
+    /* Heartbeats answered, nothing due */
+    if (state == SLEEP_DUE)
+    {
+      state = DOZING;
+      return OBD_WRITE_SLEEP;
+    }
+    if (state == POLLING)
+      state = DOZING;
+    return OBD_WRITE_NONE;
+  }
+
+  /**
+   * The adapter printed its prompt
+   *
+   * @return  True if it answered the wake CR, the response is not a request's
+   */
+  bool onPrompt()
+  {
+    if (state != WAKING)
+      return false;
+    state = POLLING;
+    return true;
+  }
+
+  /* Time until next() has something to do, 0 if it has now */
+  uint32_t idle(uint32_t now) const
+  {
+    if (state != WAKING)
+      return scheduler.idle(now);
+    uint32_t elapsed = now - wakeSent;
+    return elapsed >= wakeTimeout ? 0 : wakeTimeout - elapsed;
+  }
+
+  uint32_t wakeCount() const
+  {
+    return wakes;
+  }
+
+private:
+  enum State : uint8_t
+  {
+    AWAKE,     // engine on
+    SLEEP_DUE, // engine off, ATLP once nothing is in flight
+    DOZING,    // engine off, adapter possibly asleep
+    WAKING,    // wake CR sent, waiting for the prompt
+    POLLING,   // engine off, adapter awake for the heartbeats due
+  };
+
+  ObdScheduler<N> &scheduler;
+  uint32_t heartbeat;
+  uint32_t wakeTimeout;
+
+  State state = AWAKE;
+  uint32_t wakeSent = 0;
+  uint32_t wakes = 0;
+};
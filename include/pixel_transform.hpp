@@ -0,0 +1,227 @@
+#pragma once
+#include <stdint.h>
+#include <string.h>
+
+/*
+ * Rotating and mirroring of flushed RGB565 areas
+ *
+ * A transform is a set of bits: the destination is the source with x and y
+ * swapped if XFORM_SWAP_XY, then mirrored left to right and top to bottom
+ * by XFORM_FLIP_X and XFORM_FLIP_Y. The flip bits are the ones of the HUD
+ * setting (FLIP_X, FLIP_Y). Pixels are moved whole, so the byte order does
+ * not matter.
+ *
+ * Mirrors work in place. A swap needs a separate destination and goes
+ * through the source in tiles, so both stay in cache. Where width, height
+ * and the buffers allow, two pixels move per 32 bit access, otherwise one
+ * at a time.
+ */
+
+#define XFORM_FLIP_X 1
+#define XFORM_FLIP_Y 2
+#define XFORM_SWAP_XY 4
+
+/* Source pixels per tile side when swapping */
+#define XFORM_TILE 16
+
+/* LVGL rotation (0..3 for 0, 90, 180, 270) as transform bits, same mapping as lv_display_rotate_area */
+static inline uint8_t xformRotation(uint8_t rotation)
+{
+  static const uint8_t bits[4] = {0, XFORM_SWAP_XY | XFORM_FLIP_Y, XFORM_FLIP_X | XFORM_FLIP_Y,
+                                  XFORM_SWAP_XY | XFORM_FLIP_X};
+  return bits[rotation & 3];
+}
+
+/* Area of a `srcW` x `srcH` screen as it lands on the panel, inclusive bounds */
+static inline void xformArea(int32_t &x1, int32_t &y1, int32_t &x2, int32_t &y2, int32_t srcW,
+                             int32_t srcH, uint8_t t)
+{
+  int32_t w = srcW, h = srcH;
+  if (t & XFORM_SWAP_XY)
+  {
+    int32_t tmp = x1;
+    x1 = y1;
+    y1 = tmp;
+    tmp = x2;
+    x2 = y2;
+    y2 = tmp;
+    w = srcH;
+    h = srcW;
+  }
+  if (t & XFORM_FLIP_X)
+  {
+    int32_t tmp = x1;
+    x1 = w - 1 - x2;
+    x2 = w - 1 - tmp;
+  }
+  if (t & XFORM_FLIP_Y)
+  {
+    int32_t tmp = y1;
+    y1 = h - 1 - y2;
+    y2 = h - 1 - tmp;
+  }
+}
+
+/* The two pixels of a word, exchanged */
+static inline uint32_t xformSwapHalves(uint32_t v)
+{
+  return (v >> 16) | (v << 16);
+}
+
+static inline bool xformAligned(const void *p)
+{
+  return ((uintptr_t)p & 3) == 0;
+}
+
+/*
+ * Copy rows `a` and `b` to `da` and `db`, reversed if `flipX`. Every pixel
+ * is read before its place is written, so `da` may be `b` and `db` may be
+ * `a` for an in place flip. `a` == `b` for the middle row.
+ */
+static inline void xformRowPair(const uint16_t *a, const uint16_t *b, uint16_t *da, uint16_t *db,
+                                int32_t w, bool flipX)
+{
+  bool same = a == b;
+  if (!flipX)
+  {
+    if (same)
+    {
+      if (da != a)
+        memmove(da, a, w * 2);
+      return;
+    }
+    if ((w & 1) == 0 && xformAligned(a) && xformAligned(b) && xformAligned(da) && xformAligned(db))
+    {
+      const uint32_t *wa = (const uint32_t *)a, *wb = (const uint32_t *)b;
+      uint32_t *wda = (uint32_t *)da, *wdb = (uint32_t *)db;
+      for (int32_t k = 0; k < w / 2; k++)
+      {
+        uint32_t pa = wa[k], pb = wb[k];
+        wda[k] = pa;
+        wdb[k] = pb;
+      }
+      return;
+    }
+    for (int32_t k = 0; k < w; k++)
+    {
+      uint16_t pa = a[k], pb = b[k];
+      da[k] = pa;
+      db[k] = pb;
+    }
+    return;
+  }
+
+  if ((w & 1) == 0 && xformAligned(a) && xformAligned(b) && xformAligned(da) && xformAligned(db))
+  {
+    const uint32_t *wa = (const uint32_t *)a, *wb = (const uint32_t *)b;
+    uint32_t *wda = (uint32_t *)da, *wdb = (uint32_t *)db;
+    int32_t n = w / 2;
+    for (int32_t k = 0; k < (n + 1) / 2; k++)
+    {
+      int32_t r = n - 1 - k;
+      uint32_t a0 = wa[k], a1 = wa[r], b0 = wb[k], b1 = wb[r];
+      wda[k] = xformSwapHalves(a1);
+      wda[r] = xformSwapHalves(a0);
+      if (!same)
+      {
+        wdb[k] = xformSwapHalves(b1);
+        wdb[r] = xformSwapHalves(b0);
+      }
+    }
+    return;
+  }
+
+  for (int32_t k = 0; k < (w + 1) / 2; k++)
+  {
+    int32_t r = w - 1 - k;
+    uint16_t a0 = a[k], a1 = a[r], b0 = b[k], b1 = b[r];
+    da[k] = a1;
+    da[r] = a0;
+    if (!same)
+    {
+      db[k] = b1;
+      db[r] = b0;
+    }
+  }
+}
+
+/* Mirror only, `dst` may be `src` */
+static inline void xformMirror(const uint16_t *src, uint16_t *dst, int32_t w, int32_t h, uint8_t t)
+{
+  bool flipY = t & XFORM_FLIP_Y;
+  for (int32_t i = 0; i < (h + 1) / 2; i++)
+  {
+    int32_t j = h - 1 - i;
+    xformRowPair(src + i * w, src + j * w, dst + (flipY ? j : i) * w, dst + (flipY ? i : j) * w, w,
+                 t & XFORM_FLIP_X);
+  }
+}
+
+/* Swap x and y, then mirror, one tile at a time, `dst` is `h` pixels wide */
+static inline void xformSwap(const uint16_t *src, uint16_t *dst, int32_t w, int32_t h, uint8_t t)
+{
+  const int32_t dw = h, dh = w;
+  bool flipX = t & XFORM_FLIP_X, flipY = t & XFORM_FLIP_Y;
+  bool pairs = (w & 1) == 0 && (h & 1) == 0 && xformAligned(src) && xformAligned(dst);
+
+  for (int32_t ty = 0; ty < h; ty += XFORM_TILE)
+  {
+    int32_t ey = ty + XFORM_TILE < h ? ty + XFORM_TILE : h;
+    for (int32_t tx = 0; tx < w; tx += XFORM_TILE)
+    {
+      int32_t ex = tx + XFORM_TILE < w ? tx + XFORM_TILE : w;
+      if (pairs)
+      {
+        /* 2x2 blocks: two words in, two words out */
+        for (int32_t y = ty; y < ey; y += 2)
+        {
+          const uint32_t *r0 = (const uint32_t *)(src + y * w);
+          const uint32_t *r1 = (const uint32_t *)(src + (y + 1) * w);
+          int32_t u = flipX ? dw - 2 - y : y;
+          for (int32_t x = tx; x < ex; x += 2)
+          {
+            uint32_t p0 = r0[x / 2], p1 = r1[x / 2];
+            uint32_t c0 = (p0 & 0xFFFF) | (p1 << 16);     // column x, rows y and y + 1
+            uint32_t c1 = (p0 >> 16) | (p1 & 0xFFFF0000u); // column x + 1
+            if (flipX)
+            {
+              c0 = xformSwapHalves(c0);
+              c1 = xformSwapHalves(c1);
+            }
+            int32_t v0 = flipY ? dh - 1 - x : x;
+            int32_t v1 = flipY ? v0 - 1 : v0 + 1;
+            ((uint32_t *)(dst + v0 * dw))[u / 2] = c0;
+            ((uint32_t *)(dst + v1 * dw))[u / 2] = c1;
+          }
+        }
+        continue;
+      }
+      for (int32_t y = ty; y < ey; y++)
+      {
+        const uint16_t *row = src + y * w;
+        int32_t u = flipX ? dw - 1 - y : y;
+        for (int32_t x = tx; x < ex; x++)
+        {
+          int32_t v = flipY ? dh - 1 - x : x;
+          dst[v * dw + u] = row[x];
+        }
+      }
+    }
+  }
+}
+
+/**
+ * Transform a packed `w` x `h` area
+ *
+ * @param src  Pixels, `w` per row
+ * @param dst  Result, `h` per row when swapping. May be `src` unless
+ *             swapping
+ * @param t    XFORM_* bits
+ */
+static inline void xformPixels(const uint16_t *src, uint16_t *dst, int32_t w, int32_t h, uint8_t t)
+{
+  if (t & XFORM_SWAP_XY)
+    xformSwap(src, dst, w, h, t);
+  else if (t || src != dst)
+    xformMirror(src, dst, w, h, t);
+}
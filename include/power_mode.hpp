@@ -0,0 +1,138 @@
+#pragma once
+#include <stdint.h>
+
+enum PowerState : uint8_t
+{
+  POWER_ACTIVE, // engine running or recently stopped
+  POWER_SLEEP,  // engine off: display dimmed, adapter in low power, heartbeat polling
+};
+
+/**
+ * Engine-off detection
+ *
+ * Goes to sleep once RPM and speed have both read 0 for `offDelay`, or the
+ * battery voltage has stayed below `chargeVolts` (alternator not charging)
+ * for `offDelay` with no sign of the engine running. Wakes on the first
+ * non-zero RPM or speed, or a voltage back above the charging threshold.
+ *
+ * Fed with timestamped samples only, so recorded traces can be replayed on
+ * the host.
+ */
+class PowerMode
+{
+public:
+  /**
+   * @param offDelay     Time the engine must look off before sleeping, in ms
+   * @param chargeVolts  Battery voltage below which the alternator is not charging
+   * @param hysteresis   Extra volts needed to count as charging again
+   */
+  PowerMode(uint32_t offDelay, float chargeVolts, float hysteresis = 0.3f)
+      : offDelay(offDelay), chargeVolts(chargeVolts), hysteresis(hysteresis)
+  {
+  }
+
+  /* Start over as active, e.g. after (re)connecting */
+  void reset(uint32_t now)
+  {
+    current = POWER_ACTIVE;
+    lastActive = now;
+    zeroRpm = false;
+    zeroSpeed = false;
+    lowSince = 0;
+    wake = false;
+  }
+
+  void rpm(float rpm, uint32_t t)
+  {
+    motion(rpm > 0, zeroRpm, t);
+  }
+
+  void speed(float kmh, uint32_t t)
+  {
+    motion(kmh > 0, zeroSpeed, t);
+  }
+
+  /* Adapter voltage (ATRV) */
+  void voltage(float volts, uint32_t t)
+  {
+    if (volts < chargeVolts)
+    {
+      if (!lowSince)
+        lowSince = t ? t : 1;
+    }
+    else
+    {
+      lowSince = 0;
+    }
+
+    if (current == POWER_SLEEP && volts >= chargeVolts + hysteresis)
+      wake = true;
+  }
+
+  /**
+   * Re-evaluate the state
+   *
+   * @return  True if it changed
+   */
+  bool update(uint32_t now)
+  {
+    if (current == POWER_ACTIVE)
+    {
+      bool idle = (uint32_t)(now - lastActive) >= offDelay;
+      bool stopped = zeroRpm && zeroSpeed;
+      bool discharging = lowSince && (uint32_t)(now - lowSince) >= offDelay;
+      if (idle && (stopped || discharging))
+      {
+        current = POWER_SLEEP;
+        wake = false;
+        transitions++;
+        return true;
+      }
+    }
+    else if (wake)
+    {
+      reset(now);
+      transitions++;
+      return true;
+    }
+    return false;
+  }
+
+  PowerState state() const
+  {
+    return current;
+  }
+
+  bool sleeping() const
+  {
+    return current == POWER_SLEEP;
+  }
+
+  uint32_t transitionCount() const
+  {
+    return transitions;
+  }
+
+private:
+  uint32_t offDelay;
+  float chargeVolts;
+  float hysteresis;
+
+  PowerState current = POWER_ACTIVE;
+  uint32_t lastActive = 0; // last non-zero RPM/speed (or reset)
+  bool zeroRpm = false;    // last RPM sample was 0
+  bool zeroSpeed = false;  // last speed sample was 0
+  uint32_t lowSince = 0;   // voltage below the charging threshold since, 0 if not
+  bool wake = false;       // engine start seen while asleep
+  uint32_t transitions = 0;
+
+  void motion(bool moving, bool &zero, uint32_t t)
+  {
+    zero = !moving;
+    if (!moving)
+      return;
+    lastActive = t;
+    if (current == POWER_SLEEP)
+      wake = true;
+  }
+};
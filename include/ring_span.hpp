@@ -0,0 +1,254 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+
+/*
+ * Anti-aliased ring of a fixed size, as spans built at compile time
+ *
+ * Geometry follows lv_draw_arc: the center is a pixel, `radius` is the
+ * outermost pixel and the ring is `width` pixels thick. Only the lower
+ * right quadrant is stored, rows and columns from the center pixel out,
+ * and mirrored when filling.
+ */
+
+/* Subrows sampled for the coverage of an edge pixel, columns are exact */
+#define RING_SUBROWS 16
+
+/* sqrt for the tables, Newton from above until it stops shrinking */
+constexpr double ringSqrt(double v)
+{
+  if (v <= 0)
+    return 0;
+  double x = v > 1 ? v : 1;
+  for (int i = 0; i < 64; i++)
+  {
+    double next = 0.5 * (x + v / x);
+    if (next >= x)
+      break;
+    x = next;
+  }
+  return x;
+}
+
+/* Half width of a disk of radius `g` at height `y`, 0 outside */
+constexpr double ringHalfWidth(double g, double y)
+{
+  return y >= g ? 0 : ringSqrt(g * g - y * y);
+}
+
+/* Share of pixel (x, q) inside a disk of radius `g`, 0..1 */
+constexpr double ringDiskCover(double g, int32_t x, int32_t q)
+{
+  double sum = 0;
+  for (int k = 0; k < RING_SUBROWS; k++)
+  {
+    double y = q - 0.5 + (k + 0.5) / RING_SUBROWS;
+    double h = ringHalfWidth(g, y < 0 ? -y : y);
+    double lo = x - 0.5 > -h ? x - 0.5 : -h;
+    double hi = x + 0.5 < h ? x + 0.5 : h;
+    if (hi > lo)
+      sum += hi - lo;
+  }
+  return sum / RING_SUBROWS;
+}
+
+/* Columns of a quadrant row, pixels in [start, solidStart) and [solidEnd, end) are partial */
+struct RingRow
+{
+  uint16_t start;
+  uint16_t solidStart;
+  uint16_t solidEnd;
+  uint16_t end;
+};
+
+/* Columns fully inside and touched by a disk of radius `g` in row `q` */
+constexpr void ringDiskRow(double g, int32_t q, uint16_t &full, uint16_t &touched)
+{
+  double near = ringHalfWidth(g, q > 0 ? q - 0.5 : 0);
+  double far = ringHalfWidth(g, q + 0.5);
+  full = (uint16_t)(far + 0.5);
+  double e = near + 0.5;
+  touched = near > 0 ? (uint16_t)e + ((double)(uint16_t)e < e) : 0;
+}
+
+constexpr RingRow ringRow(uint16_t radius, uint16_t width, int32_t q)
+{
+  uint16_t innerFull = 0, innerTouched = 0, outerFull = 0, outerTouched = 0;
+  ringDiskRow(radius - width + 0.5, q, innerFull, innerTouched);
+  ringDiskRow(radius + 0.5, q, outerFull, outerTouched);
+  RingRow row = {innerFull, innerTouched, outerFull, outerTouched};
+  if (innerTouched > outerFull)
+  {
+    /* The two edges meet, one partial run */
+    row.solidStart = outerFull;
+    row.solidEnd = outerFull;
+  }
+  return row;
+}
+
+/* Partial pixels of a whole quadrant */
+constexpr uint32_t ringEdgeCount(uint16_t radius, uint16_t width)
+{
+  uint32_t n = 0;
+  for (int32_t q = 0; q <= radius; q++)
+  {
+    RingRow row = ringRow(radius, width, q);
+    n += (row.solidStart - row.start) + (row.end - row.solidEnd);
+  }
+  return n;
+}
+
+/* Part of the ring between two angles, and how to paint it */
+struct RingArc
+{
+  int32_t startSin; // Q15, as lv_trigo_sin
+  int32_t startCos;
+  int32_t endSin;
+  int32_t endCos;
+  bool wide;        // more than 180 degrees, either side of the cuts
+  bool full;        // no cuts
+  uint16_t color;   // RGB565, in the byte order of the buffer
+  uint8_t opa;
+  bool swapped;     // buffer is RGB565 with the bytes swapped
+};
+
+/* fg over bg by `a` 0..255, per channel, edges are too few to need the packed trick */
+static inline uint16_t ringMix(uint16_t fg, uint16_t bg, uint32_t a)
+{
+  uint32_t ia = 255 - a;
+  uint32_t r = ((fg >> 11) * a + (bg >> 11) * ia + 127) / 255;
+  uint32_t g = (((fg >> 5) & 0x3F) * a + ((bg >> 5) & 0x3F) * ia + 127) / 255;
+  uint32_t b = ((fg & 0x1F) * a + (bg & 0x1F) * ia + 127) / 255;
+  return (uint16_t)(r << 11 | g << 5 | b);
+}
+
+static inline uint16_t ringSwap(uint16_t c)
+{
+  return (uint16_t)((c >> 8) | (c << 8));
+}
+
+/**
+ * Spans and edge coverage of a ring
+ *
+ * Declare as constexpr so the tables are built by the compiler and live in
+ * flash, a 466 px ring of 30 px is about 3 KB.
+ */
+template <uint16_t RADIUS, uint16_t WIDTH>
+class RingSpans
+{
+public:
+  static constexpr uint16_t radius = RADIUS;
+  static constexpr uint16_t width = WIDTH;
+  static constexpr uint32_t edges = ringEdgeCount(RADIUS, WIDTH);
+
+  constexpr RingSpans() : rows(), offset(), cover()
+  {
+    uint32_t n = 0;
+    for (int32_t q = 0; q <= RADIUS; q++)
+    {
+      RingRow row = ringRow(RADIUS, WIDTH, q);
+      rows[q] = row;
+      offset[q] = n;
+      for (int32_t x = row.start; x < row.end; x++)
+      {
+        if (x >= row.solidStart && x < row.solidEnd)
+          continue;
+        double c = ringDiskCover(RADIUS + 0.5, x, q) - ringDiskCover(RADIUS - WIDTH + 0.5, x, q);
+        cover[n++] = (uint8_t)(c <= 0 ? 0 : c >= 1 ? 255 : c * 255 + 0.5);
+      }
+    }
+  }
+
+  /**
+   * Blend the ring into an RGB565 buffer
+   *
+   * @param buf     Pixel of the buffer at (bufX, bufY)
+   * @param stride  Pixels per buffer row
+   * @param x1      Clip area, absolute and inclusive, inside the buffer
+   * @param cx      Center pixel, absolute
+   */
+  void fill(uint16_t *buf, int32_t stride, int32_t bufX, int32_t bufY, int32_t x1, int32_t y1,
+            int32_t x2, int32_t y2, int32_t cx, int32_t cy, const RingArc &arc) const
+  {
+    if (y1 < cy - RADIUS)
+      y1 = cy - RADIUS;
+    if (y2 > cy + RADIUS)
+      y2 = cy + RADIUS;
+    for (int32_t y = y1; y <= y2; y++)
+    {
+      int32_t dy = y - cy;
+      uint16_t *line = buf + (y - bufY) * stride - bufX;
+      /* Left half first so the row is written left to right */
+      span(line, dy, -1, x1, x2, cx, arc);
+      span(line, dy, 1, x1, x2, cx, arc);
+    }
+  }
+
+private:
+  /* One half of a row, `side` -1 for the columns left of the center */
+  void span(uint16_t *line, int32_t dy, int32_t side, int32_t x1, int32_t x2, int32_t cx,
+            const RingArc &arc) const
+  {
+    const int32_t one = 1 << 15;
+    const RingRow &row = rows[dy < 0 ? -dy : dy];
+    const uint8_t *edge = cover + offset[dy < 0 ? -dy : dy];
+
+    /* Quadrant columns to visit, clipped */
+    int32_t lo = side > 0 ? x1 - cx : cx - x2;
+    int32_t hi = side > 0 ? x2 - cx : cx - x1;
+    if (lo < row.start)
+      lo = row.start;
+    if (side < 0 && lo < 1)
+      lo = 1; // the center column belongs to the right half
+    if (hi > row.end - 1)
+      hi = row.end - 1;
+    if (lo > hi)
+      return;
+
+    /* Distance to the two cuts in Q15 pixels, columns go left to right on both halves */
+    int32_t dx = side < 0 ? -hi : lo;
+    int32_t d1 = arc.startCos * dy - arc.startSin * dx;
+    int32_t d2 = arc.endSin * dx - arc.endCos * dy;
+    int32_t solidCover = row.solidStart - row.start;
+
+    for (int32_t i = 0; i <= hi - lo; i++, d1 -= arc.startSin, d2 += arc.endSin)
+    {
+      int32_t x = side < 0 ? hi - i : lo + i;
+      uint32_t c;
+      if (x < row.solidStart)
+        c = edge[x - row.start];
+      else if (x < row.solidEnd)
+        c = 255;
+      else
+        c = edge[solidCover + x - row.solidEnd];
+
+      int32_t a = one;
+      if (!arc.full)
+      {
+        int32_t a1 = d1 + one / 2;
+        int32_t a2 = d2 + one / 2;
+        a1 = a1 < 0 ? 0 : a1 > one ? one : a1;
+        a2 = a2 < 0 ? 0 : a2 > one ? one : a2;
+        a = arc.wide ? (a1 > a2 ? a1 : a2) : (a1 < a2 ? a1 : a2);
+      }
+
+      uint16_t *px = line + cx + side * x;
+      if (c == 255 && a == one && arc.opa == 255)
+      {
+        *px = arc.color;
+        continue;
+      }
+      uint32_t alpha = ((c * (uint32_t)a >> 15) * arc.opa + 127) / 255;
+      if (alpha == 0)
+        continue;
+      if (arc.swapped)
+        *px = ringSwap(ringMix(ringSwap(arc.color), ringSwap(*px), alpha));
+      else
+        *px = ringMix(arc.color, *px, alpha);
+    }
+  }
+
+  RingRow rows[RADIUS + 1];
+  uint32_t offset[RADIUS + 1];
+  uint8_t cover[edges];
+};
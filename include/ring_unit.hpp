@@ -0,0 +1,113 @@
+#pragma once
+#include <stdint.h>
+#include "lvgl_private.h"
+#include "ring_span.hpp"
+
+/*
+ * Ring draw unit
+ *
+ * Draws the dashboard arcs from the RingSpans tables rather than with the
+ * circle and angle masks LVGL builds for every arc. It only takes plain,
+ * unrounded arcs of a size with a table on an RGB565 layer, anything else
+ * stays with the software renderer. Build with -D NO_RING_SPANS to leave
+ * every arc to LVGL.
+ */
+
+/* Diameter of the dashboard arcs, dashboard.xml lays them out at 466 on every board */
+#ifndef GAUGE_SIZE
+#define GAUGE_SIZE 466
+#endif
+/* Built by the compiler, in flash: the rpm and fuel indicators and their track */
+static constexpr RingSpans<GAUGE_SIZE / 2, 30> gaugeIndicator{};
+static constexpr RingSpans<GAUGE_SIZE / 2, 3> gaugeTrack{};
+static uint32_t ringArcs; // arcs drawn from the tables, the UI task reads and clears it
+
+#define RING_UNIT_ID 64
+
+static bool ringFits(const lv_draw_arc_dsc_t *dsc)
+{
+  return dsc->radius == gaugeIndicator.radius &&
+         (dsc->width == gaugeIndicator.width || dsc->width == gaugeTrack.width);
+}
+
+static int32_t ringEvaluate(lv_draw_unit_t *unit, lv_draw_task_t *t)
+{
+  if (t->type != LV_DRAW_TASK_TYPE_ARC)
+    return 0;
+  const lv_draw_arc_dsc_t *dsc = (const lv_draw_arc_dsc_t *)t->draw_dsc;
+  lv_color_format_t cf = t->target_layer->color_format;
+  if (!ringFits(dsc) || dsc->rounded || dsc->img_src ||
+      (cf != LV_COLOR_FORMAT_RGB565 && cf != LV_COLOR_FORMAT_RGB565_SWAPPED))
+    return 0;
+  /* The software unit asks for 100 */
+  if (t->preference_score > 50)
+  {
+    t->preference_score = 50;
+    t->preferred_draw_unit_id = RING_UNIT_ID;
+  }
+  return 0;
+}
+
+static void ringDraw(lv_draw_task_t *t)
+{
+  const lv_draw_arc_dsc_t *dsc = (const lv_draw_arc_dsc_t *)t->draw_dsc;
+  lv_layer_t *layer = t->target_layer;
+  lv_area_t clip;
+  if (!lv_area_intersect(&clip, &t->clip_area, &t->area))
+    return;
+
+  int32_t start = ((int32_t)dsc->start_angle % 360 + 360) % 360;
+  int32_t end = ((int32_t)dsc->end_angle % 360 + 360) % 360;
+  bool full = dsc->end_angle - dsc->start_angle == 360;
+  if (start == end && !full)
+    return;
+  int32_t sweep = end > start ? end - start : end + 360 - start;
+
+  bool swapped = layer->color_format == LV_COLOR_FORMAT_RGB565_SWAPPED;
+  uint16_t color = lv_color_to_u16(dsc->color);
+  RingArc arc;
+  arc.startSin = lv_trigo_sin(start);
+  arc.startCos = lv_trigo_cos(start);
+  arc.endSin = lv_trigo_sin(end);
+  arc.endCos = lv_trigo_cos(end);
+  arc.wide = sweep > 180;
+  arc.full = full;
+  arc.color = swapped ? ringSwap(color) : color;
+  arc.opa = dsc->opa;
+  arc.swapped = swapped;
+
+  lv_draw_buf_t *buf = layer->draw_buf;
+  uint16_t *px = (uint16_t *)buf->data;
+  int32_t stride = buf->header.stride / 2;
+  if (dsc->width == gaugeIndicator.width)
+    gaugeIndicator.fill(px, stride, layer->buf_area.x1, layer->buf_area.y1, clip.x1, clip.y1, clip.x2,
+                        clip.y2, dsc->center.x, dsc->center.y, arc);
+  else
+    gaugeTrack.fill(px, stride, layer->buf_area.x1, layer->buf_area.y1, clip.x1, clip.y1, clip.x2,
+                    clip.y2, dsc->center.x, dsc->center.y, arc);
+  ringArcs++;
+}
+
+/* Synchronous: the arc is drawn by the time this returns */
+static int32_t ringDispatch(lv_draw_unit_t *unit, lv_layer_t *layer)
+{
+  lv_draw_task_t *t = lv_draw_get_available_task(layer, NULL, RING_UNIT_ID);
+  if (t == NULL || t->preferred_draw_unit_id != RING_UNIT_ID)
+    return LV_DRAW_UNIT_IDLE;
+  if (lv_draw_layer_alloc_buf(layer) == NULL)
+    return LV_DRAW_UNIT_IDLE;
+
+  t->state = LV_DRAW_TASK_STATE_IN_PROGRESS;
+  ringDraw(t);
+  t->state = LV_DRAW_TASK_STATE_FINISHED;
+  lv_draw_dispatch_request();
+  return 1;
+}
+
+static void ringUnitInit()
+{
+  lv_draw_unit_t *unit = (lv_draw_unit_t *)lv_draw_create_unit(sizeof(lv_draw_unit_t));
+  unit->name = "RING";
+  unit->evaluate_cb = ringEvaluate;
+  unit->dispatch_cb = ringDispatch;
+}
@@ -0,0 +1,150 @@
+#pragma once
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+
+/* A window of the panel, its pixels follow the previous run's in the buffer */
+struct SpanRun
+{
+  int16_t x;
+  int16_t y;
+  uint16_t w;
+  uint16_t h;
+};
+
+/* Pixels a run list covers */
+static inline uint32_t spanPixels(const SpanRun *runs, uint16_t count)
+{
+  uint32_t n = 0;
+  for (uint16_t i = 0; i < count; i++)
+    n += runs[i].w * runs[i].h;
+  return n;
+}
+
+/**
+ * Visible span of every row of a round panel
+ *
+ * The corners of a W x H buffer are never seen on a round panel. Areas are
+ * trimmed to the circle before rendering and rendered strips are compacted
+ * to their visible part before flushing. Everything works on row pairs with
+ * even columns, as the 2x2 rounder leaves the areas.
+ */
+template <uint16_t W, uint16_t H>
+class CircleSpans
+{
+public:
+  CircleSpans()
+  {
+    float cx = W / 2.0f;
+    float cy = H / 2.0f;
+    float r = (W < H ? W : H) / 2.0f;
+    for (uint16_t y = 0; y < H; y++)
+    {
+      float dy = y + 0.5f - cy;
+      if (dy * dy >= r * r)
+      {
+        left[y] = W; // empty
+        right[y] = 0;
+        continue;
+      }
+      float half = sqrtf(r * r - dy * dy);
+      float l = ceilf(cx - half - 0.5f);
+      float rr = floorf(cx + half - 0.5f);
+      left[y] = l < 0 ? 0 : (uint16_t)l;
+      right[y] = rr > W - 1 ? W - 1 : (uint16_t)rr;
+    }
+  }
+
+  /* Visible columns of a row pair, even aligned, false if none */
+  bool pair(int32_t y, int32_t &x1, int32_t &x2) const
+  {
+    uint16_t l = left[y] < left[y + 1] ? left[y] : left[y + 1];
+    uint16_t r = right[y] > right[y + 1] ? right[y] : right[y + 1];
+    if (l > r)
+      return false;
+    x1 = l & ~1;
+    x2 = r | 1;
+    return true;
+  }
+
+  /**
+   * Shrink an invalidated area to the part of it inside the circle
+   *
+   * Areas entirely in a corner are left as they are, LVGL cannot drop them.
+   */
+  void clip(int32_t &x1, int32_t &y1, int32_t &x2, int32_t &y2) const
+  {
+    int32_t top = -1, bottom = -1;
+    int32_t l = x2, r = x1;
+    for (int32_t y = y1 & ~1; y < y2; y += 2)
+    {
+      int32_t sl, sr;
+      if (!pair(y, sl, sr) || sr < x1 || sl > x2)
+        continue;
+      if (top < 0)
+        top = y;
+      bottom = y + 1;
+      if (sl < l)
+        l = sl;
+      if (sr > r)
+        r = sr;
+    }
+    if (top < 0)
+      return;
+    if (top > y1)
+      y1 = top;
+    if (bottom < y2)
+      y2 = bottom;
+    if (l > x1)
+      x1 = l;
+    if (r < x2)
+      x2 = r;
+  }
+
+  /**
+   * Compact a rendered area in place to the windows the panel can show
+   *
+   * Row pairs sharing the same span are merged into one run, pairs with
+   * nothing visible are dropped.
+   *
+   * @param data     RGB565 pixels of the area, rewritten
+   * @param runs     Filled with the windows to send, in buffer order
+   * @param maxRuns  Capacity of `runs`, at least half the area height
+   * @return         Number of runs
+   */
+  uint16_t shape(int32_t x1, int32_t y1, int32_t x2, int32_t y2, uint16_t *data, SpanRun *runs,
+                 uint16_t maxRuns) const
+  {
+    int32_t w = x2 - x1 + 1;
+    uint16_t *out = data;
+    uint16_t count = 0;
+
+    for (int32_t y = y1; y < y2 && count < maxRuns; y += 2)
+    {
+      int32_t sl, sr;
+      if (!pair(y, sl, sr) || sr < x1 || sl > x2)
+        continue;
+      if (sl < x1)
+        sl = x1;
+      if (sr > x2)
+        sr = x2;
+      uint16_t len = sr - sl + 1;
+
+      const uint16_t *row = data + (y - y1) * w + (sl - x1);
+      memmove(out, row, len * 2);
+      memmove(out + len, row + w, len * 2);
+      out += 2 * len;
+
+      SpanRun *last = count ? &runs[count - 1] : nullptr;
+      if (last && last->x == sl && last->w == len && last->y + last->h == y)
+        last->h += 2;
+      else
+        runs[count++] = {(int16_t)sl, (int16_t)y, len, 2};
+    }
+    return count;
+  }
+
+private:
+  uint16_t left[H];
+  uint16_t right[H];
+};
@@ -0,0 +1,162 @@
+#pragma once
+#include <stdint.h>
+#include <string.h>
+#include "round_span.hpp"
+
+/**
+ * Skips pixels the panel already shows
+ *
+ * Keeps a hash of what was last sent for every `SEG` columns of every row
+ * pair. A flush is cut down to the changed segments of each row pair, from
+ * the first to the last one, so a label redrawn with the same digits costs
+ * a few hashes instead of a transfer.
+ *
+ * Pays only when enough is skipped: over every `window` flushes, if less
+ * than 1/8 of the pixels were skipped it switches itself off for `backoff`
+ * flushes and starts over with an empty table.
+ *
+ * Call reset() whenever the panel content changes behind its back (flip,
+ * rotation, direct drawing). A hash collision leaves a segment stale until
+ * it changes again, the clipped range is hashed in to keep partial
+ * segments apart.
+ */
+template <uint16_t W, uint16_t H, uint16_t SEG = 64>
+class RowDiff
+{
+public:
+  RowDiff(uint16_t window = 64, uint16_t backoff = 600) : window(window), backoff(backoff)
+  {
+    reset();
+  }
+
+  /* Forget what the panel shows, everything is sent next time */
+  void reset()
+  {
+    memset(hashes, 0, sizeof(hashes));
+  }
+
+  bool active() const
+  {
+    return !paused;
+  }
+
+  /**
+   * Cut packed runs down to what changed, compacting `data` in place
+   *
+   * @param in      Runs to send, pixels packed back to back in `data`
+   * @param count   Number of input runs
+   * @param data    RGB565 pixels, rewritten
+   * @param out     Filled with the runs left to send, not `in`. Needs room
+   *                for one run per row pair
+   * @return        Number of output runs
+   */
+  uint16_t filter(const SpanRun *in, uint16_t count, uint16_t *data, SpanRun *out)
+  {
+    if (paused)
+    {
+      if (--paused == 0)
+        reset();
+      memcpy(out, in, count * sizeof(SpanRun));
+      return count;
+    }
+
+    const uint16_t *src = data;
+    uint16_t *dst = data;
+    uint16_t n = 0;
+
+    for (uint16_t r = 0; r < count; r++)
+    {
+      const SpanRun &run = in[r];
+      int32_t x1 = run.x;
+      int32_t x2 = run.x + run.w - 1;
+
+      for (int32_t y = run.y; y < run.y + run.h; y += 2, src += 2 * run.w)
+      {
+        int32_t first = -1, last = -1;
+        uint32_t *row = hashes[y / 2];
+        for (int32_t s = x1 / SEG; s <= x2 / SEG; s++)
+        {
+          int32_t c1 = s * SEG > x1 ? s * SEG : x1;
+          int32_t c2 = s * SEG + SEG - 1 < x2 ? s * SEG + SEG - 1 : x2;
+          uint32_t h = hash(src + (c1 - x1), run.w, c2 - c1 + 1, (c1 << 16) | c2);
+          if (h != row[s])
+          {
+            row[s] = h;
+            if (first < 0)
+              first = c1;
+            last = c2;
+          }
+        }
+
+        examined += 2 * run.w;
+        if (first < 0)
+          continue;
+
+        uint16_t len = last - first + 1;
+        const uint16_t *pair = src + (first - x1);
+        memmove(dst, pair, len * 2);
+        memmove(dst + len, pair + run.w, len * 2);
+        dst += 2 * len;
+        sent += 2 * len;
+
+        SpanRun *prev = n ? &out[n - 1] : nullptr;
+        if (prev && prev->x == first && prev->w == len && prev->y + prev->h == y)
+          prev->h += 2;
+        else
+          out[n++] = {(int16_t)first, (int16_t)y, len, 2};
+      }
+    }
+
+    account();
+    return n;
+  }
+
+  /* Pixels looked at and pixels left to send, since the last call */
+  void takeStats(uint32_t &seen, uint32_t &kept)
+  {
+    seen = totalExamined + examined;
+    kept = totalSent + sent;
+    totalExamined = 0;
+    totalSent = 0;
+  }
+
+private:
+  static const uint16_t SEGS = (W + SEG - 1) / SEG;
+
+  uint32_t hashes[H / 2][SEGS]; // 0 = unknown
+  uint16_t window;
+  uint16_t backoff;
+  uint16_t paused = 0; // flushes left before trying again
+
+  uint16_t flushes = 0;
+  uint32_t examined = 0; // this window
+  uint32_t sent = 0;
+  uint32_t totalExamined = 0;
+  uint32_t totalSent = 0;
+
+  /* FNV-1a over 32 bit words of both rows, columns come in even pairs */
+  static uint32_t hash(const uint16_t *px, uint16_t stride, uint16_t len, uint32_t seed)
+  {
+    uint32_t h = 2166136261u ^ seed;
+    for (uint8_t row = 0; row < 2; row++)
+    {
+      const uint32_t *w = (const uint32_t *)(px + row * stride);
+      for (uint16_t i = 0; i < len / 2; i++)
+        h = (h ^ w[i]) * 16777619u;
+    }
+    return h | 1;
+  }
+
+  void account()
+  {
+    if (++flushes < window)
+      return;
+    if (examined && examined - sent < examined / 8)
+      paused = backoff;
+    totalExamined += examined;
+    totalSent += sent;
+    flushes = 0;
+    examined = 0;
+    sent = 0;
+  }
+};
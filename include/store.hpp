@@ -0,0 +1,185 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+/**
+ * Write-coalescing store on top of NVS
+ *
+ * Values are registered once with their backing memory and a delay.
+ * touch() snapshots the value into a shadow copy and marks it dirty unless it
+ * still matches what was last loaded or saved. A slot is written at most
+ * once per delay after its first unsaved change, or right away when a flush
+ * is forced (slider release, disconnect, shutdown). Keeps flash wear and
+ * write stalls independent of how often values change.
+ *
+ * Writing is split in two so NVS is never written with the owner's lock
+ * held: collect() copies the due shadows into a Stage (cheap, call under
+ * lock), commit() writes the Stage out (slow, no lock needed).
+ *
+ * `Backend` is anything with Preferences' put/get Bytes/Int, so the policy
+ * can be exercised on the host with a fake.
+ */
+template <typename Backend, uint8_t N = 8, size_t S = 64>
+class CoalescedStore
+{
+public:
+  /* Snapshot of the slots being written */
+  struct Stage
+  {
+    uint32_t mask;
+    uint8_t data[S];
+  };
+
+  CoalescedStore(Backend &backend) : backend(backend)
+  {
+  }
+
+  /**
+   * Register a value stored as a blob
+   *
+   * @param key    NVS key (max 15 chars)
+   * @param data   Memory holding the value
+   * @param size   Size of the value in bytes
+   * @param delay  Max time a change stays unsaved, in ms
+   * @return       Slot index, -1 if the store is full
+   */
+  int8_t add(const char *key, void *data, size_t size, uint32_t delay)
+  {
+    if (count >= N || used + size > S)
+      return -1;
+    slots[count] = {key, data, size, used, delay, 0, false};
+    used += size;
+    return count++;
+  }
+
+  /* Register an int32 value, stored with putInt so existing keys keep working */
+  int8_t addInt(const char *key, int32_t *value, uint32_t delay)
+  {
+    int8_t slot = add(key, value, sizeof(int32_t), delay);
+    if (slot >= 0)
+      slots[slot].isInt = true;
+    return slot;
+  }
+
+  /* Read the slot back from NVS, leaves the memory untouched if missing */
+  bool load(int8_t slot)
+  {
+    if (slot < 0 || slot >= count)
+      return false;
+    Slot &s = slots[slot];
+    bool found;
+    if (s.isInt)
+    {
+      found = backend.isKey(s.key);
+      *(int32_t *)s.data = backend.getInt(s.key, *(int32_t *)s.data);
+    }
+    else
+    {
+      found = backend.getBytesLength(s.key) == s.size &&
+              backend.getBytes(s.key, s.data, s.size) == s.size;
+    }
+    if (found)
+      memcpy(shadow + s.offset, s.data, s.size);
+    return found;
+  }
+
+  /* The slot's memory changed, take a snapshot of it */
+  void touch(int8_t slot, uint32_t now)
+  {
+    if (slot < 0 || slot >= count)
+      return;
+    Slot &s = slots[slot];
+    if (!(dirty & (1UL << slot)))
+    {
+      if (memcmp(shadow + s.offset, s.data, s.size) == 0)
+        return;
+      dirty |= 1UL << slot;
+      s.since = now;
+    }
+    memcpy(shadow + s.offset, s.data, s.size);
+  }
+
+  bool pending() const
+  {
+    return dirty != 0;
+  }
+
+  /**
+   * Move the slots that are due into `stage`
+   *
+   * @param now    Current time in ms
+   * @param force  Take every dirty slot regardless of its delay
+   * @return       True if there is something to commit
+   */
+  bool collect(uint32_t now, bool force, Stage &stage)
+  {
+    stage.mask = 0;
+    for (uint8_t i = 0; i < count; i++)
+    {
+      Slot &s = slots[i];
+      if (!(dirty & (1UL << i)))
+        continue;
+      if (!force && (uint32_t)(now - s.since) < s.delay)
+        continue;
+      memcpy(stage.data + s.offset, shadow + s.offset, s.size);
+      stage.mask |= 1UL << i;
+    }
+    dirty &= ~stage.mask;
+    return stage.mask != 0;
+  }
+
+  /* Write a collected stage to NVS */
+  void commit(const Stage &stage)
+  {
+    for (uint8_t i = 0; i < count; i++)
+    {
+      if (!(stage.mask & (1UL << i)))
+        continue;
+      const Slot &s = slots[i];
+      if (s.isInt)
+      {
+        int32_t value;
+        memcpy(&value, stage.data + s.offset, sizeof(value));
+        backend.putInt(s.key, value);
+      }
+      else
+        backend.putBytes(s.key, stage.data + s.offset, s.size);
+      writes++;
+    }
+  }
+
+  /* Write every dirty slot now, for single threaded use */
+  void flush(uint32_t now)
+  {
+    Stage stage;
+    if (collect(now, true, stage))
+      commit(stage);
+  }
+
+  /* Number of NVS writes issued so far */
+  uint32_t writeCount() const
+  {
+    return writes;
+  }
+
+private:
+  struct Slot
+  {
+    const char *key;
+    void *data;
+    size_t size;
+    size_t offset; // into shadow/stage
+    uint32_t delay;
+    uint32_t since; // first unsaved change
+    bool isInt;
+  };
+
+  Backend &backend;
+  Slot slots[N];
+  uint8_t count = 0;
+  size_t used = 0;
+  uint32_t dirty = 0;
+  uint32_t writes = 0;
+  uint8_t shadow[S] = {};
+};
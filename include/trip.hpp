@@ -0,0 +1,156 @@
+#pragma once
+#include <stdint.h>
+#include <string.h>
+
+enum Trip : uint8_t
+{
+  TRIP_A,
+  TRIP_B,
+  TRIP_TOTAL, // lifetime, never reset from the UI
+  TRIP_COUNT
+};
+
+/* Doubles: a float lifetime total stops growing by one sample's worth past ~8000 L */
+struct TripTotals
+{
+  double distance; // km
+  double fuel;     // L
+};
+
+/* TripTotals as saved by firmware before they were doubles */
+struct TripTotalsFloat
+{
+  float distance;
+  float fuel;
+};
+
+/**
+ * Trip computer
+ *
+ * Integrates speed into distance and fuel flow (MAF) or fuel level drops
+ * into litres used, using the timestamp of every sample rather than the
+ * nominal poll interval. Gaps longer than `maxGap` (adapter stalled,
+ * reconnecting) are not integrated.
+ */
+class TripComputer
+{
+public:
+  TripComputer(float afr, float density, uint32_t maxGap = 5000)
+      : afr(afr), density(density), maxGap(maxGap)
+  {
+    memset(totals, 0, sizeof(totals));
+  }
+
+  void addSpeed(float kmh, uint32_t t)
+  {
+    if (speedTime && (uint32_t)(t - speedTime) <= maxGap)
+    {
+      float hours = (uint32_t)(t - speedTime) / 3600000.0f;
+      add(((lastSpeed + kmh) / 2) * hours, 0);
+    }
+    lastSpeed = kmh;
+    speedTime = t ? t : 1;
+  }
+
+  /* Fuel flow from the MAF reading in g/s */
+  void addMaf(float maf, uint32_t t)
+  {
+    if (mafTime && (uint32_t)(t - mafTime) <= maxGap)
+    {
+      float seconds = (uint32_t)(t - mafTime) / 1000.0f;
+      add(0, ((lastMaf + maf) / 2) * seconds / (afr * density));
+    }
+    lastMaf = maf;
+    mafTime = t ? t : 1;
+  }
+
+  /* Filtered tank level in litres, only used while no MAF is available */
+  void addLevel(float litres, uint32_t t)
+  {
+    bool maf = mafTime && (uint32_t)(t - mafTime) <= maxGap;
+    if (!maf && levelTime && litres < lastLevel)
+    {
+      add(0, lastLevel - litres);
+    }
+    // a rise is a refuel (or slosh the filter let through), just rebase
+    lastLevel = litres;
+    levelTime = t ? t : 1;
+  }
+
+  void reset(Trip trip)
+  {
+    totals[trip].distance = 0;
+    totals[trip].fuel = 0;
+    changed = true;
+  }
+
+  const TripTotals &get(Trip trip) const
+  {
+    return totals[trip];
+  }
+
+  /* Average consumption in L/100km, 0 until there is some distance */
+  float economy(Trip trip) const
+  {
+    if (totals[trip].distance < 0.1)
+      return 0;
+    return (float)(totals[trip].fuel * 100.0 / totals[trip].distance);
+  }
+
+  /* Raw storage for persistence */
+  TripTotals *data()
+  {
+    return totals;
+  }
+
+  /* Take over totals saved in the float layout */
+  void restore(const TripTotalsFloat (&old)[TRIP_COUNT])
+  {
+    for (uint8_t i = 0; i < TRIP_COUNT; i++)
+    {
+      totals[i].distance = old[i].distance;
+      totals[i].fuel = old[i].fuel;
+    }
+    changed = true;
+  }
+
+  static size_t size()
+  {
+    return sizeof(TripTotals) * TRIP_COUNT;
+  }
+
+  /* True once since the last call if any total moved */
+  bool consumeChanged()
+  {
+    bool c = changed;
+    changed = false;
+    return c;
+  }
+
+private:
+  float afr;
+  float density;
+  uint32_t maxGap;
+
+  TripTotals totals[TRIP_COUNT];
+  bool changed = false;
+
+  float lastSpeed = 0;
+  uint32_t speedTime = 0;
+  float lastMaf = 0;
+  uint32_t mafTime = 0;
+  float lastLevel = 0;
+  uint32_t levelTime = 0;
+
+  void add(float distance, float fuel)
+  {
+    if (distance <= 0 && fuel <= 0)
+      return;
+    for (uint8_t i = 0; i < TRIP_COUNT; i++)
+    {
+      totals[i].distance += distance;
+      totals[i].fuel += fuel;
+    }
+    changed = true;
+  }
+};
@@ -2,6 +2,7 @@ list(
   APPEND
   PROJECT_SOURCES
   ${CMAKE_CURRENT_LIST_DIR}/components/settings_item/settings_item_gen.c
+  ${CMAKE_CURRENT_LIST_DIR}/fonts/glyph_cache.c
   ${CMAKE_CURRENT_LIST_DIR}/fonts/roboto_bold_40_data.c
   ${CMAKE_CURRENT_LIST_DIR}/fonts/roboto_bold_150_data.c
   ${CMAKE_CURRENT_LIST_DIR}/fonts/roboto_regular_24_data.c
@@ -10,6 +11,7 @@ list(
   ${CMAKE_CURRENT_LIST_DIR}/images/back_data.c
   ${CMAKE_CURRENT_LIST_DIR}/images/brightness_data.c
   ${CMAKE_CURRENT_LIST_DIR}/images/disconnect_data.c
+  ${CMAKE_CURRENT_LIST_DIR}/images/fuel_data.c
   ${CMAKE_CURRENT_LIST_DIR}/images/hud_data.c
   ${CMAKE_CURRENT_LIST_DIR}/images/restart_data.c
   ${CMAKE_CURRENT_LIST_DIR}/images/rotation_data.c
@@ -17,4 +19,9 @@ list(
   ${CMAKE_CURRENT_LIST_DIR}/images/warning_data.c
   ${CMAKE_CURRENT_LIST_DIR}/screens/boot_gen.c
   ${CMAKE_CURRENT_LIST_DIR}/screens/dashboard_gen.c
-  ${CMAKE_CURRENT_LIST_DIR}/screens/settings_gen.c)
\ No newline at end of file
+  ${CMAKE_CURRENT_LIST_DIR}/screens/settings_gen.c
+  ${CMAKE_CURRENT_LIST_DIR}/screens/trip_gen.c
+  ${CMAKE_CURRENT_LIST_DIR}/widgets/digit_sprite/digit_sprite.c
+  ${CMAKE_CURRENT_LIST_DIR}/widgets/digit_sprite/digit_sprite_xml_parser.c
+  ${CMAKE_CURRENT_LIST_DIR}/widgets/arc_gauge/arc_gauge.c
+  ${CMAKE_CURRENT_LIST_DIR}/widgets/arc_gauge/arc_gauge_xml_parser.c)
\ No newline at end of file
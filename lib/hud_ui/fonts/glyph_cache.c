@@ -0,0 +1,197 @@
+/**
+ * @file glyph_cache.c
+ *
+ * A small LRU of A8 glyph bitmaps keyed by font and glyph id. Decoding an RLE
+ * glyph walks a bit level state machine for every pixel, copying it back is
+ * a memcpy per row. Glyphs larger than GLYPH_CACHE_MAX_GLYPH are decoded
+ * every time, the speed digits have their own sprites.
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "glyph_cache.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+#define GLYPH_CACHE_SLOTS 64
+
+/*Bytes of the largest glyph kept, a 40 px digit is ~600*/
+#define GLYPH_CACHE_MAX_GLYPH 2048
+
+#define GLYPH_CACHE_DEFAULT_LIMIT (16 * 1024)
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef struct {
+    const lv_font_t * font;
+    uint32_t gid;
+    uint16_t w;
+    uint16_t h;
+    uint32_t used;      /*Stamp of the last hit*/
+    uint8_t * data;     /*A8, `w` bytes per row, NULL if the slot is free*/
+} glyph_entry_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+static glyph_entry_t * entry_find(const lv_font_t * font, uint32_t gid);
+static void entry_store(const lv_font_t * font, uint32_t gid, uint16_t w, uint16_t h,
+                        const lv_draw_buf_t * draw_buf);
+static void entry_free(glyph_entry_t * e);
+static void copy_rows(uint8_t * dst, uint32_t dst_stride, const uint8_t * src, uint32_t src_stride,
+                      uint32_t w, uint32_t h);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+static glyph_entry_t entries[GLYPH_CACHE_SLOTS];
+static size_t cache_limit = GLYPH_CACHE_DEFAULT_LIMIT;
+static size_t cache_bytes;
+static uint32_t stamp;
+static uint32_t hits;
+static uint32_t misses;
+
+/*Glyphs are fetched by the draw units, there may be more than one*/
+static lv_mutex_t lock;
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void glyph_cache_init(void)
+{
+    lv_mutex_init(&lock);
+}
+
+const void * glyph_cache_get_bitmap(lv_font_glyph_dsc_t * g_dsc, lv_draw_buf_t * draw_buf)
+{
+    const lv_font_t * font = g_dsc->resolved_font;
+    uint32_t gid = g_dsc->gid.index;
+    uint32_t size = (uint32_t)g_dsc->box_w * g_dsc->box_h;
+
+    if(g_dsc->req_raw_bitmap || draw_buf == NULL || size == 0 || size > GLYPH_CACHE_MAX_GLYPH ||
+       size > cache_limit) {
+        return lv_font_get_bitmap_fmt_txt(g_dsc, draw_buf);
+    }
+
+    lv_mutex_lock(&lock);
+    glyph_entry_t * e = entry_find(font, gid);
+    if(e) {
+        e->used = ++stamp;
+        hits++;
+        copy_rows(draw_buf->data, draw_buf->header.stride, e->data, e->w, e->w, e->h);
+        lv_mutex_unlock(&lock);
+        return draw_buf;
+    }
+    misses++;
+    lv_mutex_unlock(&lock);
+
+    const void * bitmap = lv_font_get_bitmap_fmt_txt(g_dsc, draw_buf);
+    if(bitmap != draw_buf) return bitmap;
+
+    lv_mutex_lock(&lock);
+    if(entry_find(font, gid) == NULL) entry_store(font, gid, g_dsc->box_w, g_dsc->box_h, draw_buf);
+    lv_mutex_unlock(&lock);
+    return draw_buf;
+}
+
+void glyph_cache_set_limit(size_t bytes)
+{
+    lv_mutex_lock(&lock);
+    cache_limit = bytes;
+    for(uint32_t i = 0; i < GLYPH_CACHE_SLOTS && cache_bytes > cache_limit; i++) {
+        entry_free(&entries[i]);
+    }
+    lv_mutex_unlock(&lock);
+}
+
+size_t glyph_cache_get_size(void)
+{
+    return cache_bytes;
+}
+
+void glyph_cache_take_stats(uint32_t * hits_out, uint32_t * misses_out)
+{
+    lv_mutex_lock(&lock);
+    *hits_out = hits;
+    *misses_out = misses;
+    hits = 0;
+    misses = 0;
+    lv_mutex_unlock(&lock);
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static glyph_entry_t * entry_find(const lv_font_t * font, uint32_t gid)
+{
+    for(uint32_t i = 0; i < GLYPH_CACHE_SLOTS; i++) {
+        glyph_entry_t * e = &entries[i];
+        if(e->data && e->font == font && e->gid == gid) return e;
+    }
+    return NULL;
+}
+
+static void entry_store(const lv_font_t * font, uint32_t gid, uint16_t w, uint16_t h,
+                        const lv_draw_buf_t * draw_buf)
+{
+    size_t size = (size_t)w * h;
+
+    /*Evict the least recently used until there is a free slot and room*/
+    while(true) {
+        glyph_entry_t * free_slot = NULL;
+        glyph_entry_t * oldest = NULL;
+        for(uint32_t i = 0; i < GLYPH_CACHE_SLOTS; i++) {
+            glyph_entry_t * e = &entries[i];
+            if(e->data == NULL) {
+                if(free_slot == NULL) free_slot = e;
+            }
+            else if(oldest == NULL || e->used < oldest->used) {
+                oldest = e;
+            }
+        }
+        if(free_slot && cache_bytes + size <= cache_limit) {
+            free_slot->data = lv_malloc(size);
+            if(free_slot->data == NULL) return;
+            free_slot->font = font;
+            free_slot->gid = gid;
+            free_slot->w = w;
+            free_slot->h = h;
+            free_slot->used = ++stamp;
+            copy_rows(free_slot->data, w, draw_buf->data, draw_buf->header.stride, w, h);
+            cache_bytes += size;
+            return;
+        }
+        if(oldest == NULL) return;
+        entry_free(oldest);
+    }
+}
+
+static void entry_free(glyph_entry_t * e)
+{
+    if(e->data == NULL) return;
+    cache_bytes -= (size_t)e->w * e->h;
+    lv_free(e->data);
+    e->data = NULL;
+}
+
+static void copy_rows(uint8_t * dst, uint32_t dst_stride, const uint8_t * src, uint32_t src_stride,
+                      uint32_t w, uint32_t h)
+{
+    if(dst_stride == w && src_stride == w) {
+        lv_memcpy(dst, src, w * h);
+        return;
+    }
+    for(uint32_t y = 0; y < h; y++) {
+        lv_memcpy(dst + y * dst_stride, src + y * src_stride, w);
+    }
+}
@@ -0,0 +1,66 @@
+/**
+ * @file glyph_cache.h
+ *
+ * Keeps decoded glyphs of the compressed fonts, written by
+ * tools/font_subset.py --compress as their `get_glyph_bitmap`.
+ */
+
+#ifndef GLYPH_CACHE_H
+#define GLYPH_CACHE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#ifdef LV_LVGL_H_INCLUDE_SIMPLE
+#include "lvgl.h"
+#else
+#include "lvgl/lvgl.h"
+#endif
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Create the lock shared by the draw threads, after `lv_init` and before
+ * the first glyph is drawn
+ */
+void glyph_cache_init(void);
+
+/**
+ * Same as `lv_font_get_bitmap_fmt_txt` but a glyph is only decompressed the
+ * first time, later it's copied from the cache
+ * @param g_dsc     the glyph to get, as returned by `get_glyph_dsc`
+ * @param draw_buf  where to put the A8 bitmap
+ * @return          `draw_buf` or the raw bitmap if requested
+ */
+const void * glyph_cache_get_bitmap(lv_font_glyph_dsc_t * g_dsc, lv_draw_buf_t * draw_buf);
+
+/**
+ * Limit the memory of the decoded glyphs, 0 to decode every time
+ * @param bytes     budget shared by all the cached fonts
+ */
+void glyph_cache_set_limit(size_t bytes);
+
+/**
+ * @return          bytes taken by the decoded glyphs
+ */
+size_t glyph_cache_get_size(void);
+
+/**
+ * Get and reset the lookup counters
+ * @param hits      set to the glyphs copied from the cache
+ * @param misses    set to the glyphs decoded
+ */
+void glyph_cache_take_stats(uint32_t * hits, uint32_t * misses);
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*GLYPH_CACHE_H*/
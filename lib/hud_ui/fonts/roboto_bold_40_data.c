@@ -1,6 +1,7 @@
 /*******************************************************************************
  * Size: 40 px
  * Bpp: 4
+ * Subset: tools/font_subset.py --compress " -0123456789CL°"
  * Opts: --font /fonts/Roboto-Bold.ttf -o /fonts/roboto_bold_40_data.c --no-compress --size 40 --bpp 4 --format lvgl --symbols ° --range 0x20-0x7F
  ******************************************************************************/
 
@@ -9,6 +10,7 @@
 #else
 #include "lvgl/lvgl.h"
 #endif
+#include "glyph_cache.h"
 
 #ifndef ROBOTO_BOLD_40_DATA
 #define ROBOTO_BOLD_40_DATA 1
@@ -24,3265 +26,292 @@
 static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
     /* U+0020 " " */
 
-    /* U+0021 "!" */
-    0x7f, 0xff, 0xff, 0x86, 0xff, 0xff, 0xf7, 0x6f,
-    0xff, 0xff, 0x75, 0xff, 0xff, 0xf6, 0x4f, 0xff,
-    0xff, 0x64, 0xff, 0xff, 0xf5, 0x3f, 0xff, 0xff,
-    0x53, 0xff, 0xff, 0xf4, 0x2f, 0xff, 0xff, 0x42,
-    0xff, 0xff, 0xf3, 0x1f, 0xff, 0xff, 0x31, 0xff,
-    0xff, 0xf2, 0xf, 0xff, 0xff, 0x20, 0xff, 0xff,
-    0xf1, 0xf, 0xff, 0xff, 0x10, 0xff, 0xff, 0xf0,
-    0xe, 0xff, 0xff, 0x0, 0xef, 0xff, 0xf0, 0xd,
-    0xff, 0xff, 0x0, 0xdf, 0xff, 0xe0, 0x2, 0x33,
-    0x32, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4c, 0xec, 0x50, 0x2f, 0xff, 0xff, 0x48,
-    0xff, 0xff, 0xfa, 0x8f, 0xff, 0xff, 0xa3, 0xff,
-    0xff, 0xf5, 0x5, 0xdf, 0xd6, 0x0,
-
-    /* U+0022 "\"" */
-    0xcf, 0xff, 0x20, 0x7f, 0xff, 0x7c, 0xff, 0xf2,
-    0x7, 0xff, 0xf7, 0xcf, 0xff, 0x20, 0x7f, 0xff,
-    0x7c, 0xff, 0xf1, 0x7, 0xff, 0xf6, 0xcf, 0xff,
-    0x0, 0x7f, 0xff, 0x5c, 0xff, 0xe0, 0x7, 0xff,
-    0xf3, 0xcf, 0xfc, 0x0, 0x7f, 0xff, 0x2c, 0xff,
-    0xb0, 0x7, 0xff, 0xf0, 0xcf, 0xf9, 0x0, 0x7f,
-    0xff, 0xc, 0xff, 0x80, 0x7, 0xff, 0xd0, 0xad,
-    0xd5, 0x0, 0x6d, 0xda, 0x0,
-
-    /* U+0023 "#" */
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xf9, 0x0, 0x9,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xf7, 0x0, 0xc, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xf4, 0x0, 0xe, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf1, 0x0,
-    0x1f, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0xe0, 0x0, 0x4f, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xc0, 0x0, 0x7f, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0x90,
-    0x0, 0x9f, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0x60, 0x0, 0xcf, 0xfc, 0x0, 0x0,
-    0x6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x6, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x2, 0x66, 0x66, 0xef, 0xfd, 0x66, 0x6b,
-    0xff, 0xf6, 0x66, 0x65, 0x0, 0x0, 0x0, 0xff,
-    0xf9, 0x0, 0xa, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xf6, 0x0, 0xd, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xf3, 0x0,
-    0xf, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xf0, 0x0, 0x2f, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xff, 0xe0, 0x0, 0x5f, 0xff,
-    0x30, 0x0, 0x0, 0x45, 0x55, 0x5e, 0xff, 0xd5,
-    0x55, 0xaf, 0xff, 0x65, 0x55, 0x20, 0xdf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x70, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x70, 0xdf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x0,
-    0x0, 0x8f, 0xff, 0x0, 0x2, 0xff, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xfd, 0x0, 0x5,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0xfa, 0x0, 0x8, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xf8, 0x0, 0xb, 0xff, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xf5, 0x0,
-    0xd, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0xf2, 0x0, 0xf, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0xf0, 0x0, 0x3f, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xd0,
-    0x0, 0x6f, 0xff, 0x20, 0x0, 0x0, 0x0,
-
-    /* U+0024 "$" */
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0x8c, 0xff, 0xff, 0xb7, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x1a, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0x2e, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xa0, 0x0, 0x0, 0xd, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0x96, 0x7c, 0xff, 0xff, 0xff,
-    0x20, 0x0, 0xdf, 0xff, 0xff, 0x40, 0x0, 0x9,
-    0xff, 0xff, 0xf8, 0x0, 0xf, 0xff, 0xff, 0xb0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xc0, 0x2, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff,
-    0x0, 0x1f, 0xff, 0xff, 0x80, 0x0, 0x0, 0x8,
-    0xff, 0xff, 0xf1, 0x0, 0xff, 0xff, 0xfd, 0x0,
-    0x0, 0x0, 0x12, 0x22, 0x22, 0x0, 0xc, 0xff,
-    0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xff, 0xff, 0xfc, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xff,
-    0xd6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xff, 0xff, 0xff, 0xff, 0x81, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xe6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x18, 0xef, 0xff,
-    0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6c, 0xff, 0xff, 0xff, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xbf, 0xff, 0xff,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xff, 0xff, 0xb0, 0x3, 0x33, 0x33, 0x10,
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0x2, 0xff,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff,
-    0xf1, 0x1f, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0x8f, 0xff, 0xff, 0x10, 0xef, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xf0, 0x9, 0xff,
-    0xff, 0xfb, 0x0, 0x0, 0x6, 0xff, 0xff, 0xfc,
-    0x0, 0x2f, 0xff, 0xff, 0xfe, 0x96, 0x7b, 0xff,
-    0xff, 0xff, 0x60, 0x0, 0x8f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x9f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd1, 0x0,
-    0x0, 0x0, 0x5e, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xa1, 0x0, 0x0, 0x0, 0x0, 0x4, 0x9c, 0xff,
-    0xfe, 0xb7, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xf5, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0025 "%" */
-    0x0, 0x2, 0x9d, 0xff, 0xd9, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xff, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xff, 0xb4, 0x4b, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0xb4, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xe0, 0x0, 0xd, 0xff, 0xf1, 0x0, 0x0, 0x9f,
-    0xfb, 0x0, 0x0, 0x1, 0xff, 0xfa, 0x0, 0x0,
-    0x9f, 0xff, 0x30, 0x0, 0x3f, 0xff, 0x60, 0x0,
-    0x0, 0x2f, 0xff, 0x90, 0x0, 0x8, 0xff, 0xf3,
-    0x0, 0xd, 0xff, 0xc0, 0x0, 0x0, 0x1, 0xff,
-    0xfa, 0x0, 0x0, 0x9f, 0xff, 0x30, 0x8, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0xf, 0xff, 0xe0, 0x0,
-    0xd, 0xff, 0xf1, 0x2, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xff, 0xb4, 0x4b, 0xff, 0xfc,
-    0x0, 0xcf, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0x6f, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff,
-    0xff, 0xff, 0x60, 0x1f, 0xff, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0x9d, 0xff, 0xea, 0x20,
-    0xa, 0xff, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0x10, 0x0, 0x23, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x70,
-    0x8, 0xef, 0xff, 0xfb, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xff, 0xc0, 0x1d, 0xff, 0xff,
-    0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xf3, 0xb, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x10, 0x0, 0x0, 0x0, 0x2, 0xff, 0xf8, 0x2,
-    0xff, 0xff, 0x40, 0x2c, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xfd, 0x0, 0x6f, 0xff, 0x70,
-    0x0, 0x2f, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0x40, 0x8, 0xff, 0xf3, 0x0, 0x0, 0xef,
-    0xfd, 0x0, 0x0, 0x0, 0x1e, 0xff, 0xa0, 0x0,
-    0x8f, 0xff, 0x30, 0x0, 0xe, 0xff, 0xd0, 0x0,
-    0x0, 0xa, 0xff, 0xe1, 0x0, 0x8, 0xff, 0xf4,
-    0x0, 0x0, 0xef, 0xfc, 0x0, 0x0, 0x4, 0xff,
-    0xf5, 0x0, 0x0, 0x6f, 0xff, 0x90, 0x0, 0x2f,
-    0xff, 0xa0, 0x0, 0x0, 0x18, 0xfb, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0x94, 0x5d, 0xff, 0xf6, 0x0,
-    0x0, 0x0, 0x1, 0x10, 0x0, 0x0, 0x8, 0xff,
-    0xff, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xff,
-    0xfd, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xbe, 0xff, 0xc7, 0x0, 0x0,
-
-    /* U+0026 "&" */
-    0x0, 0x0, 0x0, 0x17, 0xce, 0xff, 0xc8, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0xff, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xfb, 0x8a,
-    0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xff, 0xf7, 0x0, 0x5, 0xff, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0x0,
-    0x0, 0xe, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0xe0, 0x0, 0x0, 0xef, 0xff,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0x10, 0x0, 0x3f, 0xff, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0xf7, 0x0, 0x2e, 0xff,
-    0xfe, 0x10, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xf2, 0x7f, 0xff, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0xff, 0xff, 0xfe, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff,
-    0xfb, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0xff, 0xff, 0x60, 0x0, 0x0,
-    0x12, 0x22, 0x20, 0x0, 0x0, 0xbf, 0xff, 0xff,
-    0xff, 0xff, 0x40, 0x0, 0xb, 0xff, 0xff, 0x10,
-    0x0, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x20,
-    0x0, 0xcf, 0xff, 0xf0, 0x0, 0x9f, 0xff, 0xff,
-    0x57, 0xff, 0xff, 0xfe, 0x10, 0xf, 0xff, 0xfe,
-    0x0, 0x2f, 0xff, 0xff, 0x90, 0x9, 0xff, 0xff,
-    0xfc, 0x4, 0xff, 0xff, 0xc0, 0x6, 0xff, 0xff,
-    0xf3, 0x0, 0xb, 0xff, 0xff, 0xfa, 0xbf, 0xff,
-    0xf8, 0x0, 0x9f, 0xff, 0xff, 0x0, 0x0, 0xd,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x30, 0x9, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x1e, 0xff, 0xff, 0xff,
-    0xff, 0xd0, 0x0, 0x7f, 0xff, 0xff, 0x70, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xff, 0xf4, 0x0, 0x3,
-    0xff, 0xff, 0xff, 0x40, 0x0, 0x0, 0xaf, 0xff,
-    0xff, 0xfa, 0x0, 0x0, 0xd, 0xff, 0xff, 0xff,
-    0xc8, 0x8b, 0xff, 0xff, 0xff, 0xff, 0xd1, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x6f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xa0, 0x0, 0x0, 0x3d, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xb3, 0xdf, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x4, 0xad, 0xff, 0xfe, 0xb7, 0x20, 0x1, 0xef,
-    0xff, 0xff, 0x50,
-
-    /* U+0027 "'" */
-    0xcf, 0xff, 0x5c, 0xff, 0xf5, 0xcf, 0xff, 0x5c,
-    0xff, 0xf5, 0xcf, 0xff, 0x3c, 0xff, 0xf2, 0xcf,
-    0xff, 0x1c, 0xff, 0xf0, 0xcf, 0xff, 0xc, 0xff,
-    0xe0, 0xad, 0xdb, 0x0,
-
-    /* U+0028 "(" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5e, 0x60, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xf1,
-    0x0, 0x0, 0x6, 0xff, 0xff, 0x50, 0x0, 0x0,
-    0x2f, 0xff, 0xf7, 0x0, 0x0, 0x0, 0xcf, 0xff,
-    0xb0, 0x0, 0x0, 0x5, 0xff, 0xff, 0x20, 0x0,
-    0x0, 0xd, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x5f,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xc0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0x60, 0x0, 0x0,
-    0x6, 0xff, 0xff, 0x20, 0x0, 0x0, 0xa, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0xe, 0xff, 0xfb, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0xf4, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xf3, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0xf3, 0x0, 0x0, 0x0,
-    0x8f, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x9f, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xf2, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0xf3, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x5f, 0xff,
-    0xf5, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xf6, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xf9, 0x0, 0x0, 0x0,
-    0xd, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x9, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0xaf, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0xf3, 0x0, 0x0, 0x0, 0xc, 0xff, 0xfa,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0xaf, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x1e, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x2c, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+0029 ")" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xe5,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xf9, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xf3, 0x0, 0x0, 0x0, 0xb, 0xff, 0xfd,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0xaf, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xf8, 0x0, 0x0, 0x0, 0xc, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0x40,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0x90, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0xbf,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x5f, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xfd,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xfd, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0xfb, 0x0, 0x0,
-    0x0, 0x5f, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0xcf, 0xff, 0xf1, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x7, 0xff, 0xff, 0x30,
-    0x0, 0x0, 0xd, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xf6, 0x0, 0x0, 0x0, 0xaf, 0xff,
-    0xe0, 0x0, 0x0, 0x3, 0xff, 0xff, 0x60, 0x0,
-    0x0, 0xc, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0xf2, 0x0, 0x0, 0x7, 0xff, 0xff, 0x50,
-    0x0, 0x0, 0x1f, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0x60, 0x0, 0x0, 0x0, 0x5, 0xc2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+002A "*" */
-    0x0, 0x0, 0x0, 0x8, 0xff, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x2, 0x20, 0x0, 0x5,
-    0xff, 0xf0, 0x0, 0x0, 0x20, 0xa, 0xfc, 0x50,
-    0x4, 0xff, 0xe0, 0x0, 0x6d, 0xf1, 0xf, 0xff,
-    0xfe, 0x86, 0xff, 0xd2, 0x9f, 0xff, 0xf6, 0x4f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb,
-    0x4, 0x9d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0xa5, 0x0, 0x0, 0x27, 0xcf, 0xff, 0xff, 0xc8,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xfe,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0x96, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xfe, 0x10, 0xcf, 0xff, 0x50, 0x0, 0x0, 0x1e,
-    0xff, 0xf5, 0x0, 0x3f, 0xff, 0xf2, 0x0, 0x0,
-    0x3e, 0xff, 0xb0, 0x0, 0x9, 0xff, 0xf6, 0x0,
-    0x0, 0x1, 0xaf, 0x20, 0x0, 0x0, 0xee, 0x40,
-    0x0, 0x0, 0x0, 0x2, 0x0, 0x0, 0x0, 0x31,
-    0x0, 0x0,
-
-    /* U+002B "+" */
-    0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf9, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf9, 0xef, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xef, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9,
-    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf9, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0x88, 0x88,
-    0x40, 0x0, 0x0, 0x0,
-
-    /* U+002C "," */
-    0x0, 0x3f, 0xff, 0xf8, 0x0, 0x3f, 0xff, 0xf8,
-    0x0, 0x3f, 0xff, 0xf8, 0x0, 0x3f, 0xff, 0xf8,
-    0x0, 0x3f, 0xff, 0xf7, 0x0, 0x4f, 0xff, 0xf5,
-    0x0, 0x7f, 0xff, 0xf1, 0x0, 0xdf, 0xff, 0xc0,
-    0x3, 0xff, 0xff, 0x50, 0xb, 0xff, 0xfc, 0x0,
-    0x1d, 0xff, 0xe2, 0x0, 0x0, 0x6d, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0,
-
     /* U+002D "-" */
-    0x68, 0x88, 0x88, 0x88, 0x88, 0x82, 0xcf, 0xff,
-    0xff, 0xff, 0xff, 0xf4, 0xcf, 0xff, 0xff, 0xff,
-    0xff, 0xf4, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xf4,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xf4,
-
-    /* U+002E "." */
-    0x4, 0xcf, 0xe7, 0x2, 0xff, 0xff, 0xf6, 0x7f,
-    0xff, 0xff, 0xc7, 0xff, 0xff, 0xfc, 0x2f, 0xff,
-    0xff, 0x60, 0x4d, 0xfe, 0x70,
-
-    /* U+002F "/" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x18, 0x88, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x68, 0x8f, 0xf1, 0x53, 0xbf, 0xf9, 0x80, 0x3f,
+    0xfb, 0x0,
 
     /* U+0030 "0" */
-    0x0, 0x0, 0x0, 0x49, 0xdf, 0xff, 0xd9, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xcf, 0xff, 0xff,
-    0xff, 0xff, 0xc2, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 0x0, 0x0,
-    0x1, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xe1, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xf9, 0x8a,
-    0xff, 0xff, 0xff, 0x90, 0x0, 0x1f, 0xff, 0xff,
-    0xd1, 0x0, 0x2, 0xef, 0xff, 0xff, 0x10, 0x6,
-    0xff, 0xff, 0xf4, 0x0, 0x0, 0x5, 0xff, 0xff,
-    0xf6, 0x0, 0xaf, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xa0, 0xe, 0xff, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0xbf, 0xff, 0xfd, 0x0, 0xff,
-    0xff, 0xf9, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff,
-    0xf0, 0x1f, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0xff, 0x2, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0xff, 0xf1, 0x2f, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff,
-    0x12, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xff, 0xf1, 0x2f, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0xff, 0x12, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xf1,
-    0x2f, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x8f,
-    0xff, 0xff, 0x12, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0xff, 0xf1, 0x1f, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0x0,
-    0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0xa, 0xff,
-    0xff, 0xf0, 0xd, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0xfd, 0x0, 0xaf, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xa0, 0x6,
-    0xff, 0xff, 0xf5, 0x0, 0x0, 0x5, 0xff, 0xff,
-    0xf5, 0x0, 0x1f, 0xff, 0xff, 0xe1, 0x0, 0x2,
-    0xef, 0xff, 0xff, 0x0, 0x0, 0x9f, 0xff, 0xff,
-    0xfa, 0x8a, 0xff, 0xff, 0xff, 0x80, 0x0, 0x1,
-    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0,
-    0x0, 0x0, 0x2, 0xef, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xe2, 0x0, 0x0, 0x0, 0x2, 0xcf, 0xff,
-    0xff, 0xff, 0xff, 0xc2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x49, 0xdf, 0xff, 0xd9, 0x40, 0x0, 0x0,
-    0x0,
+    0x0, 0xf2, 0x4e, 0xff, 0xdb, 0x28, 0x1, 0xfe,
+    0x2c, 0xb6, 0x20, 0x8, 0x9a, 0xf0, 0x80, 0x3e,
+    0x3d, 0x30, 0xf, 0xe3, 0xc3, 0x0, 0xe1, 0xd0,
+    0xf, 0xfc, 0x3a, 0x20, 0x1a, 0x4, 0x3, 0x99,
+    0xd4, 0x3, 0x86, 0x0, 0x21, 0x60, 0xc, 0x5d,
+    0x31, 0x5a, 0x20, 0x19, 0x84, 0x0, 0xe0, 0x1d,
+    0x22, 0x1, 0x15, 0x80, 0x73, 0x80, 0x30, 0x3,
+    0xa, 0x0, 0x72, 0x80, 0x76, 0x0, 0x10, 0x3,
+    0x28, 0x7, 0xc8, 0x1, 0x9c, 0x0, 0x20, 0x18,
+    0x80, 0x3e, 0x20, 0xc, 0x40, 0x20, 0x1c, 0x20,
+    0x1f, 0xfc, 0x23, 0x0, 0xff, 0xe0, 0x88, 0x7,
+    0x8, 0x7, 0xff, 0xfc, 0x3, 0xff, 0xce, 0x60,
+    0x1f, 0xfc, 0x11, 0x0, 0xe1, 0x10, 0x7, 0x8,
+    0x7, 0xc6, 0x1, 0xf1, 0x0, 0x62, 0x0, 0xf9,
+    0x80, 0x31, 0x0, 0x1c, 0x3, 0x28, 0x7, 0xc6,
+    0x1, 0x9c, 0x1, 0x80, 0x18, 0x54, 0x3, 0x94,
+    0x3, 0xbc, 0x0, 0xe0, 0x1d, 0x62, 0x1, 0x15,
+    0x80, 0x72, 0x80, 0x5, 0x80, 0x30, 0xf5, 0x45,
+    0x68, 0x80, 0x67, 0x0, 0xd0, 0x20, 0x1c, 0xae,
+    0xa0, 0x1c, 0x50, 0x1, 0x87, 0x4, 0x3, 0xfe,
+    0x1f, 0x0, 0xf1, 0x61, 0x80, 0x7f, 0x1e, 0x10,
+    0x7, 0xc5, 0x96, 0xc4, 0x1, 0x13, 0x5e, 0x10,
+    0x6,
 
     /* U+0031 "1" */
-    0x0, 0x0, 0x0, 0x0, 0x1, 0x6c, 0xa0, 0x0,
-    0x0, 0x0, 0x5b, 0xff, 0xfa, 0x0, 0x0, 0x4a,
-    0xff, 0xff, 0xff, 0xa0, 0x28, 0xef, 0xff, 0xff,
-    0xff, 0xfa, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xab, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xbf,
-    0xff, 0xff, 0xcf, 0xff, 0xff, 0xab, 0xff, 0xb6,
-    0x10, 0xff, 0xff, 0xfa, 0x76, 0x10, 0x0, 0xf,
-    0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xfa, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xfa, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xfa,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xa0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xfa, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xfa, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xfa, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xfa, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xa0,
+    0x0, 0xfe, 0x16, 0xca, 0x0, 0xf9, 0x6f, 0xa4,
+    0xc0, 0x39, 0x2b, 0xe9, 0x0, 0x38, 0xa3, 0xad,
+    0x40, 0x3e, 0x9d, 0x71, 0x0, 0xfe, 0x20, 0xf,
+    0xfe, 0x31, 0x80, 0x7f, 0x24, 0xf6, 0x0, 0x7b,
+    0x27, 0xad, 0x84, 0x3, 0xe7, 0x61, 0x0, 0xff,
+    0xff, 0x80, 0x7f, 0xff, 0xc0, 0x3f, 0xff, 0xe0,
+    0x1f, 0xfd, 0x40,
 
     /* U+0032 "2" */
-    0x0, 0x0, 0x0, 0x6b, 0xef, 0xff, 0xda, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xef, 0xff, 0xff,
-    0xff, 0xff, 0xe5, 0x0, 0x0, 0x0, 0xa, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x0,
-    0x9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf4, 0x0, 0x4, 0xff, 0xff, 0xff, 0xd8, 0x8b,
-    0xff, 0xff, 0xff, 0xc0, 0x0, 0xcf, 0xff, 0xff,
-    0x70, 0x0, 0x4, 0xff, 0xff, 0xff, 0x20, 0x2f,
-    0xff, 0xff, 0xb0, 0x0, 0x0, 0x9, 0xff, 0xff,
-    0xf5, 0x6, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0x70, 0x9f, 0xff, 0xff, 0x10,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0xf7, 0x3, 0x66,
-    0x66, 0x60, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xef, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2e, 0xff, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1d, 0xff, 0xff, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1d, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xff, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
-    0xff, 0xfd, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0xff, 0xfe, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff,
-    0xb7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x30, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf6, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x60, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x60,
+    0x0, 0xf3, 0x5f, 0x7f, 0xdb, 0x4a, 0x1, 0xfe,
+    0x6e, 0x94, 0x10, 0x8, 0x96, 0xb9, 0x40, 0x3e,
+    0xa9, 0x10, 0xf, 0xe1, 0xa7, 0x0, 0xe9, 0x50,
+    0xf, 0xfe, 0xc, 0x20, 0x4, 0x8c, 0x1, 0xc4,
+    0xee, 0x40, 0xf, 0x40, 0x5, 0x0, 0x1d, 0x1b,
+    0x10, 0xbb, 0x0, 0x71, 0x90, 0x11, 0x80, 0x64,
+    0x70, 0xc, 0x8c, 0x1, 0xce, 0x8, 0x1, 0xde,
+    0x1, 0xed, 0x0, 0xe2, 0xf, 0x0, 0xe5, 0x0,
+    0xf3, 0x0, 0x7d, 0x53, 0x3c, 0x20, 0x1e, 0x10,
+    0xe, 0x20, 0x36, 0x6e, 0x0, 0xfa, 0xc0, 0x39,
+    0xc0, 0x3f, 0xf8, 0x22, 0xc0, 0x18, 0xc8, 0x3,
+    0xff, 0x83, 0x2, 0x1, 0xa4, 0x3, 0xff, 0x82,
+    0xac, 0x1, 0x91, 0x40, 0x3f, 0xf1, 0xd0, 0x7,
+    0x48, 0x7, 0xfe, 0x2d, 0x0, 0xea, 0x20, 0xf,
+    0xf8, 0x7c, 0x40, 0x34, 0x28, 0x7, 0xfc, 0x38,
+    0x40, 0x19, 0xdc, 0x1, 0xff, 0xb4, 0x80, 0x33,
+    0x40, 0x7, 0xfe, 0xb3, 0x0, 0xcb, 0x20, 0x1f,
+    0xfa, 0x90, 0x3, 0x1d, 0x0, 0x7f, 0xe9, 0x50,
+    0xc, 0x5a, 0x1, 0xff, 0xa1, 0x80, 0x30, 0xe0,
+    0x80, 0x7f, 0xce, 0xe0, 0xe, 0xc1, 0x0, 0xff,
+    0x9a, 0x0, 0x39, 0x15, 0xdf, 0xfc, 0x61, 0x20,
+    0x1e, 0x48, 0x8f, 0xf9, 0x40, 0x3f, 0xfe, 0x60,
 
     /* U+0033 "3" */
-    0x0, 0x0, 0x2, 0x7c, 0xef, 0xfe, 0xc9, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x1a, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xd4, 0x0, 0x0, 0x0, 0x3e, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x0,
-    0x1e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf5, 0x0, 0xa, 0xff, 0xff, 0xff, 0xc8, 0x8a,
-    0xff, 0xff, 0xff, 0xe0, 0x1, 0xff, 0xff, 0xff,
-    0x40, 0x0, 0x2, 0xef, 0xff, 0xff, 0x40, 0x4f,
-    0xff, 0xff, 0x70, 0x0, 0x0, 0x5, 0xff, 0xff,
-    0xf7, 0x3, 0xaa, 0xaa, 0xa2, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1d,
-    0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x1, 0x44,
-    0x45, 0x8e, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xff, 0xff,
-    0xb1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0xff, 0xff, 0xff, 0xb1, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x9f, 0xff,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
-    0xff, 0xf0, 0x45, 0x55, 0x55, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0xff, 0xb, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xf0, 0x9f,
-    0xff, 0xff, 0x50, 0x0, 0x0, 0x2, 0xff, 0xff,
-    0xfd, 0x4, 0xff, 0xff, 0xff, 0x40, 0x0, 0x1,
-    0xcf, 0xff, 0xff, 0x80, 0xd, 0xff, 0xff, 0xff,
-    0xc8, 0x8a, 0xff, 0xff, 0xff, 0xf1, 0x0, 0x3f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6,
-    0x0, 0x0, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x2b, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xc3, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0x8c, 0xef, 0xfe, 0xc8, 0x30, 0x0, 0x0,
-    0x0,
+    0x0, 0xe2, 0x7c, 0xef, 0xf7, 0x64, 0xa0, 0x7,
+    0xf0, 0xd6, 0xc1, 0x88, 0x0, 0x4d, 0xaf, 0x50,
+    0x3, 0xc7, 0xea, 0x1, 0xfe, 0x2b, 0x70, 0xc,
+    0x3a, 0x20, 0x1f, 0xfc, 0x18, 0x50, 0xa, 0xc4,
+    0x3, 0x8d, 0xdc, 0xa0, 0x1e, 0xb0, 0x0, 0xa8,
+    0x7, 0x5e, 0x44, 0x2b, 0x44, 0x3, 0xa, 0x2,
+    0x80, 0x74, 0x20, 0x6, 0x2b, 0x0, 0xe3, 0x7,
+    0x55, 0xf0, 0x7, 0x90, 0x3, 0xb8, 0xe, 0xab,
+    0x88, 0x3, 0xff, 0x8, 0x7, 0xff, 0x9, 0x40,
+    0x3b, 0x0, 0x3f, 0xf8, 0x23, 0x20, 0x18, 0x90,
+    0x3, 0xe1, 0x44, 0x96, 0x3c, 0x80, 0x37, 0x0,
+    0x7e, 0x5b, 0xba, 0x9c, 0x40, 0x21, 0xb3, 0x0,
+    0xfc, 0x20, 0x1f, 0x93, 0xd0, 0x3, 0xf8, 0x40,
+    0x3f, 0x25, 0x8, 0x7, 0xff, 0x1d, 0x3c, 0x80,
+    0x3f, 0x27, 0xfe, 0xc6, 0x0, 0xc3, 0xe0, 0x1f,
+    0xfc, 0x13, 0x99, 0x0, 0x62, 0x70, 0xf, 0xfe,
+    0x13, 0x8, 0x6, 0xb0, 0xf, 0xfe, 0x1a, 0x0,
+    0x63, 0x4, 0x55, 0xe0, 0xf, 0xc6, 0x1, 0xef,
+    0xaa, 0xe0, 0xf, 0xc4, 0x1, 0xe2, 0x0, 0xe5,
+    0x0, 0xf1, 0x20, 0x6, 0x20, 0xd0, 0xe, 0xa4,
+    0x0, 0xc3, 0xc0, 0x1c, 0xa0, 0x84, 0x1, 0xd7,
+    0x91, 0xa, 0xe3, 0x0, 0xe9, 0x0, 0x70, 0x7,
+    0x8d, 0xdc, 0xa0, 0x1e, 0x91, 0x0, 0x1d, 0x80,
+    0x7f, 0xf0, 0xa1, 0x80, 0x32, 0x6a, 0x0, 0x7f,
+    0x8f, 0x1c, 0x3, 0xc5, 0x7a, 0xe6, 0x20, 0x1,
+    0x37, 0xcc, 0x18, 0x6,
 
     /* U+0034 "4" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xef, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0xff, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
-    0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xff, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xef,
-    0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xff, 0xf6, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xff, 0xfc, 0xf, 0xff, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0x30, 0xff,
-    0xff, 0xfa, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0x90, 0xf, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xe1, 0x0, 0xff, 0xff, 0xfa, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xf6, 0x0, 0xf, 0xff,
-    0xff, 0xa0, 0x0, 0x0, 0x1f, 0xff, 0xfc, 0x0,
-    0x0, 0xff, 0xff, 0xfa, 0x0, 0x0, 0xb, 0xff,
-    0xff, 0x30, 0x0, 0xf, 0xff, 0xff, 0xa0, 0x0,
-    0x5, 0xff, 0xff, 0x90, 0x0, 0x0, 0xff, 0xff,
-    0xfa, 0x0, 0x0, 0xef, 0xff, 0xe1, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xa0, 0x0, 0x8f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xed,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xeb, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x58,
-    0x88, 0x88, 0x88, 0x88, 0x88, 0xff, 0xff, 0xfd,
-    0x88, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xfa, 0x0,
+    0x0, 0xff, 0x97, 0xff, 0xa8, 0x3, 0xff, 0x82,
+    0x36, 0x1, 0xff, 0xc7, 0x81, 0x0, 0xff, 0xe3,
+    0x1b, 0x0, 0x7f, 0xf1, 0xf8, 0x3, 0xff, 0x8e,
+    0xe4, 0x1, 0xff, 0xc6, 0x18, 0x0, 0xff, 0xe3,
+    0xd0, 0x4, 0x20, 0x1f, 0xfc, 0x35, 0x40, 0xa,
+    0x0, 0x3f, 0xf8, 0x76, 0x1, 0x1b, 0x0, 0x7f,
+    0xf0, 0xa4, 0x40, 0x2f, 0x0, 0xff, 0xe1, 0x1b,
+    0x0, 0x4c, 0x60, 0x1f, 0xfc, 0x2f, 0x0, 0x86,
+    0x0, 0x3f, 0xf8, 0x4e, 0x60, 0x14, 0x8, 0x7,
+    0xff, 0x4, 0x60, 0x2, 0x36, 0x0, 0xff, 0xe1,
+    0x50, 0x6, 0xf0, 0xf, 0xfe, 0x12, 0xa0, 0x4,
+    0xc6, 0x1, 0xff, 0xc2, 0xb0, 0x8, 0x60, 0x3,
+    0xff, 0x85, 0x2, 0x1, 0xf, 0x7f, 0xf0, 0x7,
+    0x2f, 0xfb, 0x94, 0x3, 0xff, 0x90, 0x20, 0x1f,
+    0xfc, 0x87, 0x0, 0xff, 0xe4, 0x73, 0xbf, 0xfc,
+    0x1, 0xc4, 0xee, 0x95, 0x88, 0xff, 0x80, 0x39,
+    0xe2, 0xe, 0x1, 0xff, 0xff, 0x0, 0xff, 0xe9,
     0x0,
 
     /* U+0035 "5" */
-    0x0, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x50, 0x0, 0xcf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x50, 0x0, 0xef, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0x0, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x50,
-    0x2, 0xff, 0xff, 0xfa, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xaa, 0x30, 0x3, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xff, 0x70, 0x2, 0x32,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0x8a,
-    0xff, 0xff, 0xfc, 0x70, 0x0, 0x0, 0xe, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x30, 0x0,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf2, 0x0, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfd, 0x0, 0x2b, 0xff, 0xff, 0x92,
-    0x0, 0x29, 0xff, 0xff, 0xff, 0x60, 0x0, 0x3,
-    0x75, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xf4,
-    0x55, 0x55, 0x53, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xf3, 0xef, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0xff, 0xf1, 0xbf, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xd0, 0x6f, 0xff,
-    0xff, 0xd1, 0x0, 0x0, 0xbf, 0xff, 0xff, 0x80,
-    0xd, 0xff, 0xff, 0xff, 0xa8, 0x9e, 0xff, 0xff,
-    0xff, 0x10, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf6, 0x0, 0x0, 0x4f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x2,
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xe5, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0x8c, 0xef, 0xfd, 0xa6, 0x0,
-    0x0, 0x0,
+    0x0, 0x57, 0xff, 0xff, 0xd, 0x40, 0x26, 0x0,
+    0xff, 0xe3, 0x90, 0x7, 0xff, 0x1c, 0x40, 0x3f,
+    0xf8, 0xc4, 0x1, 0xca, 0xbf, 0xf3, 0x0, 0x4,
+    0x3, 0xd, 0x57, 0xfc, 0x60, 0x6, 0x0, 0xc4,
+    0x1, 0xff, 0xc2, 0x20, 0xc, 0xc0, 0x1f, 0xfc,
+    0x2e, 0x0, 0xc6, 0x1, 0xff, 0xc2, 0x20, 0xd,
+    0xc0, 0x2, 0x32, 0x0, 0xfe, 0x70, 0xd, 0xf5,
+    0xfb, 0x9b, 0xf8, 0xe0, 0x1e, 0x20, 0xc, 0xea,
+    0x1, 0xc7, 0x1a, 0x60, 0x18, 0x40, 0x3f, 0xf8,
+    0x25, 0x84, 0x0, 0x20, 0xf, 0xfe, 0x27, 0x80,
+    0x48, 0x1, 0x9b, 0x7f, 0xda, 0xc0, 0x1c, 0x4c,
+    0x5, 0x7f, 0x91, 0x52, 0x40, 0x2, 0x99, 0x0,
+    0x76, 0x80, 0x63, 0x75, 0x0, 0xf3, 0x10, 0x6,
+    0x40, 0xf, 0xfe, 0x12, 0x80, 0x71, 0x0, 0x7f,
+    0xf0, 0x78, 0x3, 0x98, 0x3, 0xff, 0x90, 0xab,
+    0xc6, 0x1, 0xf0, 0x80, 0x73, 0xdd, 0x56, 0xf0,
+    0xf, 0xb4, 0x3, 0x89, 0x40, 0x31, 0x90, 0x7,
+    0xa, 0x80, 0x62, 0x1d, 0x0, 0xef, 0x10, 0xd,
+    0x40, 0x1c, 0xa0, 0xc4, 0x1, 0x8b, 0xaa, 0x27,
+    0x90, 0x3, 0xa4, 0x1, 0xc0, 0x1e, 0x57, 0x61,
+    0x0, 0xe9, 0x10, 0x1, 0xd8, 0x7, 0xff, 0x5,
+    0xd8, 0x3, 0x26, 0xa0, 0x7, 0xf0, 0xd4, 0x0,
+    0x78, 0xaf, 0x1c, 0xc4, 0x0, 0x4b, 0x3c, 0xa0,
+    0x18,
 
     /* U+0036 "6" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x48, 0xbe, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xdf,
-    0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2c, 0xff, 0xff, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff,
-    0xfd, 0xa9, 0x20, 0x0, 0x0, 0x0, 0x1e, 0xff,
-    0xff, 0xfe, 0x71, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0xff, 0xfb, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0x61, 0x7c, 0xef, 0xec, 0x60, 0x0,
-    0x0, 0x6, 0xff, 0xff, 0xf6, 0xff, 0xff, 0xff,
-    0xff, 0xd3, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf3, 0x0, 0xd, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0xa7, 0x8e, 0xff,
-    0xff, 0xff, 0x70, 0xf, 0xff, 0xff, 0xfc, 0x10,
-    0x0, 0xa, 0xff, 0xff, 0xfd, 0x0, 0xff, 0xff,
-    0xfe, 0x10, 0x0, 0x0, 0xd, 0xff, 0xff, 0xf2,
-    0xf, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0xff, 0x50, 0xff, 0xff, 0xf9, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xf7, 0xf, 0xff, 0xff,
-    0x90, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0x80,
-    0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xf8, 0xc, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0x70, 0x9f, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xf4, 0x4,
-    0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0xff, 0x0, 0xd, 0xff, 0xff, 0xf4, 0x0, 0x0,
-    0xaf, 0xff, 0xff, 0xa0, 0x0, 0x4f, 0xff, 0xff,
-    0xfc, 0x89, 0xef, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7,
-    0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x6e, 0xff,
-    0xff, 0xff, 0xff, 0xe5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xbe, 0xff, 0xeb, 0x60, 0x0, 0x0,
-    0x0,
+    0x0, 0xff, 0x24, 0x5f, 0x7f, 0x90, 0x3, 0xff,
+    0x36, 0xdb, 0xa0, 0x80, 0x7f, 0xf0, 0x4b, 0x24,
+    0x80, 0x3f, 0xf8, 0x89, 0xa6, 0x1, 0xff, 0xc5,
+    0x3b, 0x0, 0xf8, 0x95, 0x98, 0x1, 0xf0, 0xe8,
+    0x7, 0xc, 0x76, 0xd4, 0x90, 0x7, 0xd4, 0x20,
+    0x19, 0x3d, 0xc4, 0x3, 0xfc, 0x68, 0x1, 0x96,
+    0xc4, 0x3, 0xff, 0x40, 0x6, 0x1a, 0x0, 0xff,
+    0xe0, 0x8a, 0x0, 0x68, 0x17, 0xce, 0xfe, 0xc6,
+    0x0, 0xf3, 0x80, 0x7b, 0xa0, 0xc4, 0x4, 0xe7,
+    0x4c, 0x3, 0x60, 0x7, 0x48, 0x7, 0xe2, 0xc3,
+    0x0, 0x9c, 0x3, 0xff, 0x89, 0xc0, 0x11, 0x0,
+    0x7c, 0xb0, 0xe2, 0x1, 0xc4, 0xe0, 0x1f, 0x8f,
+    0xa9, 0xe3, 0x94, 0x3, 0xa8, 0x3, 0xe1, 0xd1,
+    0x0, 0xd4, 0x40, 0x18, 0x88, 0x1, 0xe7, 0x10,
+    0xf, 0x58, 0x7, 0x38, 0x7, 0xff, 0x9, 0x40,
+    0x38, 0x80, 0x3f, 0xf8, 0x44, 0x1, 0xde, 0x1,
+    0xe3, 0x0, 0xff, 0xe1, 0x98, 0x6, 0x60, 0xf,
+    0x88, 0x3, 0xbc, 0x14, 0x3, 0x18, 0x7, 0xc8,
+    0x1, 0xc6, 0x1a, 0x1, 0xce, 0x1, 0xea, 0x0,
+    0xe4, 0x4, 0x20, 0xd, 0x8, 0x1, 0xa8, 0x80,
+    0x32, 0x80, 0x52, 0x1, 0xd7, 0x91, 0x3c, 0xa0,
+    0x1d, 0x0, 0x12, 0x30, 0x7, 0x1b, 0xb0, 0x80,
+    0x74, 0x10, 0x6, 0x96, 0x0, 0xff, 0xce, 0xe0,
+    0xf, 0x4c, 0x84, 0x3, 0xf0, 0xd4, 0x0, 0x7e,
+    0x6e, 0x94, 0x10, 0x0, 0xa4, 0xf2, 0x80, 0x60,
 
     /* U+0037 "7" */
-    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x4d, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf4, 0xdf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4d,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf1, 0x68, 0x88, 0x88, 0x88, 0x88, 0x88,
-    0x88, 0xef, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xff, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
-    0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0,
+    0xdf, 0xff, 0xfe, 0x3a, 0x0, 0x7f, 0xfc, 0x96,
+    0xdd, 0xff, 0xf8, 0x22, 0x1, 0x94, 0x5a, 0x23,
+    0xff, 0x50, 0x80, 0x69, 0x0, 0xff, 0xe1, 0x58,
+    0x6, 0x23, 0x0, 0xff, 0xe0, 0x8b, 0x0, 0x6b,
+    0x0, 0xff, 0xe1, 0x30, 0x6, 0x16, 0x0, 0xff,
+    0xe1, 0x48, 0x6, 0x60, 0xf, 0xfe, 0x12, 0x88,
+    0x6, 0xa0, 0xf, 0xfe, 0x14, 0x80, 0x64, 0x20,
+    0xf, 0xfe, 0xa, 0x18, 0x6, 0xf0, 0xf, 0xfe,
+    0x17, 0x80, 0x62, 0x40, 0xf, 0xfe, 0x9, 0x20,
+    0x6, 0xb0, 0xf, 0xfe, 0x15, 0x80, 0x73, 0x0,
+    0x7f, 0xf0, 0x45, 0x80, 0x33, 0x0, 0x7f, 0xf0,
+    0xa4, 0x3, 0xac, 0x3, 0xff, 0x84, 0xc0, 0x19,
+    0x8, 0x3, 0xff, 0x82, 0xc2, 0x1, 0xbc, 0x3,
+    0xff, 0x85, 0x60, 0x18, 0x90, 0x3, 0xff, 0x82,
+    0x84, 0x1, 0xa8, 0x3, 0xff, 0x85, 0xe0, 0x1c,
+    0xc0, 0x1f, 0xfc, 0x13, 0x40, 0xc, 0xc2, 0x1,
+    0xff, 0xc1, 0x90, 0xe, 0xa0, 0xf, 0xfe, 0x8,
+    0xa8, 0x6, 0x33, 0x0, 0x7f, 0xf0, 0x64, 0x3,
+    0xa4, 0x3, 0xff, 0x84, 0xc0, 0x18, 0x54, 0x3,
+    0xff, 0x82, 0xc2, 0x1, 0xa4, 0x3, 0xfe,
 
     /* U+0038 "8" */
-    0x0, 0x0, 0x0, 0x5a, 0xdf, 0xff, 0xda, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xef, 0xff, 0xff,
-    0xff, 0xff, 0xe5, 0x0, 0x0, 0x0, 0x8, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x0,
-    0x5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf5, 0x0, 0x0, 0xef, 0xff, 0xff, 0xf9, 0x8a,
-    0xff, 0xff, 0xff, 0xd0, 0x0, 0x3f, 0xff, 0xff,
-    0xe1, 0x0, 0x2, 0xef, 0xff, 0xff, 0x30, 0x7,
-    0xff, 0xff, 0xf6, 0x0, 0x0, 0x6, 0xff, 0xff,
-    0xf6, 0x0, 0x8f, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0x80, 0x7, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0xf7, 0x0, 0x4f,
-    0xff, 0xff, 0x50, 0x0, 0x0, 0x5f, 0xff, 0xff,
-    0x40, 0x0, 0xef, 0xff, 0xfc, 0x0, 0x0, 0xd,
-    0xff, 0xff, 0xe0, 0x0, 0x6, 0xff, 0xff, 0xfd,
-    0x64, 0x6d, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x8,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xe5, 0x0, 0x0, 0x0, 0x1, 0xbf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xa1, 0x0, 0x0, 0x2, 0xef,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd1, 0x0,
-    0x0, 0xdf, 0xff, 0xff, 0x94, 0x24, 0xaf, 0xff,
-    0xff, 0xc0, 0x0, 0x7f, 0xff, 0xff, 0x60, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0x60, 0xd, 0xff, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xfc, 0x0,
-    0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0xa, 0xff,
-    0xff, 0xf0, 0x2f, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0xff, 0x11, 0xff, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xf1, 0xf,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0x0, 0xcf, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0xbf, 0xff, 0xff, 0xb0, 0x5, 0xff, 0xff, 0xff,
-    0xe9, 0x89, 0xef, 0xff, 0xff, 0xf4, 0x0, 0xb,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0x6a, 0xdf, 0xff, 0xda, 0x61, 0x0, 0x0,
-    0x0,
+    0x0, 0xf2, 0xd6, 0xff, 0xdb, 0x4a, 0x1, 0xfe,
+    0x5e, 0xa5, 0x20, 0x8, 0x96, 0xb9, 0x40, 0x3e,
+    0x8a, 0x10, 0xf, 0xe1, 0xa7, 0x0, 0xe5, 0x70,
+    0xf, 0xfe, 0xc, 0x28, 0x6, 0xb0, 0xf, 0x33,
+    0xa8, 0x7, 0xa0, 0x2, 0x31, 0x0, 0xc3, 0xd3,
+    0x15, 0xa2, 0x1, 0x88, 0xc0, 0x8, 0x1, 0xd0,
+    0x20, 0x11, 0x40, 0x7, 0x28, 0x3, 0xc0, 0x39,
+    0x0, 0x39, 0x0, 0x3b, 0x80, 0x1e, 0x1, 0xff,
+    0xc5, 0xf0, 0x1, 0x80, 0x73, 0x80, 0x73, 0x80,
+    0x71, 0x80, 0x10, 0x40, 0x34, 0x80, 0x74, 0x0,
+    0x61, 0x40, 0xa, 0x0, 0x31, 0xeb, 0x23, 0x69,
+    0x0, 0x6b, 0x0, 0xcc, 0xe0, 0x18, 0xa6, 0xe4,
+    0x80, 0x33, 0xa8, 0x7, 0x45, 0x0, 0x7f, 0x86,
+    0xa0, 0x3, 0xc3, 0xc0, 0x1f, 0xe1, 0xf1, 0x0,
+    0xe2, 0xf4, 0x0, 0xff, 0x97, 0x4, 0x3, 0x78,
+    0x80, 0x66, 0xbd, 0xb5, 0x0, 0xc5, 0xa0, 0x13,
+    0x90, 0x6, 0x99, 0x21, 0x25, 0x40, 0x6, 0x36,
+    0x0, 0x50, 0x6, 0x26, 0x0, 0xe7, 0x10, 0xd,
+    0x40, 0x2, 0x0, 0xc8, 0x1, 0xf2, 0x0, 0x63,
+    0x2, 0x0, 0xe1, 0x0, 0xf8, 0xc0, 0x38, 0x4c,
+    0x3, 0x84, 0x3, 0xe3, 0x0, 0xf0, 0x80, 0x73,
+    0x80, 0x78, 0x54, 0x3, 0x84, 0xc, 0x3, 0xd,
+    0x80, 0x75, 0x0, 0x72, 0x0, 0x24, 0x3, 0x93,
+    0xa6, 0x27, 0x90, 0x3, 0xbc, 0x0, 0xa8, 0x1,
+    0xc2, 0xce, 0xc2, 0x1, 0xca, 0x80, 0x15, 0x98,
+    0x7, 0xff, 0x5, 0x28, 0x3, 0xb1, 0xc0, 0x3f,
+    0xe8, 0xb0, 0xf, 0xa3, 0xa5, 0x48, 0x2, 0x25,
+    0x9e, 0x70, 0xc,
 
     /* U+0039 "9" */
-    0x0, 0x0, 0x0, 0x4a, 0xdf, 0xfe, 0xb7, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x3c, 0xff, 0xff, 0xff,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x90, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x0,
-    0x0, 0xdf, 0xff, 0xff, 0xe9, 0x8c, 0xff, 0xff,
-    0xff, 0x20, 0x6, 0xff, 0xff, 0xfc, 0x10, 0x0,
-    0x6f, 0xff, 0xff, 0xa0, 0xc, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x9, 0xff, 0xff, 0xf1, 0x1f, 0xff,
-    0xff, 0xa0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xf6,
-    0x3f, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0xef,
-    0xff, 0xf9, 0x4f, 0xff, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0xfc, 0x4f, 0xff, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0xbf, 0xff, 0xfd, 0x3f, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xfe,
-    0xf, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0xcf,
-    0xff, 0xfe, 0xc, 0xff, 0xff, 0xf6, 0x0, 0x0,
-    0x5, 0xff, 0xff, 0xfe, 0x6, 0xff, 0xff, 0xff,
-    0x81, 0x2, 0x8f, 0xff, 0xff, 0xfe, 0x0, 0xdf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd,
-    0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfb, 0x0, 0x4, 0xef, 0xff, 0xff, 0xff,
-    0xfa, 0xdf, 0xff, 0xf8, 0x0, 0x0, 0x18, 0xef,
-    0xff, 0xfc, 0x50, 0xff, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0x2, 0x33, 0x10, 0x4, 0xff, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xbf, 0xff, 0xff, 0xf2, 0x0,
-    0x0, 0x0, 0xa, 0xbc, 0xff, 0xff, 0xff, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0xfe, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xfe, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xfe, 0xb8, 0x40, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+003A ":" */
-    0x4, 0xdf, 0xe6, 0x3, 0xff, 0xff, 0xf5, 0x8f,
-    0xff, 0xff, 0xb8, 0xff, 0xff, 0xfb, 0x3f, 0xff,
-    0xff, 0x50, 0x4d, 0xfd, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xdf, 0xd6, 0x3, 0xff, 0xff, 0xf5, 0x8f,
-    0xff, 0xff, 0xb8, 0xff, 0xff, 0xfb, 0x3f, 0xff,
-    0xff, 0x50, 0x4d, 0xfe, 0x60,
-
-    /* U+003B ";" */
-    0x0, 0x8e, 0xfc, 0x30, 0x7, 0xff, 0xff, 0xf1,
-    0xd, 0xff, 0xff, 0xf6, 0xd, 0xff, 0xff, 0xf6,
-    0x7, 0xff, 0xff, 0xf1, 0x0, 0x8e, 0xfc, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x68, 0x88, 0x70,
-    0x0, 0xcf, 0xff, 0xe0, 0x0, 0xcf, 0xff, 0xe0,
-    0x0, 0xcf, 0xff, 0xe0, 0x0, 0xcf, 0xff, 0xe0,
-    0x0, 0xdf, 0xff, 0xd0, 0x0, 0xff, 0xff, 0xa0,
-    0x3, 0xff, 0xff, 0x50, 0x9, 0xff, 0xfe, 0x0,
-    0x1f, 0xff, 0xf7, 0x0, 0x9f, 0xff, 0xd0, 0x0,
-    0x2a, 0xfe, 0x20, 0x0, 0x0, 0x32, 0x0, 0x0,
-
-    /* U+003C "<" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x7e,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3a, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x5, 0xcf, 0xff,
-    0xff, 0xff, 0x0, 0x0, 0x1, 0x7e, 0xff, 0xff,
-    0xff, 0xff, 0xf0, 0x0, 0x29, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xe8, 0x4, 0xbf, 0xff, 0xff, 0xff,
-    0xff, 0xfa, 0x40, 0xd, 0xff, 0xff, 0xff, 0xff,
-    0xfd, 0x61, 0x0, 0x0, 0xff, 0xff, 0xff, 0xfe,
-    0x92, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
-    0xfc, 0x60, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff,
-    0xff, 0xff, 0xfa, 0x40, 0x0, 0x0, 0x17, 0xef,
-    0xff, 0xff, 0xff, 0xff, 0xe8, 0x20, 0x0, 0x0,
-    0x5c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc6, 0x0,
-    0x0, 0x3, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x17, 0xef, 0xff, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5c, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xaf,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x18, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+003D "=" */
-    0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x25, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf2, 0x5f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x25, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x39, 0x99,
-    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x38, 0x88, 0x88, 0x88,
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x15, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x5f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x25, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf2, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x20,
-
-    /* U+003E ">" */
-    0x97, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xfa, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xff, 0xfc, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xfe, 0x71,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xff,
-    0xff, 0x93, 0x0, 0x0, 0x0, 0x5c, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xc5, 0x0, 0x0, 0x0, 0x28,
-    0xef, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x10, 0x0,
-    0x0, 0x4, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x5b, 0xff, 0xff, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2d, 0xff,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x4a, 0xff,
-    0xff, 0xff, 0xf7, 0x0, 0x0, 0x2, 0x8e, 0xff,
-    0xff, 0xff, 0xff, 0xf5, 0x0, 0x16, 0xcf, 0xff,
-    0xff, 0xff, 0xff, 0xfa, 0x30, 0x3a, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe7, 0x10, 0x0, 0xaf, 0xff,
-    0xff, 0xff, 0xff, 0xc5, 0x0, 0x0, 0x0, 0xaf,
-    0xff, 0xff, 0xff, 0xa3, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xff, 0xfe, 0x71, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xfc, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaa, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+003F "?" */
-    0x0, 0x0, 0x3, 0x8c, 0xef, 0xfe, 0xb7, 0x10,
-    0x0, 0x0, 0x0, 0x2b, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x2e, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xa0, 0x0, 0xd, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x6, 0xff,
-    0xff, 0xff, 0xc9, 0x9e, 0xff, 0xff, 0xfe, 0x0,
-    0xcf, 0xff, 0xff, 0x70, 0x0, 0x1d, 0xff, 0xff,
-    0xf4, 0xf, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x6f,
-    0xff, 0xff, 0x61, 0xee, 0xee, 0xe8, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xdf, 0xff,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x2, 0xef,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xef, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6c, 0xeb,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xff, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xef, 0xd4,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+0040 "@" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x12, 0x21, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5a,
-    0xdf, 0xff, 0xff, 0xfd, 0x94, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x8f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5e,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xd2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0xff, 0xfb, 0x63, 0x10, 0x1, 0x37, 0xcf,
-    0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xff, 0xfa, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xbf, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0xfe, 0x10, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xb0, 0x0,
-    0x0, 0x2, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xf4,
-    0x0, 0x0, 0xa, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x6, 0xcf, 0xfe, 0xc7, 0x0, 0x0, 0x1, 0xef,
-    0xfb, 0x0, 0x0, 0x2f, 0xff, 0xe0, 0x0, 0x0,
-    0x3, 0xef, 0xff, 0xff, 0xff, 0xe5, 0x0, 0x0,
-    0x8f, 0xff, 0x10, 0x0, 0x9f, 0xff, 0x60, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x30,
-    0x0, 0x2f, 0xff, 0x60, 0x0, 0xff, 0xfe, 0x0,
-    0x0, 0x1, 0xef, 0xff, 0xe9, 0x67, 0xff, 0xff,
-    0x20, 0x0, 0xd, 0xff, 0xa0, 0x5, 0xff, 0xf9,
-    0x0, 0x0, 0xa, 0xff, 0xfd, 0x10, 0x0, 0xdf,
-    0xff, 0x0, 0x0, 0xa, 0xff, 0xd0, 0x9, 0xff,
-    0xf4, 0x0, 0x0, 0x3f, 0xff, 0xf2, 0x0, 0x0,
-    0xff, 0xff, 0x0, 0x0, 0x8, 0xff, 0xf0, 0xd,
-    0xff, 0xf0, 0x0, 0x0, 0xaf, 0xff, 0x90, 0x0,
-    0x0, 0xff, 0xfe, 0x0, 0x0, 0x6, 0xff, 0xf1,
-    0xf, 0xff, 0xc0, 0x0, 0x0, 0xff, 0xff, 0x30,
-    0x0, 0x1, 0xff, 0xfc, 0x0, 0x0, 0x5, 0xff,
-    0xf2, 0x2f, 0xff, 0xa0, 0x0, 0x4, 0xff, 0xfe,
-    0x0, 0x0, 0x3, 0xff, 0xfb, 0x0, 0x0, 0x4,
-    0xff, 0xf2, 0x4f, 0xff, 0x80, 0x0, 0x8, 0xff,
-    0xfb, 0x0, 0x0, 0x4, 0xff, 0xfa, 0x0, 0x0,
-    0x5, 0xff, 0xf2, 0x5f, 0xff, 0x70, 0x0, 0xb,
-    0xff, 0xf9, 0x0, 0x0, 0x5, 0xff, 0xf9, 0x0,
-    0x0, 0x5, 0xff, 0xf1, 0x6f, 0xff, 0x60, 0x0,
-    0xd, 0xff, 0xf7, 0x0, 0x0, 0x7, 0xff, 0xf7,
-    0x0, 0x0, 0x7, 0xff, 0xf0, 0x6f, 0xff, 0x60,
-    0x0, 0xe, 0xff, 0xf6, 0x0, 0x0, 0x8, 0xff,
-    0xf6, 0x0, 0x0, 0x9, 0xff, 0xd0, 0x5f, 0xff,
-    0x70, 0x0, 0xe, 0xff, 0xf6, 0x0, 0x0, 0xa,
-    0xff, 0xf5, 0x0, 0x0, 0xd, 0xff, 0xa0, 0x4f,
-    0xff, 0x80, 0x0, 0xd, 0xff, 0xf8, 0x0, 0x0,
-    0xe, 0xff, 0xf4, 0x0, 0x0, 0x2f, 0xff, 0x50,
-    0x2f, 0xff, 0xa0, 0x0, 0xb, 0xff, 0xfb, 0x0,
-    0x0, 0x5f, 0xff, 0xf3, 0x0, 0x0, 0x9f, 0xff,
-    0x0, 0xf, 0xff, 0xd0, 0x0, 0x7, 0xff, 0xff,
-    0x40, 0x3, 0xef, 0xff, 0xf6, 0x0, 0x3, 0xff,
-    0xf8, 0x0, 0xd, 0xff, 0xf1, 0x0, 0x2, 0xff,
-    0xff, 0xfa, 0xaf, 0xff, 0xff, 0xfe, 0x52, 0x7f,
-    0xff, 0xe1, 0x0, 0x8, 0xff, 0xf6, 0x0, 0x0,
-    0xaf, 0xff, 0xff, 0xff, 0xf8, 0xdf, 0xff, 0xff,
-    0xff, 0xff, 0x30, 0x0, 0x3, 0xff, 0xfd, 0x0,
-    0x0, 0xc, 0xff, 0xff, 0xff, 0x90, 0x2e, 0xff,
-    0xff, 0xff, 0xe3, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0x60, 0x0, 0x0, 0x7d, 0xff, 0xb4, 0x0, 0x1,
-    0x9e, 0xff, 0xc7, 0x10, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xfd, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xff, 0xe3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xa3, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xff,
-    0xea, 0x86, 0x66, 0x8a, 0xdf, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2c, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x26, 0xac, 0xef, 0xff, 0xdb, 0x73,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0041 "A" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xff, 0xff, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xff, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xff, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xbf, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0xff, 0xf1, 0xff, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xfa,
-    0xc, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xff, 0x50, 0x6f, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xf0, 0x1, 0xff, 0xff, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xfa,
-    0x0, 0xc, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0x50, 0x0, 0x7f,
-    0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0xff, 0xf1, 0x0, 0x2, 0xff, 0xff, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xfb,
-    0x0, 0x0, 0xd, 0xff, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xff, 0xff, 0x60, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0xa,
-    0xff, 0xff, 0xf1, 0x0, 0x0, 0x2, 0xff, 0xff,
-    0xf9, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff,
-    0xbb, 0xbb, 0xbb, 0xbf, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x40, 0x0, 0x0, 0xc,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfa, 0x0, 0x0, 0x2, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x60, 0x0, 0xd,
-    0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xfc, 0x0, 0x3, 0xff, 0xff, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff,
-    0xf2, 0x0, 0x9f, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0x80, 0xe,
-    0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xff, 0xfd, 0x5, 0xff, 0xff, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff,
-    0xff, 0xf3, 0xaf, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0x90,
-
-    /* U+0042 "B" */
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xec, 0x95,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe7, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,
-    0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfb, 0x0, 0x7f, 0xff, 0xff, 0xdb,
-    0xbb, 0xbc, 0xef, 0xff, 0xff, 0xff, 0x40, 0x7f,
-    0xff, 0xff, 0x60, 0x0, 0x0, 0x3, 0xdf, 0xff,
-    0xff, 0xb0, 0x7f, 0xff, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xe0, 0x7f, 0xff, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0xf0,
-    0x7f, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0xd,
-    0xff, 0xff, 0xf0, 0x7f, 0xff, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xe0, 0x7f, 0xff,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0xa0, 0x7f, 0xff, 0xff, 0x60, 0x0, 0x0, 0x39,
-    0xff, 0xff, 0xff, 0x30, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x0, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfa, 0x10, 0x0, 0x7f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x0,
-    0x7f, 0xff, 0xff, 0x83, 0x33, 0x33, 0x26, 0xdf,
-    0xff, 0xff, 0x50, 0x7f, 0xff, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x1e, 0xff, 0xff, 0xe0, 0x7f, 0xff,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff,
-    0xf5, 0x7f, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xf9, 0x7f, 0xff, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xfa, 0x7f,
-    0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0xff, 0xfa, 0x7f, 0xff, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xff, 0xf8, 0x7f, 0xff, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xf4,
-    0x7f, 0xff, 0xff, 0xda, 0xaa, 0xaa, 0xcf, 0xff,
-    0xff, 0xff, 0xe0, 0x7f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7,
-    0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfd, 0x40, 0x0, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0xc8, 0x30, 0x0, 0x0,
+    0x0, 0xf2, 0x56, 0xff, 0xba, 0xdc, 0x40, 0x3f,
+    0x8f, 0x2d, 0x48, 0x0, 0x29, 0x1c, 0xc0, 0x1f,
+    0x2e, 0x18, 0x7, 0xf4, 0xc8, 0x3, 0x8e, 0x80,
+    0x3f, 0xf3, 0x38, 0x6, 0xe0, 0xe, 0x16, 0x73,
+    0x0, 0xe8, 0x20, 0x3, 0x10, 0x6, 0x3f, 0x98,
+    0xc9, 0x0, 0xe8, 0x0, 0x50, 0x7, 0x70, 0x80,
+    0x4c, 0xc0, 0xc, 0xa2, 0x23, 0x0, 0xca, 0x40,
+    0x1d, 0x60, 0x1c, 0xe4, 0x1, 0xd8, 0x1, 0xe2,
+    0x10, 0xd, 0xee, 0x1, 0xc6, 0x1, 0xf1, 0x0,
+    0x65, 0x0, 0xff, 0xe1, 0x38, 0x6, 0x17, 0x0,
+    0xed, 0x0, 0xff, 0xc6, 0x60, 0xe, 0x40, 0xf,
+    0x9c, 0x3, 0xc6, 0x1, 0x8d, 0x80, 0x39, 0x4c,
+    0x3, 0xd4, 0x1, 0xd3, 0x2, 0x5, 0x14, 0x1,
+    0xf3, 0x10, 0x7, 0x3f, 0x7e, 0xb8, 0x7, 0x8c,
+    0x1, 0xc0, 0x1f, 0xfc, 0x46, 0x0, 0x1d, 0x88,
+    0x7, 0xe5, 0x20, 0xc, 0x60, 0x12, 0x7b, 0x88,
+    0x6, 0x3a, 0xa1, 0x0, 0x6d, 0x0, 0xc3, 0x1d,
+    0xb9, 0x8e, 0xc5, 0x40, 0xe, 0x40, 0xf, 0x88,
+    0xcc, 0x20, 0xf, 0x0, 0xc8, 0x20, 0x1f, 0xf9,
+    0x50, 0x3, 0x78, 0x7, 0xfe, 0x5a, 0x0, 0xc6,
+    0x80, 0x1f, 0xe4, 0xba, 0x0, 0xee, 0x0, 0xfa,
+    0xaf, 0x3e, 0xd0, 0x3, 0xa8, 0x80, 0x3c, 0x2a,
+    0x86, 0x1, 0xf4, 0xa8, 0x7, 0xff, 0x10, 0x6d,
+    0x80, 0x3f, 0xf8, 0x63, 0x1c, 0x80, 0x1f, 0xf8,
+    0x51, 0xef, 0x9c, 0x3, 0xe0,
 
     /* U+0043 "C" */
-    0x0, 0x0, 0x0, 0x0, 0x6a, 0xdf, 0xff, 0xeb,
-    0x72, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xb2, 0x0, 0x0,
-    0x0, 0x0, 0x1c, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x50, 0x0, 0x0, 0x1, 0xdf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x0,
-    0x0, 0xb, 0xff, 0xff, 0xff, 0xfd, 0xcd, 0xff,
-    0xff, 0xff, 0xff, 0x10, 0x0, 0x6f, 0xff, 0xff,
-    0xf8, 0x10, 0x0, 0x5, 0xef, 0xff, 0xff, 0xa0,
-    0x0, 0xef, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x1e, 0xff, 0xff, 0xf1, 0x5, 0xff, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xf6,
-    0xa, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0xfa, 0xe, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xfd,
-    0x1f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcd, 0xdd, 0xda,
-    0xa, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0xfb, 0x5, 0xff, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xf7,
-    0x0, 0xef, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xf2, 0x0, 0x7f, 0xff, 0xff,
-    0xf7, 0x0, 0x0, 0x5, 0xef, 0xff, 0xff, 0xb0,
-    0x0, 0xd, 0xff, 0xff, 0xff, 0xfc, 0xbc, 0xff,
-    0xff, 0xff, 0xff, 0x20, 0x0, 0x2, 0xef, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x0,
-    0x0, 0x0, 0x2d, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xb2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0x6a, 0xdf, 0xff, 0xeb,
-    0x72, 0x0, 0x0, 0x0,
-
-    /* U+0044 "D" */
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xa6, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x81, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xdb, 0xbb, 0xcf, 0xff, 0xff, 0xff, 0xf4,
-    0x0, 0x7, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x6,
-    0xef, 0xff, 0xff, 0xe1, 0x0, 0x7f, 0xff, 0xff,
-    0x60, 0x0, 0x0, 0x1, 0xdf, 0xff, 0xff, 0x90,
-    0x7, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xff, 0xff, 0x10, 0x7f, 0xff, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xf7, 0x7,
-    0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0xc0, 0x7f, 0xff, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0x7, 0xff,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff,
-    0xff, 0xf2, 0x7f, 0xff, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xff, 0xff, 0x37, 0xff, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff,
-    0xf4, 0x7f, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xff, 0xff, 0x47, 0xff, 0xff, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xf4,
-    0x7f, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xff, 0xff, 0x37, 0xff, 0xff, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xf2, 0x7f,
-    0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0x7, 0xff, 0xff, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xc0, 0x7f, 0xff,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff,
-    0xf7, 0x7, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0xff, 0x10, 0x7f, 0xff, 0xff,
-    0x60, 0x0, 0x0, 0x1, 0xdf, 0xff, 0xff, 0x90,
-    0x7, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x5, 0xef,
-    0xff, 0xff, 0xe1, 0x0, 0x7f, 0xff, 0xff, 0xda,
-    0xaa, 0xcf, 0xff, 0xff, 0xff, 0xf4, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf6, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe4, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x91, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfd,
-    0xa6, 0x10, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0045 "E" */
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf9, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf9, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9,
-    0x7f, 0xff, 0xff, 0xdb, 0xbb, 0xbb, 0xbb, 0xbb,
-    0xbb, 0xb6, 0x7f, 0xff, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfa, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfa, 0x0, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfa, 0x0, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x0,
-    0x7f, 0xff, 0xff, 0xb8, 0x88, 0x88, 0x88, 0x88,
-    0x85, 0x0, 0x7f, 0xff, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xda, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xa6, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfa, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfa,
-
-    /* U+0046 "F" */
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf1, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf1, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1,
-    0x7f, 0xff, 0xff, 0xdb, 0xbb, 0xbb, 0xbb, 0xbb,
-    0xbb, 0xb1, 0x7f, 0xff, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xda, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xa7, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfb, 0x0, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfb, 0x0, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x0,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfb, 0x0, 0x7f, 0xff, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+0047 "G" */
-    0x0, 0x0, 0x0, 0x0, 0x49, 0xde, 0xff, 0xec,
-    0x95, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xef, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xc1, 0x0, 0x0, 0x0, 0xc,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0xfd,
-    0xaa, 0xcf, 0xff, 0xff, 0xff, 0x80, 0x0, 0x3,
-    0xff, 0xff, 0xff, 0xc2, 0x0, 0x0, 0x1b, 0xff,
-    0xff, 0xff, 0x10, 0x0, 0xbf, 0xff, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xf6, 0x0,
-    0x2f, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xb0, 0x7, 0xff, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff,
-    0x0, 0xbf, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0x44, 0x44, 0x40, 0xe, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x44, 0x44, 0x44, 0x44, 0x44, 0x40, 0x2f,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x12, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1,
-    0x1f, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x10, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf1, 0xe, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xff, 0xff, 0x10, 0xbf, 0xff,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff,
-    0xff, 0xf1, 0x7, 0xff, 0xff, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0x10, 0x2f,
-    0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xff, 0xff, 0xf1, 0x0, 0xbf, 0xff, 0xff, 0xd1,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0x10,
-    0x3, 0xff, 0xff, 0xff, 0xe5, 0x0, 0x0, 0x1,
-    0x9f, 0xff, 0xff, 0xf1, 0x0, 0x8, 0xff, 0xff,
-    0xff, 0xfe, 0xba, 0xbd, 0xff, 0xff, 0xff, 0xff,
-    0x10, 0x0, 0xa, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x9,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x50, 0x0, 0x0, 0x0, 0x4, 0xcf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe8, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x38, 0xce, 0xff, 0xfe, 0xc8, 0x40,
-    0x0, 0x0, 0x0,
-
-    /* U+0048 "H" */
-    0x7f, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0xfb, 0x7f, 0xff, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xfb,
-    0x7f, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0xfb, 0x7f, 0xff, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xfb,
-    0x7f, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0xfb, 0x7f, 0xff, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xfb,
-    0x7f, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0xfb, 0x7f, 0xff, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xfb,
-    0x7f, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0xfb, 0x7f, 0xff, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xfb,
-    0x7f, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0xfb, 0x7f, 0xff, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xfb,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfb, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfb, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb,
-    0x7f, 0xff, 0xff, 0xda, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xab, 0xff, 0xff, 0xfb, 0x7f, 0xff, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xfb,
-    0x7f, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0xfb, 0x7f, 0xff, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xfb,
-    0x7f, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0xfb, 0x7f, 0xff, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xfb,
-    0x7f, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0xfb, 0x7f, 0xff, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xfb,
-    0x7f, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0xfb, 0x7f, 0xff, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xfb,
-    0x7f, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0xfb, 0x7f, 0xff, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xfb,
-    0x7f, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0xfb,
-
-    /* U+0049 "I" */
-    0x1f, 0xff, 0xff, 0xc1, 0xff, 0xff, 0xfc, 0x1f,
-    0xff, 0xff, 0xc1, 0xff, 0xff, 0xfc, 0x1f, 0xff,
-    0xff, 0xc1, 0xff, 0xff, 0xfc, 0x1f, 0xff, 0xff,
-    0xc1, 0xff, 0xff, 0xfc, 0x1f, 0xff, 0xff, 0xc1,
-    0xff, 0xff, 0xfc, 0x1f, 0xff, 0xff, 0xc1, 0xff,
-    0xff, 0xfc, 0x1f, 0xff, 0xff, 0xc1, 0xff, 0xff,
-    0xfc, 0x1f, 0xff, 0xff, 0xc1, 0xff, 0xff, 0xfc,
-    0x1f, 0xff, 0xff, 0xc1, 0xff, 0xff, 0xfc, 0x1f,
-    0xff, 0xff, 0xc1, 0xff, 0xff, 0xfc, 0x1f, 0xff,
-    0xff, 0xc1, 0xff, 0xff, 0xfc, 0x1f, 0xff, 0xff,
-    0xc1, 0xff, 0xff, 0xfc, 0x1f, 0xff, 0xff, 0xc1,
-    0xff, 0xff, 0xfc, 0x1f, 0xff, 0xff, 0xc1, 0xff,
-    0xff, 0xfc, 0x1f, 0xff, 0xff, 0xc0,
-
-    /* U+004A "J" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xfe,
-    0x2e, 0xee, 0xee, 0xa0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xfd, 0x1f, 0xff, 0xff, 0xd0, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0xfc, 0xf, 0xff, 0xff, 0xf1,
-    0x0, 0x0, 0x8, 0xff, 0xff, 0xf9, 0xa, 0xff,
-    0xff, 0xfb, 0x10, 0x0, 0x6f, 0xff, 0xff, 0xf3,
-    0x4, 0xff, 0xff, 0xff, 0xfb, 0xbd, 0xff, 0xff,
-    0xff, 0xc0, 0x0, 0xaf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x20, 0x0, 0xc, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0,
-    0x8f, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x20, 0x0,
-    0x0, 0x0, 0x1, 0x7b, 0xdf, 0xff, 0xc9, 0x30,
-    0x0, 0x0,
-
-    /* U+004B "K" */
-    0x7f, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xff, 0xff, 0xe1, 0x7f, 0xff, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0xff, 0x40,
-    0x7f, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0xaf,
-    0xff, 0xff, 0xf7, 0x0, 0x7f, 0xff, 0xff, 0x60,
-    0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0xa0, 0x0,
-    0x7f, 0xff, 0xff, 0x60, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0xfd, 0x0, 0x0, 0x7f, 0xff, 0xff, 0x60,
-    0x0, 0x0, 0xdf, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0x60, 0x0, 0xa, 0xff, 0xff,
-    0xff, 0x50, 0x0, 0x0, 0x7f, 0xff, 0xff, 0x60,
-    0x0, 0x6f, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0x60, 0x2, 0xff, 0xff, 0xff,
-    0xb0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0x60,
-    0xd, 0xff, 0xff, 0xfe, 0x10, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0x60, 0x9f, 0xff, 0xff, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0x65,
-    0xff, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0x8e, 0xff, 0xff, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff,
-    0xfa, 0xff, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xff, 0x50, 0xcf, 0xff, 0xff,
-    0xe1, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xf7,
-    0x0, 0x3f, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0x90, 0x0, 0x8, 0xff, 0xff,
-    0xff, 0x40, 0x0, 0x0, 0x7f, 0xff, 0xff, 0x60,
-    0x0, 0x0, 0xef, 0xff, 0xff, 0xd0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0x60, 0x0, 0x0, 0x4f, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x7f, 0xff, 0xff, 0x60,
-    0x0, 0x0, 0xa, 0xff, 0xff, 0xff, 0x30, 0x0,
-    0x7f, 0xff, 0xff, 0x60, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xff, 0xc0, 0x0, 0x7f, 0xff, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xf7, 0x0,
-    0x7f, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0xc,
-    0xff, 0xff, 0xff, 0x20, 0x7f, 0xff, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xb0,
-    0x7f, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xff, 0xff, 0xf6,
+    0x0, 0xfc, 0xd5, 0xbf, 0xf7, 0x5b, 0x90, 0x7,
+    0xfe, 0x7f, 0x95, 0x20, 0x8, 0x52, 0x36, 0xc8,
+    0x3, 0xf0, 0xe4, 0x0, 0x7f, 0xc9, 0xaa, 0x1,
+    0xe1, 0xc3, 0x0, 0xff, 0xe1, 0x52, 0x80, 0x75,
+    0x10, 0x7, 0x88, 0xc8, 0x3, 0xea, 0x10, 0x9,
+    0x90, 0x3, 0x9f, 0xb7, 0x37, 0xe8, 0x40, 0x3a,
+    0xc0, 0x28, 0x0, 0xe9, 0x81, 0x0, 0xcb, 0xe2,
+    0x1, 0x94, 0x41, 0x44, 0x3, 0x23, 0x0, 0x7c,
+    0x32, 0x1, 0xce, 0x1e, 0x1, 0xde, 0x1, 0xfc,
+    0xa0, 0x1d, 0x80, 0x80, 0x1c, 0x80, 0x1f, 0xc4,
+    0x1, 0xce, 0x22, 0x0, 0xc6, 0x1, 0xff, 0x7f,
+    0xf6, 0x90, 0x7, 0x30, 0x7, 0xff, 0x15, 0xc0,
+    0x38, 0xc0, 0x3f, 0xfb, 0xa2, 0x1, 0xff, 0xcb,
+    0x10, 0xf, 0xff, 0x1b, 0x80, 0x71, 0x80, 0x7f,
+    0xf1, 0x48, 0x3, 0x98, 0x3, 0xff, 0x8a, 0x22,
+    0x0, 0xc6, 0x1, 0xff, 0x66, 0xee, 0xa0, 0x40,
+    0xe, 0x40, 0xf, 0xe2, 0x32, 0x2c, 0x21, 0xe0,
+    0x1d, 0xe0, 0x1f, 0xd4, 0x1, 0xd8, 0xa, 0x20,
+    0x19, 0x14, 0x3, 0xe2, 0x70, 0xe, 0x50, 0x4,
+    0x80, 0x75, 0x38, 0x7, 0x2e, 0x0, 0x72, 0x10,
+    0x1, 0xc8, 0x3, 0xa3, 0xf2, 0xf3, 0xe8, 0x40,
+    0x3a, 0x40, 0x37, 0x88, 0x7, 0x8d, 0xc, 0x3,
+    0xea, 0x20, 0xc, 0x58, 0x40, 0x1f, 0xfc, 0x2a,
+    0x50, 0xf, 0x16, 0xb8, 0x7, 0xfc, 0x9a, 0xa0,
+    0x1f, 0xd1, 0xd2, 0xa4, 0x1, 0xa, 0x46, 0xd9,
+    0x0, 0x60,
 
     /* U+004C "L" */
-    0x7f, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xda,
-    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x87, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xd7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfd, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xd0,
-
-    /* U+004D "M" */
-    0x7f, 0xff, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xff, 0x77,
-    0xff, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xff, 0xff, 0xf7, 0x7f,
-    0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0xff, 0x77, 0xff,
-    0xff, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xff, 0xff, 0xf7, 0x7f, 0xff,
-    0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xff, 0xff, 0xff, 0x77, 0xff, 0xff,
-    0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xff, 0xff, 0xf7, 0x7f, 0xff, 0xff,
-    0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0x77, 0xff, 0xff, 0xef,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff,
-    0xff, 0xef, 0xff, 0xf7, 0x7f, 0xff, 0xfd, 0xcf,
-    0xff, 0xf1, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff,
-    0xbe, 0xff, 0xff, 0x77, 0xff, 0xff, 0xe6, 0xff,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xf6,
-    0xef, 0xff, 0xf7, 0x7f, 0xff, 0xfe, 0x1f, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0xf,
-    0xff, 0xff, 0x77, 0xff, 0xff, 0xf0, 0xbf, 0xff,
-    0xf1, 0x0, 0x0, 0x2, 0xff, 0xff, 0xa0, 0xff,
-    0xff, 0xf7, 0x7f, 0xff, 0xff, 0x5, 0xff, 0xff,
-    0x70, 0x0, 0x0, 0x8f, 0xff, 0xf5, 0x1f, 0xff,
-    0xff, 0x77, 0xff, 0xff, 0xf1, 0xf, 0xff, 0xfc,
-    0x0, 0x0, 0xd, 0xff, 0xff, 0x1, 0xff, 0xff,
-    0xf7, 0x7f, 0xff, 0xff, 0x10, 0xaf, 0xff, 0xf2,
-    0x0, 0x3, 0xff, 0xff, 0x90, 0x2f, 0xff, 0xff,
-    0x77, 0xff, 0xff, 0xf2, 0x4, 0xff, 0xff, 0x70,
-    0x0, 0x8f, 0xff, 0xf4, 0x3, 0xff, 0xff, 0xf7,
-    0x7f, 0xff, 0xff, 0x30, 0xe, 0xff, 0xfd, 0x0,
-    0xd, 0xff, 0xfe, 0x0, 0x3f, 0xff, 0xff, 0x77,
-    0xff, 0xff, 0xf3, 0x0, 0x9f, 0xff, 0xf2, 0x3,
-    0xff, 0xff, 0x80, 0x4, 0xff, 0xff, 0xf7, 0x7f,
-    0xff, 0xff, 0x40, 0x3, 0xff, 0xff, 0x80, 0x8f,
-    0xff, 0xf3, 0x0, 0x5f, 0xff, 0xff, 0x77, 0xff,
-    0xff, 0xf5, 0x0, 0xe, 0xff, 0xfd, 0xe, 0xff,
-    0xfd, 0x0, 0x5, 0xff, 0xff, 0xf7, 0x7f, 0xff,
-    0xff, 0x50, 0x0, 0x8f, 0xff, 0xf7, 0xff, 0xff,
-    0x70, 0x0, 0x6f, 0xff, 0xff, 0x77, 0xff, 0xff,
-    0xf6, 0x0, 0x2, 0xff, 0xff, 0xff, 0xff, 0xf2,
-    0x0, 0x6, 0xff, 0xff, 0xf7, 0x7f, 0xff, 0xff,
-    0x60, 0x0, 0xd, 0xff, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x6f, 0xff, 0xff, 0x77, 0xff, 0xff, 0xf6,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0x60, 0x0,
-    0x6, 0xff, 0xff, 0xf7, 0x7f, 0xff, 0xff, 0x60,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0xf1, 0x0, 0x0,
-    0x6f, 0xff, 0xff, 0x77, 0xff, 0xff, 0xf6, 0x0,
-    0x0, 0xc, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x6,
-    0xff, 0xff, 0xf7, 0x7f, 0xff, 0xff, 0x60, 0x0,
-    0x0, 0x6f, 0xff, 0xff, 0x50, 0x0, 0x0, 0x6f,
-    0xff, 0xff, 0x77, 0xff, 0xff, 0xf6, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x6, 0xff,
-    0xff, 0xf7, 0x7f, 0xff, 0xff, 0x60, 0x0, 0x0,
-    0xb, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0xff, 0x70,
-
-    /* U+004E "N" */
-    0x7f, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0xfb, 0x7f, 0xff, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xfb,
-    0x7f, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0xfb, 0x7f, 0xff, 0xff, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xfb,
-    0x7f, 0xff, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0xfb, 0x7f, 0xff, 0xff, 0xff,
-    0xfa, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xfb,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0x30, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0xfb, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xfb,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0xfb, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x10, 0x0, 0x2, 0xff, 0xff, 0xfb,
-    0x7f, 0xff, 0xff, 0x8f, 0xff, 0xff, 0x90, 0x0,
-    0x2, 0xff, 0xff, 0xfb, 0x7f, 0xff, 0xff, 0x67,
-    0xff, 0xff, 0xf2, 0x0, 0x2, 0xff, 0xff, 0xfb,
-    0x7f, 0xff, 0xff, 0x60, 0xdf, 0xff, 0xfc, 0x0,
-    0x2, 0xff, 0xff, 0xfb, 0x7f, 0xff, 0xff, 0x60,
-    0x4f, 0xff, 0xff, 0x50, 0x2, 0xff, 0xff, 0xfb,
-    0x7f, 0xff, 0xff, 0x60, 0xb, 0xff, 0xff, 0xe0,
-    0x2, 0xff, 0xff, 0xfb, 0x7f, 0xff, 0xff, 0x60,
-    0x2, 0xff, 0xff, 0xf8, 0x2, 0xff, 0xff, 0xfb,
-    0x7f, 0xff, 0xff, 0x60, 0x0, 0x8f, 0xff, 0xff,
-    0x22, 0xff, 0xff, 0xfb, 0x7f, 0xff, 0xff, 0x60,
-    0x0, 0xe, 0xff, 0xff, 0xb2, 0xff, 0xff, 0xfb,
-    0x7f, 0xff, 0xff, 0x60, 0x0, 0x5, 0xff, 0xff,
-    0xf7, 0xff, 0xff, 0xfb, 0x7f, 0xff, 0xff, 0x60,
-    0x0, 0x0, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xfb,
-    0x7f, 0xff, 0xff, 0x60, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0xff, 0xff, 0xfb, 0x7f, 0xff, 0xff, 0x60,
-    0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0xff, 0xfb,
-    0x7f, 0xff, 0xff, 0x60, 0x0, 0x0, 0x1, 0xef,
-    0xff, 0xff, 0xff, 0xfb, 0x7f, 0xff, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xff, 0xfb,
-    0x7f, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0xc,
-    0xff, 0xff, 0xff, 0xfb, 0x7f, 0xff, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xfb,
-    0x7f, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xff, 0xff, 0xfb, 0x7f, 0xff, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xfb,
-    0x7f, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xfb,
-
-    /* U+004F "O" */
-    0x0, 0x0, 0x0, 0x0, 0x49, 0xce, 0xff, 0xeb,
-    0x72, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xdf, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x50, 0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0xfe,
-    0xcd, 0xff, 0xff, 0xff, 0xff, 0x20, 0x0, 0x4,
-    0xff, 0xff, 0xff, 0xc3, 0x0, 0x0, 0x6f, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xf5, 0x0,
-    0x3f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xff, 0xff, 0xc0, 0x9, 0xff, 0xff, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xff,
-    0x20, 0xdf, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0xff, 0xf6, 0xf, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0xff, 0xa2, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0xfc, 0x4f, 0xff,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xd4, 0xff, 0xff, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xfe, 0x5f,
-    0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xe4, 0xff, 0xff, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xfe,
-    0x4f, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xd2, 0xff, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff,
-    0xfc, 0xf, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0xff, 0xa0, 0xdf, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
-    0xff, 0xf6, 0x9, 0xff, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0x20, 0x3f,
-    0xff, 0xff, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0xff, 0xc0, 0x0, 0xcf, 0xff, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xf6, 0x0,
-    0x3, 0xff, 0xff, 0xff, 0xc3, 0x0, 0x0, 0x6f,
-    0xff, 0xff, 0xfd, 0x0, 0x0, 0x8, 0xff, 0xff,
-    0xff, 0xfe, 0xcc, 0xff, 0xff, 0xff, 0xff, 0x30,
-    0x0, 0x0, 0xb, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xdf, 0xff, 0xff,
-    0xff, 0xff, 0xfa, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x49, 0xce, 0xff, 0xeb, 0x72, 0x0,
-    0x0, 0x0, 0x0,
-
-    /* U+0050 "P" */
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xb7,
-    0x20, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xa2, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf4, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf3, 0x0, 0x7f, 0xff,
-    0xff, 0xdb, 0xbb, 0xbb, 0xcf, 0xff, 0xff, 0xff,
-    0xe0, 0x7, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0xff, 0xff, 0x70, 0x7f, 0xff, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xfd,
-    0x7, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xf1, 0x7f, 0xff, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0x37,
-    0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xff, 0xff, 0xf4, 0x7f, 0xff, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0x37, 0xff,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xf1, 0x7f, 0xff, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0xff, 0xfd, 0x7, 0xff, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0x3a, 0xff, 0xff, 0xff,
-    0x70, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe0, 0x7, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x0,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xd3, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x70, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xda, 0xaa, 0xaa, 0xa9, 0x63, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0051 "Q" */
-    0x0, 0x0, 0x0, 0x0, 0x49, 0xce, 0xff, 0xeb,
-    0x71, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xdf, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x40, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x40, 0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0xfe,
-    0xcd, 0xff, 0xff, 0xff, 0xff, 0x20, 0x0, 0x4,
-    0xff, 0xff, 0xff, 0xb3, 0x0, 0x0, 0x6f, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xf5, 0x0,
-    0x3f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xff, 0xff, 0xc0, 0x9, 0xff, 0xff, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xff,
-    0x20, 0xef, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0xff, 0xf6, 0x1f, 0xff, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff,
-    0xff, 0x93, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0xfb, 0x4f, 0xff,
-    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xd5, 0xff, 0xff, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xfd, 0x5f,
-    0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xe5, 0xff, 0xff, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xfd,
-    0x5f, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xd3, 0xff, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff,
-    0xfb, 0x1f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0xff, 0x90, 0xef, 0xff,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
-    0xff, 0xf6, 0x9, 0xff, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0x20, 0x3f,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0xff, 0xc0, 0x0, 0xcf, 0xff, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xf5, 0x0,
-    0x4, 0xff, 0xff, 0xff, 0xc3, 0x0, 0x0, 0x6f,
-    0xff, 0xff, 0xfd, 0x0, 0x0, 0x9, 0xff, 0xff,
-    0xff, 0xfe, 0xcc, 0xff, 0xff, 0xff, 0xff, 0x30,
-    0x0, 0x0, 0xb, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0xa,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xdf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfd, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x49, 0xce, 0xff, 0xef, 0xff, 0xff,
-    0xfe, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xff, 0xff, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2d,
-    0xff, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1b, 0xff, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0x50,
-    0x0,
-
-    /* U+0052 "R" */
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xa7,
-    0x10, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xa1, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xe3, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf2, 0x0, 0x7f, 0xff,
-    0xff, 0xdb, 0xbb, 0xbb, 0xdf, 0xff, 0xff, 0xff,
-    0xb0, 0x7, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0x2b, 0xff, 0xff, 0xff, 0x20, 0x7f, 0xff, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0xf7,
-    0x7, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xff, 0xff, 0x90, 0x7f, 0xff, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xfa, 0x7,
-    0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0x90, 0x7f, 0xff, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0xff, 0xf7, 0x7, 0xff,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0xff, 0x40, 0x7f, 0xff, 0xff, 0x60, 0x0, 0x0,
-    0x2, 0xbf, 0xff, 0xff, 0xe0, 0x7, 0xff, 0xff,
-    0xfd, 0xaa, 0xaa, 0xbc, 0xff, 0xff, 0xff, 0xf5,
-    0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x7, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xc1, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0x60, 0x0, 0xb, 0xff, 0xff, 0xf7,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xf6, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0x60, 0x0, 0x0, 0xbf, 0xff, 0xff, 0x70,
-    0x0, 0x7, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xfe, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0x60, 0x0, 0x0, 0xc, 0xff, 0xff, 0xf7, 0x0,
-    0x7, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0xff, 0xe0, 0x0, 0x7f, 0xff, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0x70, 0x7,
-    0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0xff, 0xfe, 0x0, 0x7f, 0xff, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xf7, 0x7, 0xff,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0xff, 0xe0, 0x7f, 0xff, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xff, 0xff, 0x70,
-
-    /* U+0053 "S" */
-    0x0, 0x0, 0x0, 0x16, 0xad, 0xff, 0xfe, 0xc8,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x1, 0xaf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xb2, 0x0, 0x0, 0x0,
-    0x4, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf5, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf5, 0x0, 0x0, 0xdf,
-    0xff, 0xff, 0xfe, 0xb9, 0xad, 0xff, 0xff, 0xff,
-    0xf1, 0x0, 0x5f, 0xff, 0xff, 0xf6, 0x0, 0x0,
-    0x4, 0xef, 0xff, 0xff, 0x80, 0xa, 0xff, 0xff,
-    0xf7, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xfe,
-    0x0, 0xcf, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0xd, 0xff, 0xff, 0xf1, 0xb, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x7c, 0xcc, 0xcc, 0x20,
-    0x9f, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xa1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0xff, 0xff, 0xfa, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1d, 0xff, 0xff, 0xff, 0xff,
-    0xe9, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1b,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xd6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xef, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5c, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0x7d, 0xff, 0xff,
-    0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0x9f, 0xff, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1c, 0xff,
-    0xff, 0xfb, 0x3, 0x44, 0x44, 0x41, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xf0, 0x9f, 0xff,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0xff, 0x27, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xff, 0xf3, 0x3f, 0xff, 0xff,
-    0xe1, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xff,
-    0x10, 0xdf, 0xff, 0xff, 0xd3, 0x0, 0x0, 0x1,
-    0xbf, 0xff, 0xff, 0xd0, 0x4, 0xff, 0xff, 0xff,
-    0xfe, 0xb9, 0xac, 0xff, 0xff, 0xff, 0xf7, 0x0,
-    0x6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfd, 0x0, 0x0, 0x5, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfd, 0x10, 0x0, 0x0,
-    0x1, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x15, 0x9d, 0xef,
-    0xfe, 0xc9, 0x50, 0x0, 0x0, 0x0,
-
-    /* U+0054 "T" */
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x2b, 0xbb, 0xbb, 0xbb, 0xbe, 0xff, 0xff, 0xfc,
-    0xbb, 0xbb, 0xbb, 0xbb, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+0055 "U" */
-    0xbf, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xff, 0x1b, 0xff, 0xff, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xf1, 0xbf,
-    0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xff, 0xff, 0x1b, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xf1, 0xbf, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff,
-    0xff, 0x1b, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0xff, 0xf1, 0xbf, 0xff, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff,
-    0x1b, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xff, 0xf1, 0xbf, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0x1b,
-    0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xff, 0xff, 0xf1, 0xbf, 0xff, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0x1b, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff,
-    0xff, 0xf1, 0xbf, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xff, 0xff, 0x1b, 0xff, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff,
-    0xf1, 0xbf, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0xff, 0x1b, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xf1,
-    0xbf, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xff, 0x1b, 0xff, 0xff, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xf1, 0xbf,
-    0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xff, 0xff, 0x1b, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xf1, 0x9f, 0xff,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff,
-    0xff, 0x7, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0xff, 0xd0, 0x3f, 0xff, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xf9,
-    0x0, 0xdf, 0xff, 0xff, 0xe4, 0x0, 0x0, 0x1a,
-    0xff, 0xff, 0xff, 0x20, 0x4, 0xff, 0xff, 0xff,
-    0xfe, 0xba, 0xcf, 0xff, 0xff, 0xff, 0xa0, 0x0,
-    0x8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xd1, 0x0, 0x0, 0x8, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xd1, 0x0, 0x0, 0x0,
-    0x4, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x38, 0xce, 0xff,
-    0xfd, 0xa5, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0056 "V" */
-    0xbf, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0xff, 0xfd, 0x5, 0xff, 0xff,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xff, 0xff, 0x80, 0xf, 0xff, 0xff, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xf2,
-    0x0, 0xaf, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0xff, 0xfd, 0x0, 0x5, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0xff, 0xff, 0x70, 0x0, 0xf, 0xff, 0xff, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0xaf, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x5,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xff, 0xff, 0x70, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0x60, 0x0,
-    0x0, 0x4, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0xe, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0xd, 0xff, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0x40,
-    0x0, 0x2, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xff, 0xff, 0xd0, 0x0, 0xb, 0xff, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff,
-    0x20, 0x0, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0xf6, 0x0, 0x5f,
-    0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xff, 0xff, 0xb0, 0x9, 0xff, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
-    0xff, 0x0, 0xef, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf4, 0x3f,
-    0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xff, 0xff, 0x97, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0xfe, 0xcf, 0xff, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xff, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0057 "W" */
-    0x3f, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x8f, 0xff,
-    0xff, 0x40, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0xff, 0xf0, 0xc, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0xff, 0x90, 0x0, 0x0,
-    0x0, 0xef, 0xff, 0xfd, 0x0, 0x8f, 0xff, 0xff,
-    0x20, 0x0, 0x0, 0xc, 0xff, 0xff, 0xfd, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0x90, 0x5, 0xff,
-    0xff, 0xf5, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xf6, 0x0,
-    0x1f, 0xff, 0xff, 0x80, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0x40, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0x20, 0x0, 0xef, 0xff, 0xfb, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0xa, 0xff,
-    0xff, 0xf0, 0x0, 0xa, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0xaf, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0xdf, 0xff, 0xfb, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0x10, 0x0, 0xe, 0xff, 0xff, 0xff, 0xff, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0x80, 0x0, 0x3, 0xff,
-    0xff, 0xf4, 0x0, 0x2, 0xff, 0xff, 0xff, 0xff,
-    0xf3, 0x0, 0x4, 0xff, 0xff, 0xf4, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0x80, 0x0, 0x6f, 0xff, 0xfb,
-    0xff, 0xff, 0x70, 0x0, 0x7f, 0xff, 0xff, 0x10,
-    0x0, 0x0, 0xdf, 0xff, 0xfb, 0x0, 0x9, 0xff,
-    0xff, 0x4f, 0xff, 0xfa, 0x0, 0xa, 0xff, 0xff,
-    0xd0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xe0, 0x0,
-    0xdf, 0xff, 0xe0, 0xdf, 0xff, 0xe0, 0x0, 0xdf,
-    0xff, 0xfa, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff,
-    0x10, 0x1f, 0xff, 0xfa, 0xa, 0xff, 0xff, 0x20,
-    0xf, 0xff, 0xff, 0x60, 0x0, 0x0, 0x2, 0xff,
-    0xff, 0xf4, 0x4, 0xff, 0xff, 0x60, 0x6f, 0xff,
-    0xf6, 0x3, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0,
-    0xe, 0xff, 0xff, 0x70, 0x8f, 0xff, 0xf2, 0x2,
-    0xff, 0xff, 0x90, 0x6f, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xff, 0xfa, 0xc, 0xff, 0xfe,
-    0x0, 0xe, 0xff, 0xfd, 0x9, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xd0, 0xff,
-    0xff, 0xb0, 0x0, 0xaf, 0xff, 0xf1, 0xcf, 0xff,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff,
-    0x4f, 0xff, 0xf7, 0x0, 0x6, 0xff, 0xff, 0x5f,
-    0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xfb, 0xff, 0xff, 0x30, 0x0, 0x2f, 0xff,
-    0xfb, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0xef, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xff, 0xff, 0xff, 0xfb, 0x0,
-    0x0, 0xa, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0xff,
-    0x70, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xff, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xff, 0xf3, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0xe, 0xff,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0xbf, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
-    0x20, 0x0, 0x0, 0x0,
-
-    /* U+0058 "X" */
-    0x2f, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xff, 0x70, 0x8f, 0xff, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff,
-    0xd0, 0x0, 0xef, 0xff, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xff, 0xf5, 0x0, 0x5, 0xff,
-    0xff, 0xff, 0x30, 0x0, 0x0, 0xc, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0xc, 0xff, 0xff, 0xfb, 0x0,
-    0x0, 0x4, 0xff, 0xff, 0xff, 0x30, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xf4, 0x0, 0x0, 0xdf, 0xff,
-    0xff, 0x90, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff,
-    0xc0, 0x0, 0x5f, 0xff, 0xff, 0xf1, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0x50, 0xd, 0xff,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xfd, 0x6, 0xff, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0xf7, 0xef,
-    0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff,
-    0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
-    0xff, 0xff, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0xff, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xff, 0xff,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xf4, 0xdf, 0xff, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xfc,
-    0x5, 0xff, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xff, 0x30, 0xc, 0xff, 0xff,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff,
-    0xa0, 0x0, 0x4f, 0xff, 0xff, 0xf3, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0xbf,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0xe, 0xff, 0xff,
-    0xf9, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0x50,
-    0x0, 0x8, 0xff, 0xff, 0xff, 0x10, 0x0, 0x0,
-    0xa, 0xff, 0xff, 0xfe, 0x0, 0x2, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0xf8, 0x0, 0xbf, 0xff, 0xff, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0xff, 0xf2, 0x4f, 0xff,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xff, 0xb0,
-
-    /* U+0059 "Y" */
-    0xbf, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xff, 0xff, 0x73, 0xff, 0xff, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff,
-    0xe0, 0xb, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0xff, 0xf7, 0x0, 0x2f, 0xff,
-    0xff, 0xf1, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0xaf, 0xff, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0xbf, 0xff, 0xff, 0x60, 0x0, 0x2,
-    0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xf5,
-    0x0, 0x0, 0x9, 0xff, 0xff, 0xf6, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0xff, 0xd0, 0x0, 0x1, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff,
-    0xff, 0x40, 0x0, 0x7f, 0xff, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0xfb, 0x0, 0xe,
-    0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0xff, 0xf2, 0x6, 0xff, 0xff, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0x90,
-    0xdf, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0xff, 0x6f, 0xff, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
-    0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0,
-
-    /* U+005A "Z" */
-    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfd, 0x8, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x8f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfd, 0x8, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x6b, 0xbb,
-    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xdf, 0xff, 0xff,
-    0xe1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0xff, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xef, 0xff, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0xff, 0xe1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1e, 0xff, 0xff, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
-    0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xff, 0xfe, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xe1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0xff,
-    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x17,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf1, 0x9f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x19, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf1, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x10,
-
-    /* U+005B "[" */
-    0x34, 0x44, 0x44, 0x44, 0x3a, 0xff, 0xff, 0xff,
-    0xfc, 0xaf, 0xff, 0xff, 0xff, 0xca, 0xff, 0xff,
-    0xff, 0xfc, 0xaf, 0xff, 0xff, 0xff, 0xca, 0xff,
-    0xff, 0xf0, 0x0, 0xaf, 0xff, 0xff, 0x0, 0xa,
-    0xff, 0xff, 0xf0, 0x0, 0xaf, 0xff, 0xff, 0x0,
-    0xa, 0xff, 0xff, 0xf0, 0x0, 0xaf, 0xff, 0xff,
-    0x0, 0xa, 0xff, 0xff, 0xf0, 0x0, 0xaf, 0xff,
-    0xff, 0x0, 0xa, 0xff, 0xff, 0xf0, 0x0, 0xaf,
-    0xff, 0xff, 0x0, 0xa, 0xff, 0xff, 0xf0, 0x0,
-    0xaf, 0xff, 0xff, 0x0, 0xa, 0xff, 0xff, 0xf0,
-    0x0, 0xaf, 0xff, 0xff, 0x0, 0xa, 0xff, 0xff,
-    0xf0, 0x0, 0xaf, 0xff, 0xff, 0x0, 0xa, 0xff,
-    0xff, 0xf0, 0x0, 0xaf, 0xff, 0xff, 0x0, 0xa,
-    0xff, 0xff, 0xf0, 0x0, 0xaf, 0xff, 0xff, 0x0,
-    0xa, 0xff, 0xff, 0xf0, 0x0, 0xaf, 0xff, 0xff,
-    0x0, 0xa, 0xff, 0xff, 0xf0, 0x0, 0xaf, 0xff,
-    0xff, 0x0, 0xa, 0xff, 0xff, 0xf0, 0x0, 0xaf,
-    0xff, 0xff, 0x0, 0xa, 0xff, 0xff, 0xf0, 0x0,
-    0xaf, 0xff, 0xff, 0x0, 0xa, 0xff, 0xff, 0xf0,
-    0x0, 0xaf, 0xff, 0xff, 0x0, 0xa, 0xff, 0xff,
-    0xf0, 0x0, 0xaf, 0xff, 0xff, 0x44, 0x3a, 0xff,
-    0xff, 0xff, 0xfc, 0xaf, 0xff, 0xff, 0xff, 0xca,
-    0xff, 0xff, 0xff, 0xfc, 0xaf, 0xff, 0xff, 0xff,
-    0xc0,
-
-    /* U+005C "\\" */
-    0xd, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0xff, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0xff, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0x88, 0x88, 0x84,
-
-    /* U+005D "]" */
-    0x34, 0x44, 0x44, 0x44, 0x3c, 0xff, 0xff, 0xff,
-    0xfa, 0xcf, 0xff, 0xff, 0xff, 0xac, 0xff, 0xff,
-    0xff, 0xfa, 0xcf, 0xff, 0xff, 0xff, 0xa0, 0x0,
-    0xff, 0xff, 0xfa, 0x0, 0xf, 0xff, 0xff, 0xa0,
-    0x0, 0xff, 0xff, 0xfa, 0x0, 0xf, 0xff, 0xff,
-    0xa0, 0x0, 0xff, 0xff, 0xfa, 0x0, 0xf, 0xff,
-    0xff, 0xa0, 0x0, 0xff, 0xff, 0xfa, 0x0, 0xf,
-    0xff, 0xff, 0xa0, 0x0, 0xff, 0xff, 0xfa, 0x0,
-    0xf, 0xff, 0xff, 0xa0, 0x0, 0xff, 0xff, 0xfa,
-    0x0, 0xf, 0xff, 0xff, 0xa0, 0x0, 0xff, 0xff,
-    0xfa, 0x0, 0xf, 0xff, 0xff, 0xa0, 0x0, 0xff,
-    0xff, 0xfa, 0x0, 0xf, 0xff, 0xff, 0xa0, 0x0,
-    0xff, 0xff, 0xfa, 0x0, 0xf, 0xff, 0xff, 0xa0,
-    0x0, 0xff, 0xff, 0xfa, 0x0, 0xf, 0xff, 0xff,
-    0xa0, 0x0, 0xff, 0xff, 0xfa, 0x0, 0xf, 0xff,
-    0xff, 0xa0, 0x0, 0xff, 0xff, 0xfa, 0x0, 0xf,
-    0xff, 0xff, 0xa0, 0x0, 0xff, 0xff, 0xfa, 0x0,
-    0xf, 0xff, 0xff, 0xa0, 0x0, 0xff, 0xff, 0xfa,
-    0x0, 0xf, 0xff, 0xff, 0xa0, 0x0, 0xff, 0xff,
-    0xfa, 0x0, 0xf, 0xff, 0xff, 0xa0, 0x0, 0xff,
-    0xff, 0xfa, 0x34, 0x4f, 0xff, 0xff, 0xac, 0xff,
-    0xff, 0xff, 0xfa, 0xcf, 0xff, 0xff, 0xff, 0xac,
-    0xff, 0xff, 0xff, 0xfa, 0xcf, 0xff, 0xff, 0xff,
-    0xa0,
-
-    /* U+005E "^" */
-    0x0, 0x0, 0x0, 0x38, 0x88, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0x8e,
-    0xff, 0xf4, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xf2,
-    0x9f, 0xff, 0xa0, 0x0, 0x0, 0x8, 0xff, 0xfc,
-    0x3, 0xff, 0xff, 0x10, 0x0, 0x0, 0xef, 0xff,
-    0x60, 0xd, 0xff, 0xf7, 0x0, 0x0, 0x5f, 0xff,
-    0xf0, 0x0, 0x7f, 0xff, 0xd0, 0x0, 0xb, 0xff,
-    0xfa, 0x0, 0x1, 0xff, 0xff, 0x40, 0x2, 0xff,
-    0xff, 0x40, 0x0, 0xb, 0xff, 0xfa, 0x0, 0x8f,
-    0xff, 0xe0, 0x0, 0x0, 0x5f, 0xff, 0xf1, 0xe,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0xef, 0xff, 0x70,
-
-    /* U+005F "_" */
-    0x56, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
-    0x64, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfc,
-
-    /* U+0060 "`" */
-    0x22, 0x22, 0x22, 0x0, 0x0, 0x5, 0xff, 0xff,
-    0xf9, 0x0, 0x0, 0x7, 0xff, 0xff, 0xf3, 0x0,
-    0x0, 0x9, 0xff, 0xff, 0xd0, 0x0, 0x0, 0xb,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0xc, 0xff, 0xff,
-    0x20, 0x0, 0x0, 0x1e, 0xff, 0xfb, 0x0,
-
-    /* U+0061 "a" */
-    0x0, 0x0, 0x4, 0x9c, 0xff, 0xfd, 0xb6, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xcf, 0xff, 0xff, 0xff,
-    0xff, 0xe5, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x60, 0x0, 0x3, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x0,
-    0xb, 0xff, 0xff, 0xfa, 0x32, 0x4b, 0xff, 0xff,
-    0xfb, 0x0, 0x1f, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0xdf, 0xff, 0xff, 0x0, 0x2c, 0xcc, 0xcc, 0x50,
-    0x0, 0x0, 0x8f, 0xff, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x1, 0x34, 0x44, 0x9f, 0xff,
-    0xff, 0x40, 0x0, 0x0, 0x6b, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x40, 0x0, 0x3e, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0x4, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40,
-    0xe, 0xff, 0xff, 0xf9, 0x30, 0x0, 0x6f, 0xff,
-    0xff, 0x40, 0x6f, 0xff, 0xff, 0x70, 0x0, 0x0,
-    0x6f, 0xff, 0xff, 0x40, 0x9f, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0xff, 0x40, 0xbf, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0x40,
-    0xaf, 0xff, 0xff, 0x40, 0x0, 0x3, 0xef, 0xff,
-    0xff, 0x40, 0x6f, 0xff, 0xff, 0xf8, 0x55, 0xaf,
-    0xff, 0xff, 0xff, 0x40, 0x1e, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0x5, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0x60,
-    0x0, 0x5e, 0xff, 0xff, 0xff, 0xfc, 0x2f, 0xff,
-    0xff, 0x90, 0x0, 0x1, 0x7c, 0xff, 0xeb, 0x50,
-    0xc, 0xff, 0xff, 0xe0,
-
-    /* U+0062 "b" */
-    0xdf, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xff, 0xfd, 0x2, 0x9d, 0xff, 0xda, 0x30,
-    0x0, 0x0, 0xdf, 0xff, 0xfd, 0x6f, 0xff, 0xff,
-    0xff, 0xfa, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xb0, 0x0, 0xdf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x0,
-    0xdf, 0xff, 0xff, 0xfe, 0x98, 0x9e, 0xff, 0xff,
-    0xff, 0x10, 0xdf, 0xff, 0xff, 0xb0, 0x0, 0x1,
-    0xdf, 0xff, 0xff, 0x60, 0xdf, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xb0, 0xdf, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0xe0,
-    0xdf, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x9, 0xff,
-    0xff, 0xf0, 0xdf, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xf2, 0xdf, 0xff, 0xfd, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xf2, 0xdf, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xf2,
-    0xdf, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xf2, 0xdf, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0xff, 0xf0, 0xdf, 0xff, 0xfd, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xe0, 0xdf, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xb0,
-    0xdf, 0xff, 0xff, 0xb0, 0x0, 0x0, 0xcf, 0xff,
-    0xff, 0x60, 0xdf, 0xff, 0xff, 0xfe, 0xa8, 0x9e,
-    0xff, 0xff, 0xff, 0x0, 0xdf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf7, 0x0, 0xdf, 0xff,
-    0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x0,
-    0xdf, 0xff, 0xf6, 0x6f, 0xff, 0xff, 0xff, 0xfa,
-    0x0, 0x0, 0xdf, 0xff, 0xf4, 0x2, 0x9d, 0xff,
-    0xda, 0x30, 0x0, 0x0,
-
-    /* U+0063 "c" */
-    0x0, 0x0, 0x1, 0x7b, 0xef, 0xfe, 0xb6, 0x10,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x60, 0x0, 0x0, 0xb, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x90, 0x0, 0x9, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x60, 0x3, 0xff,
-    0xff, 0xff, 0xb8, 0x8d, 0xff, 0xff, 0xfe, 0x0,
-    0xbf, 0xff, 0xff, 0x50, 0x0, 0x9, 0xff, 0xff,
-    0xf5, 0x1f, 0xff, 0xff, 0xa0, 0x0, 0x0, 0xe,
-    0xff, 0xff, 0x95, 0xff, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0xfb, 0x8f, 0xff, 0xff, 0x10,
-    0x0, 0x0, 0x2, 0x44, 0x44, 0x3a, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff,
-    0x40, 0x0, 0x0, 0x6, 0xbb, 0xbb, 0x91, 0xff,
-    0xff, 0xfa, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xfa,
-    0xb, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0x60, 0x3f, 0xff, 0xff, 0xfb, 0x88, 0xcf,
-    0xff, 0xff, 0xf1, 0x0, 0x9f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf6, 0x0, 0x0, 0xaf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xe5, 0x0, 0x0,
-    0x0, 0x0, 0x17, 0xbe, 0xff, 0xeb, 0x60, 0x0,
-    0x0,
-
-    /* U+0064 "d" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xf5,
-    0x0, 0x0, 0x6, 0xbe, 0xfe, 0xb5, 0x5, 0xff,
-    0xff, 0xf5, 0x0, 0x3, 0xdf, 0xff, 0xff, 0xff,
-    0xb6, 0xff, 0xff, 0xf5, 0x0, 0x2f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x0, 0xdf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5,
-    0x6, 0xff, 0xff, 0xff, 0xd8, 0x8c, 0xff, 0xff,
-    0xff, 0xf5, 0xd, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x5f, 0xff, 0xff, 0xf5, 0x2f, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x8, 0xff, 0xff, 0xf5, 0x6f, 0xff,
-    0xff, 0x60, 0x0, 0x0, 0x5, 0xff, 0xff, 0xf5,
-    0x8f, 0xff, 0xff, 0x20, 0x0, 0x0, 0x5, 0xff,
-    0xff, 0xf5, 0xaf, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xff, 0xf5, 0xaf, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xff, 0xf5, 0xaf, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xf5,
-    0xaf, 0xff, 0xff, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xff, 0xf5, 0x8f, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x5, 0xff, 0xff, 0xf5, 0x6f, 0xff, 0xff, 0x50,
-    0x0, 0x0, 0x5, 0xff, 0xff, 0xf5, 0x2f, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xf5,
-    0xd, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x5f, 0xff,
-    0xff, 0xf5, 0x6, 0xff, 0xff, 0xff, 0xc9, 0x9c,
-    0xff, 0xff, 0xff, 0xf5, 0x0, 0xdf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x0, 0x2e,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xf5,
-    0x0, 0x2, 0xdf, 0xff, 0xff, 0xff, 0xb1, 0xef,
-    0xff, 0xf5, 0x0, 0x0, 0x6, 0xbe, 0xfe, 0xb5,
-    0x0, 0xdf, 0xff, 0xf5,
-
-    /* U+0065 "e" */
-    0x0, 0x0, 0x0, 0x5a, 0xdf, 0xfe, 0xc8, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x4d, 0xff, 0xff, 0xff,
-    0xff, 0xf9, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x5f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x0,
-    0x1, 0xef, 0xff, 0xff, 0xd8, 0x8a, 0xff, 0xff,
-    0xff, 0x40, 0x8, 0xff, 0xff, 0xfa, 0x0, 0x0,
-    0x2e, 0xff, 0xff, 0xb0, 0xe, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x6, 0xff, 0xff, 0xf1, 0x3f, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0xff, 0xff, 0xf4,
-    0x6f, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xf7, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf8, 0x9f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x9f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9,
-    0x9f, 0xff, 0xff, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
-    0xdd, 0xd8, 0x7f, 0xff, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x1, 0x80, 0x0,
-    0x8, 0xff, 0xff, 0xfe, 0x30, 0x0, 0x0, 0x4d,
-    0xfa, 0x0, 0x1, 0xef, 0xff, 0xff, 0xfc, 0x88,
-    0x9d, 0xff, 0xff, 0x90, 0x0, 0x4f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x4,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x10,
-    0x0, 0x0, 0x2b, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x38, 0xce, 0xff,
-    0xeb, 0x71, 0x0, 0x0,
-
-    /* U+0066 "f" */
-    0x0, 0x0, 0x0, 0x3, 0x9d, 0xff, 0xfc, 0x30,
-    0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0xf5, 0x0,
-    0x0, 0xb, 0xff, 0xff, 0xff, 0xff, 0x50, 0x0,
-    0x6, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x0, 0x0,
-    0xdf, 0xff, 0xff, 0xfa, 0x89, 0x30, 0x0, 0x1f,
-    0xff, 0xff, 0xe2, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff,
-    0xf5, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x90, 0x7f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf9, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x90, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf9, 0x0, 0x11, 0x5f, 0xff, 0xff, 0x61, 0x11,
-    0x0, 0x0, 0x5, 0xff, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0x50, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xff, 0xf5, 0x0, 0x0,
-    0x0,
-
-    /* U+0067 "g" */
-    0x0, 0x0, 0x4, 0xae, 0xff, 0xd9, 0x20, 0x7f,
-    0xff, 0xfa, 0x0, 0x1, 0xbf, 0xff, 0xff, 0xff,
-    0xf7, 0x9f, 0xff, 0xfa, 0x0, 0x1d, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x0, 0xbf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
-    0x4, 0xff, 0xff, 0xff, 0xe9, 0x8a, 0xef, 0xff,
-    0xff, 0xfa, 0xb, 0xff, 0xff, 0xfb, 0x0, 0x0,
-    0x1b, 0xff, 0xff, 0xfa, 0x1f, 0xff, 0xff, 0xe1,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xfa, 0x5f, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0xff, 0xff, 0xfa,
-    0x7f, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xfa, 0x9f, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xfa, 0xaf, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xfa, 0xaf, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xfa,
-    0x9f, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xfa, 0x7f, 0xff, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xfa, 0x5f, 0xff, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xfa, 0x1f, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xfa,
-    0xb, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x1b, 0xff,
-    0xff, 0xfa, 0x3, 0xff, 0xff, 0xff, 0xe9, 0x8a,
-    0xff, 0xff, 0xff, 0xfa, 0x0, 0xaf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x0, 0xc,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
-    0x0, 0x1, 0xaf, 0xff, 0xff, 0xff, 0xf4, 0xff,
-    0xff, 0xfa, 0x0, 0x0, 0x4, 0xae, 0xff, 0xd8,
-    0x10, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0xf8, 0x0, 0x1,
-    0x50, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xf5,
-    0x0, 0xc, 0xf8, 0x0, 0x0, 0x0, 0x5f, 0xff,
-    0xff, 0xf1, 0x0, 0x8f, 0xff, 0xe9, 0x65, 0x7b,
-    0xff, 0xff, 0xff, 0x80, 0x2, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd1, 0x0,
-    0x0, 0x4, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0x9c, 0xff, 0xfd,
-    0xb6, 0x10, 0x0, 0x0,
-
-    /* U+0068 "h" */
-    0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xfa, 0x0,
-    0x6c, 0xff, 0xeb, 0x60, 0x0, 0xf, 0xff, 0xff,
-    0xa1, 0xcf, 0xff, 0xff, 0xff, 0xd2, 0x0, 0xff,
-    0xff, 0xfc, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xd0,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x70, 0xff, 0xff, 0xff, 0xfd, 0x98, 0xaf,
-    0xff, 0xff, 0xfd, 0xf, 0xff, 0xff, 0xf9, 0x0,
-    0x0, 0x2f, 0xff, 0xff, 0xf1, 0xff, 0xff, 0xfd,
-    0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0x3f, 0xff,
-    0xff, 0xa0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xf4,
-    0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x5f, 0xff,
-    0xff, 0x5f, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x5,
-    0xff, 0xff, 0xf5, 0xff, 0xff, 0xfa, 0x0, 0x0,
-    0x0, 0x5f, 0xff, 0xff, 0x5f, 0xff, 0xff, 0xa0,
-    0x0, 0x0, 0x5, 0xff, 0xff, 0xf5, 0xff, 0xff,
-    0xfa, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0x5f,
-    0xff, 0xff, 0xa0, 0x0, 0x0, 0x5, 0xff, 0xff,
-    0xf5, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x5f,
-    0xff, 0xff, 0x5f, 0xff, 0xff, 0xa0, 0x0, 0x0,
-    0x5, 0xff, 0xff, 0xf5, 0xff, 0xff, 0xfa, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0xff, 0x5f, 0xff, 0xff,
-    0xa0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xf5, 0xff,
-    0xff, 0xfa, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff,
-    0x5f, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x5, 0xff,
-    0xff, 0xf5, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0xff, 0x5f, 0xff, 0xff, 0xa0, 0x0,
-    0x0, 0x5, 0xff, 0xff, 0xf5,
-
-    /* U+0069 "i" */
-    0x8, 0xef, 0xc4, 0x8, 0xff, 0xff, 0xf2, 0xdf,
-    0xff, 0xff, 0x6c, 0xff, 0xff, 0xf5, 0x5f, 0xff,
-    0xfe, 0x0, 0x5b, 0xc9, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0x28,
-    0xff, 0xff, 0xf2, 0x8f, 0xff, 0xff, 0x28, 0xff,
-    0xff, 0xf2, 0x8f, 0xff, 0xff, 0x28, 0xff, 0xff,
-    0xf2, 0x8f, 0xff, 0xff, 0x28, 0xff, 0xff, 0xf2,
-    0x8f, 0xff, 0xff, 0x28, 0xff, 0xff, 0xf2, 0x8f,
-    0xff, 0xff, 0x28, 0xff, 0xff, 0xf2, 0x8f, 0xff,
-    0xff, 0x28, 0xff, 0xff, 0xf2, 0x8f, 0xff, 0xff,
-    0x28, 0xff, 0xff, 0xf2, 0x8f, 0xff, 0xff, 0x28,
-    0xff, 0xff, 0xf2, 0x8f, 0xff, 0xff, 0x28, 0xff,
-    0xff, 0xf2, 0x8f, 0xff, 0xff, 0x28, 0xff, 0xff,
-    0xf2,
-
-    /* U+006A "j" */
-    0x0, 0x0, 0x9, 0xef, 0xc3, 0x0, 0x0, 0x9,
-    0xff, 0xff, 0xe1, 0x0, 0x0, 0xef, 0xff, 0xff,
-    0x50, 0x0, 0xd, 0xff, 0xff, 0xf4, 0x0, 0x0,
-    0x7f, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x5b, 0xc8,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
-    0xff, 0x20, 0x0, 0x8, 0xff, 0xff, 0xf2, 0x0,
-    0x0, 0x8f, 0xff, 0xff, 0x20, 0x0, 0x8, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x8f, 0xff, 0xff, 0x20,
-    0x0, 0x8, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x8f,
-    0xff, 0xff, 0x20, 0x0, 0x8, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x8f, 0xff, 0xff, 0x20, 0x0, 0x8,
-    0xff, 0xff, 0xf2, 0x0, 0x0, 0x8f, 0xff, 0xff,
-    0x20, 0x0, 0x8, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0x8f, 0xff, 0xff, 0x20, 0x0, 0x8, 0xff, 0xff,
-    0xf2, 0x0, 0x0, 0x8f, 0xff, 0xff, 0x20, 0x0,
-    0x8, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x8f, 0xff,
-    0xff, 0x20, 0x0, 0x8, 0xff, 0xff, 0xf2, 0x0,
-    0x0, 0x8f, 0xff, 0xff, 0x20, 0x0, 0x8, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x8f, 0xff, 0xff, 0x20,
-    0x0, 0x8, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x8f,
-    0xff, 0xff, 0x20, 0x0, 0x9, 0xff, 0xff, 0xf1,
-    0x0, 0x1, 0xef, 0xff, 0xff, 0xa, 0x9a, 0xef,
-    0xff, 0xff, 0xb0, 0xff, 0xff, 0xff, 0xff, 0xf5,
-    0xf, 0xff, 0xff, 0xff, 0xfb, 0x0, 0xff, 0xff,
-    0xff, 0xfb, 0x0, 0xb, 0xef, 0xfd, 0xa4, 0x0,
-    0x0,
-
-    /* U+006B "k" */
-    0xdf, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xff, 0xfd, 0x0, 0x0, 0x1, 0xef, 0xff,
-    0xff, 0xb0, 0xdf, 0xff, 0xfd, 0x0, 0x0, 0xd,
-    0xff, 0xff, 0xfd, 0x0, 0xdf, 0xff, 0xfd, 0x0,
-    0x0, 0xaf, 0xff, 0xff, 0xe1, 0x0, 0xdf, 0xff,
-    0xfd, 0x0, 0x7, 0xff, 0xff, 0xff, 0x30, 0x0,
-    0xdf, 0xff, 0xfd, 0x0, 0x5f, 0xff, 0xff, 0xf5,
-    0x0, 0x0, 0xdf, 0xff, 0xfd, 0x2, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0xdf, 0xff, 0xfd, 0x1e,
-    0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0xfd, 0xbf, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0xdf, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x10, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xe1, 0x0, 0x0, 0x0,
-    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0xff, 0xf8, 0xef, 0xff,
-    0xff, 0x40, 0x0, 0x0, 0xdf, 0xff, 0xff, 0x80,
-    0x5f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0xdf, 0xff,
-    0xfd, 0x0, 0xb, 0xff, 0xff, 0xf9, 0x0, 0x0,
-    0xdf, 0xff, 0xfd, 0x0, 0x1, 0xff, 0xff, 0xff,
-    0x30, 0x0, 0xdf, 0xff, 0xfd, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xd0, 0x0, 0xdf, 0xff, 0xfd, 0x0,
-    0x0, 0xd, 0xff, 0xff, 0xf8, 0x0, 0xdf, 0xff,
-    0xfd, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0x30,
-    0xdf, 0xff, 0xfd, 0x0, 0x0, 0x0, 0xaf, 0xff,
-    0xff, 0xc0, 0xdf, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0x1e, 0xff, 0xff, 0xf7,
-
-    /* U+006C "l" */
-    0x8f, 0xff, 0xff, 0x28, 0xff, 0xff, 0xf2, 0x8f,
-    0xff, 0xff, 0x28, 0xff, 0xff, 0xf2, 0x8f, 0xff,
-    0xff, 0x28, 0xff, 0xff, 0xf2, 0x8f, 0xff, 0xff,
-    0x28, 0xff, 0xff, 0xf2, 0x8f, 0xff, 0xff, 0x28,
-    0xff, 0xff, 0xf2, 0x8f, 0xff, 0xff, 0x28, 0xff,
-    0xff, 0xf2, 0x8f, 0xff, 0xff, 0x28, 0xff, 0xff,
-    0xf2, 0x8f, 0xff, 0xff, 0x28, 0xff, 0xff, 0xf2,
-    0x8f, 0xff, 0xff, 0x28, 0xff, 0xff, 0xf2, 0x8f,
-    0xff, 0xff, 0x28, 0xff, 0xff, 0xf2, 0x8f, 0xff,
-    0xff, 0x28, 0xff, 0xff, 0xf2, 0x8f, 0xff, 0xff,
-    0x28, 0xff, 0xff, 0xf2, 0x8f, 0xff, 0xff, 0x28,
-    0xff, 0xff, 0xf2, 0x8f, 0xff, 0xff, 0x28, 0xff,
-    0xff, 0xf2, 0x8f, 0xff, 0xff, 0x28, 0xff, 0xff,
-    0xf2,
-
-    /* U+006D "m" */
-    0xdf, 0xff, 0xf8, 0x0, 0x6b, 0xef, 0xfc, 0x81,
-    0x0, 0x0, 0x6b, 0xef, 0xfd, 0x81, 0x0, 0xd,
-    0xff, 0xff, 0x92, 0xdf, 0xff, 0xff, 0xff, 0xe2,
-    0x2, 0xdf, 0xff, 0xff, 0xff, 0xf4, 0x0, 0xdf,
-    0xff, 0xfc, 0xef, 0xff, 0xff, 0xff, 0xff, 0xd3,
-    0xef, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xd, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0xdf, 0xff,
-    0xff, 0xfe, 0x98, 0xaf, 0xff, 0xff, 0xff, 0xff,
-    0xa8, 0x9e, 0xff, 0xff, 0xff, 0xd, 0xff, 0xff,
-    0xf9, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xfe, 0x20,
-    0x0, 0xc, 0xff, 0xff, 0xf4, 0xdf, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0x50, 0x0,
-    0x0, 0x5f, 0xff, 0xff, 0x6d, 0xff, 0xff, 0xd0,
-    0x0, 0x0, 0x8, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xf7, 0xdf, 0xff, 0xfd, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0x7d, 0xff, 0xff, 0xd0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x2,
-    0xff, 0xff, 0xf7, 0xdf, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0x20, 0x0, 0x0, 0x2f,
-    0xff, 0xff, 0x7d, 0xff, 0xff, 0xd0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x2, 0xff,
-    0xff, 0xf7, 0xdf, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0x20, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0x7d, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xf2, 0x0, 0x0, 0x2, 0xff, 0xff,
-    0xf7, 0xdf, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0x20, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0x7d, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x2, 0xff, 0xff, 0xf7,
-    0xdf, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0x2f, 0xff, 0xff, 0x7d,
-    0xff, 0xff, 0xd0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xf2, 0x0, 0x0, 0x2, 0xff, 0xff, 0xf7, 0xdf,
-    0xff, 0xfd, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0x20, 0x0, 0x0, 0x2f, 0xff, 0xff, 0x7d, 0xff,
-    0xff, 0xd0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0xf7, 0xdf, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0x2f, 0xff, 0xff, 0x7d, 0xff, 0xff,
-    0xd0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xf2, 0x0,
-    0x0, 0x2, 0xff, 0xff, 0xf7,
-
-    /* U+006E "n" */
-    0xef, 0xff, 0xf6, 0x0, 0x6b, 0xef, 0xfc, 0x81,
-    0x0, 0xe, 0xff, 0xff, 0x72, 0xdf, 0xff, 0xff,
-    0xff, 0xe3, 0x0, 0xef, 0xff, 0xfb, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe1, 0xe, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0xef, 0xff,
-    0xff, 0xfd, 0x98, 0xaf, 0xff, 0xff, 0xfe, 0xe,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x1e, 0xff, 0xff,
-    0xf1, 0xef, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x8f,
-    0xff, 0xff, 0x3e, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x5, 0xff, 0xff, 0xf4, 0xef, 0xff, 0xfb, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0xff, 0x5e, 0xff, 0xff,
-    0xb0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xf5, 0xef,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff,
-    0x5e, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x5, 0xff,
-    0xff, 0xf5, 0xef, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0xff, 0x5e, 0xff, 0xff, 0xb0, 0x0,
-    0x0, 0x5, 0xff, 0xff, 0xf5, 0xef, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0x5e, 0xff,
-    0xff, 0xb0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xf5,
-    0xef, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x5f, 0xff,
-    0xff, 0x5e, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x5,
-    0xff, 0xff, 0xf5, 0xef, 0xff, 0xfb, 0x0, 0x0,
-    0x0, 0x5f, 0xff, 0xff, 0x5e, 0xff, 0xff, 0xb0,
-    0x0, 0x0, 0x5, 0xff, 0xff, 0xf5, 0xef, 0xff,
-    0xfb, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0x5e,
-    0xff, 0xff, 0xb0, 0x0, 0x0, 0x5, 0xff, 0xff,
-    0xf5,
-
-    /* U+006F "o" */
-    0x0, 0x0, 0x0, 0x5a, 0xdf, 0xfe, 0xc8, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xef, 0xff, 0xff,
-    0xff, 0xff, 0xb1, 0x0, 0x0, 0x0, 0x8, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xe1, 0x0, 0x2, 0xff, 0xff, 0xff, 0xd8, 0x8a,
-    0xff, 0xff, 0xff, 0xb0, 0x0, 0xaf, 0xff, 0xff,
-    0x90, 0x0, 0x2, 0xef, 0xff, 0xff, 0x30, 0x1f,
-    0xff, 0xff, 0xd0, 0x0, 0x0, 0x4, 0xff, 0xff,
-    0xfa, 0x5, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0xd, 0xff, 0xff, 0xe0, 0x8f, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0x2a, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff,
-    0xf4, 0xbf, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0xff, 0x4b, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xff, 0xf4, 0xaf, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff,
-    0x38, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xff, 0xf2, 0x5f, 0xff, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0xfe, 0x0, 0xff, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xa0,
-    0xa, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x2e, 0xff,
-    0xff, 0xf3, 0x0, 0x2f, 0xff, 0xff, 0xfd, 0x98,
-    0xaf, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x10, 0x0,
-    0x0, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x30, 0x0, 0x0, 0x0, 0x5e, 0xff, 0xff, 0xff,
-    0xff, 0xfb, 0x10, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xad, 0xff, 0xfc, 0x93, 0x0, 0x0, 0x0,
-
-    /* U+0070 "p" */
-    0xdf, 0xff, 0xf7, 0x2, 0x9d, 0xff, 0xd9, 0x30,
-    0x0, 0x0, 0xdf, 0xff, 0xf8, 0x6f, 0xff, 0xff,
-    0xff, 0xf9, 0x0, 0x0, 0xdf, 0xff, 0xfe, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xb0, 0x0, 0xdf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x0,
-    0xdf, 0xff, 0xff, 0xfe, 0x98, 0xaf, 0xff, 0xff,
-    0xfe, 0x0, 0xdf, 0xff, 0xff, 0xa0, 0x0, 0x2,
-    0xef, 0xff, 0xff, 0x60, 0xdf, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x4f, 0xff, 0xff, 0xa0, 0xdf, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0xe0,
-    0xdf, 0xff, 0xfd, 0x0, 0x0, 0x0, 0xa, 0xff,
-    0xff, 0xf0, 0xdf, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0xff, 0xf2, 0xdf, 0xff, 0xfd, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xf2, 0xdf, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xf2,
-    0xdf, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x8, 0xff,
-    0xff, 0xf2, 0xdf, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0xff, 0xf0, 0xdf, 0xff, 0xfd, 0x0,
-    0x0, 0x0, 0xd, 0xff, 0xff, 0xd0, 0xdf, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xa0,
-    0xdf, 0xff, 0xff, 0xa0, 0x0, 0x1, 0xef, 0xff,
-    0xff, 0x50, 0xdf, 0xff, 0xff, 0xfe, 0x98, 0x9f,
-    0xff, 0xff, 0xfe, 0x0, 0xdf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf5, 0x0, 0xdf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90, 0x0,
-    0xdf, 0xff, 0xfd, 0x6f, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0xdf, 0xff, 0xfd, 0x2, 0x9d, 0xff,
-    0xd9, 0x20, 0x0, 0x0, 0xdf, 0xff, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+0071 "q" */
-    0x0, 0x0, 0x6, 0xce, 0xff, 0xc6, 0x0, 0xaf,
-    0xff, 0xf5, 0x0, 0x3, 0xef, 0xff, 0xff, 0xff,
-    0xc1, 0xdf, 0xff, 0xf5, 0x0, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xfd, 0xff, 0xff, 0xf5, 0x0, 0xdf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5,
-    0x7, 0xff, 0xff, 0xff, 0xc8, 0x8b, 0xff, 0xff,
-    0xff, 0xf5, 0xd, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x3e, 0xff, 0xff, 0xf5, 0x2f, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xf5, 0x6f, 0xff,
-    0xff, 0x60, 0x0, 0x0, 0x5, 0xff, 0xff, 0xf5,
-    0x8f, 0xff, 0xff, 0x20, 0x0, 0x0, 0x5, 0xff,
-    0xff, 0xf5, 0xaf, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xff, 0xf5, 0xaf, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xff, 0xf5, 0xaf, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xf5,
-    0xaf, 0xff, 0xff, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xff, 0xf5, 0x8f, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x5, 0xff, 0xff, 0xf5, 0x6f, 0xff, 0xff, 0x60,
-    0x0, 0x0, 0x5, 0xff, 0xff, 0xf5, 0x2f, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xf5,
-    0xd, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xf5, 0x6, 0xff, 0xff, 0xff, 0xc8, 0x8b,
-    0xff, 0xff, 0xff, 0xf5, 0x0, 0xcf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x0, 0x2e,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5,
-    0x0, 0x2, 0xdf, 0xff, 0xff, 0xff, 0xc6, 0xff,
-    0xff, 0xf5, 0x0, 0x0, 0x6, 0xbe, 0xfe, 0xc6,
-    0x5, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xff, 0xf5,
-
-    /* U+0072 "r" */
-    0xdf, 0xff, 0xf8, 0x2, 0xae, 0xff, 0x2d, 0xff,
-    0xff, 0x93, 0xff, 0xff, 0xf2, 0xdf, 0xff, 0xfb,
-    0xef, 0xff, 0xff, 0x2d, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf1, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x1d, 0xff, 0xff, 0xff, 0xe9, 0x77, 0x80, 0xdf,
-    0xff, 0xff, 0xb0, 0x0, 0x0, 0xd, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xfd, 0x0,
-    0x0, 0x0, 0xd, 0xff, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0xdf, 0xff, 0xfd, 0x0, 0x0, 0x0, 0xd,
-    0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0xd0,
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0xd, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0xdf, 0xff, 0xfd, 0x0, 0x0, 0x0, 0xd, 0xff,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xfd,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0xd, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0,
-
-    /* U+0073 "s" */
-    0x0, 0x0, 0x16, 0xbe, 0xff, 0xec, 0x94, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x30, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x40, 0x0, 0x6f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x10, 0xe, 0xff,
-    0xff, 0xe5, 0x0, 0x2b, 0xff, 0xff, 0xf9, 0x2,
-    0xff, 0xff, 0xf5, 0x0, 0x0, 0xe, 0xff, 0xff,
-    0xe0, 0x4f, 0xff, 0xff, 0x20, 0x0, 0x0, 0x8d,
-    0xdd, 0xdd, 0x2, 0xff, 0xff, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0xfd,
-    0x73, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0xff, 0xff, 0xff, 0xb7, 0x10, 0x0, 0x0, 0x0,
-    0x6f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa2, 0x0,
-    0x0, 0x0, 0x2a, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf5, 0x0, 0x0, 0x0, 0x1, 0x7b, 0xff, 0xff,
-    0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x38, 0xef, 0xff, 0xff, 0xb0, 0x22, 0x22, 0x21,
-    0x0, 0x0, 0x1, 0xcf, 0xff, 0xff, 0xd, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x6, 0xff, 0xff, 0xf1,
-    0xaf, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x9f, 0xff,
-    0xff, 0x4, 0xff, 0xff, 0xfd, 0x41, 0x1, 0x8f,
-    0xff, 0xff, 0xb0, 0xa, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf3, 0x0, 0xb, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x8,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xd4, 0x0, 0x0,
-    0x0, 0x1, 0x7b, 0xef, 0xff, 0xd9, 0x40, 0x0,
-    0x0,
-
-    /* U+0074 "t" */
-    0x0, 0x5, 0x88, 0x88, 0x70, 0x0, 0x0, 0x0,
-    0xbf, 0xff, 0xfe, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0xbf, 0xff, 0xfe, 0x0, 0x0, 0xcf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x8c, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf8, 0xcf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x8c, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf8, 0x1, 0x1b, 0xff, 0xff, 0xe1, 0x11, 0x0,
-    0x0, 0xbf, 0xff, 0xfe, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0xbf, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0xbf, 0xff, 0xfe, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0xbf, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x8f,
-    0xff, 0xff, 0xea, 0x98, 0x0, 0x4, 0xff, 0xff,
-    0xff, 0xff, 0xc0, 0x0, 0xd, 0xff, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x2e, 0xff, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x17, 0xcf, 0xff, 0xd7,
-
-    /* U+0075 "u" */
-    0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x5f, 0xff,
-    0xff, 0x5f, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x5,
-    0xff, 0xff, 0xf5, 0xff, 0xff, 0xfa, 0x0, 0x0,
-    0x0, 0x5f, 0xff, 0xff, 0x5f, 0xff, 0xff, 0xa0,
-    0x0, 0x0, 0x5, 0xff, 0xff, 0xf5, 0xff, 0xff,
-    0xfa, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0x5f,
-    0xff, 0xff, 0xa0, 0x0, 0x0, 0x5, 0xff, 0xff,
-    0xf5, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x5f,
-    0xff, 0xff, 0x5f, 0xff, 0xff, 0xa0, 0x0, 0x0,
-    0x5, 0xff, 0xff, 0xf5, 0xff, 0xff, 0xfa, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0xff, 0x5f, 0xff, 0xff,
-    0xa0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xf5, 0xff,
-    0xff, 0xfa, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff,
-    0x5f, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x5, 0xff,
-    0xff, 0xf5, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0xff, 0x5f, 0xff, 0xff, 0xa0, 0x0,
-    0x0, 0x5, 0xff, 0xff, 0xf5, 0xff, 0xff, 0xfa,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0x5e, 0xff,
-    0xff, 0xd0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xf5,
-    0xbf, 0xff, 0xff, 0x60, 0x0, 0x4, 0xff, 0xff,
-    0xff, 0x57, 0xff, 0xff, 0xff, 0xb8, 0x9c, 0xff,
-    0xff, 0xff, 0xf5, 0x1f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x50, 0x8f, 0xff, 0xff,
-    0xff, 0xff, 0xfd, 0xff, 0xff, 0xf5, 0x0, 0x9f,
-    0xff, 0xff, 0xff, 0xfb, 0x2f, 0xff, 0xff, 0x50,
-    0x0, 0x3a, 0xdf, 0xfe, 0xa4, 0x0, 0xff, 0xff,
-    0xf5,
-
-    /* U+0076 "v" */
-    0x9f, 0xff, 0xff, 0x40, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xfc, 0x4f, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x5, 0xff, 0xff, 0xf7, 0xe, 0xff, 0xff, 0xd0,
-    0x0, 0x0, 0x9, 0xff, 0xff, 0xf2, 0x9, 0xff,
-    0xff, 0xf1, 0x0, 0x0, 0xd, 0xff, 0xff, 0xc0,
-    0x4, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0x70, 0x0, 0xff, 0xff, 0xf9, 0x0, 0x0,
-    0x6f, 0xff, 0xff, 0x20, 0x0, 0xaf, 0xff, 0xfe,
-    0x0, 0x0, 0xaf, 0xff, 0xfd, 0x0, 0x0, 0x5f,
-    0xff, 0xff, 0x20, 0x0, 0xef, 0xff, 0xf8, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0x60, 0x2, 0xff, 0xff,
-    0xf2, 0x0, 0x0, 0xa, 0xff, 0xff, 0xa0, 0x7,
-    0xff, 0xff, 0xd0, 0x0, 0x0, 0x5, 0xff, 0xff,
-    0xe0, 0xb, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xf3, 0xf, 0xff, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0xbf, 0xff, 0xf7, 0x3f, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xfb, 0x8f,
-    0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xcf, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0,
-
-    /* U+0077 "w" */
-    0x5f, 0xff, 0xff, 0x10, 0x0, 0x0, 0x8f, 0xff,
-    0xd0, 0x0, 0x0, 0xd, 0xff, 0xff, 0x91, 0xff,
-    0xff, 0xf4, 0x0, 0x0, 0xc, 0xff, 0xff, 0x10,
-    0x0, 0x0, 0xff, 0xff, 0xf5, 0xd, 0xff, 0xff,
-    0x70, 0x0, 0x1, 0xff, 0xff, 0xf5, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0x20, 0x9f, 0xff, 0xfa, 0x0,
-    0x0, 0x5f, 0xff, 0xff, 0xa0, 0x0, 0x6, 0xff,
-    0xff, 0xe0, 0x5, 0xff, 0xff, 0xd0, 0x0, 0x9,
-    0xff, 0xff, 0xfe, 0x0, 0x0, 0x9f, 0xff, 0xfa,
-    0x0, 0x1f, 0xff, 0xff, 0x10, 0x0, 0xdf, 0xff,
-    0xff, 0xf2, 0x0, 0xc, 0xff, 0xff, 0x60, 0x0,
-    0xdf, 0xff, 0xf4, 0x0, 0x2f, 0xff, 0xff, 0xff,
-    0x70, 0x0, 0xff, 0xff, 0xf2, 0x0, 0x9, 0xff,
-    0xff, 0x70, 0x6, 0xff, 0xff, 0xff, 0xfb, 0x0,
-    0x2f, 0xff, 0xfe, 0x0, 0x0, 0x5f, 0xff, 0xfa,
-    0x0, 0xaf, 0xff, 0x9f, 0xff, 0xf0, 0x5, 0xff,
-    0xff, 0xa0, 0x0, 0x2, 0xff, 0xff, 0xd0, 0xe,
-    0xff, 0xf2, 0xdf, 0xff, 0x40, 0x8f, 0xff, 0xf6,
-    0x0, 0x0, 0xe, 0xff, 0xff, 0x3, 0xff, 0xfe,
-    0x9, 0xff, 0xf8, 0xb, 0xff, 0xff, 0x20, 0x0,
-    0x0, 0xaf, 0xff, 0xf3, 0x7f, 0xff, 0x90, 0x4f,
-    0xff, 0xc0, 0xef, 0xff, 0xe0, 0x0, 0x0, 0x6,
-    0xff, 0xff, 0x6c, 0xff, 0xf5, 0x0, 0xff, 0xff,
-    0x2f, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xfa, 0xff, 0xff, 0x0, 0xb, 0xff, 0xfa, 0xff,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0xef, 0xff, 0xff,
-    0xff, 0xc0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xf3,
-    0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xff, 0xf7,
-    0x0, 0x2, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0xff, 0xff, 0x30, 0x0,
-    0xe, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x9f,
-    0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xff, 0xff, 0xfa, 0x0, 0x0, 0x5, 0xff, 0xff,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0xff, 0x50, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0xcf, 0xff, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0x80, 0x0, 0x0,
-
-    /* U+0078 "x" */
-    0x1f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xf8, 0x0, 0x7f, 0xff, 0xff, 0x80, 0x0,
-    0x1, 0xef, 0xff, 0xfe, 0x0, 0x0, 0xef, 0xff,
-    0xff, 0x10, 0x0, 0x8f, 0xff, 0xff, 0x60, 0x0,
-    0x5, 0xff, 0xff, 0xf8, 0x0, 0x1f, 0xff, 0xff,
-    0xd0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xf1, 0x9,
-    0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0x92, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xff, 0xff, 0xcf, 0xff, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
-    0xff, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1e, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xff, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xff, 0xff, 0xe7, 0xff, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0xff, 0xf6, 0xe, 0xff, 0xff,
-    0xf1, 0x0, 0x0, 0x1, 0xff, 0xff, 0xfd, 0x0,
-    0x5f, 0xff, 0xff, 0x90, 0x0, 0x0, 0x9f, 0xff,
-    0xff, 0x50, 0x0, 0xdf, 0xff, 0xff, 0x20, 0x0,
-    0x3f, 0xff, 0xff, 0xc0, 0x0, 0x4, 0xff, 0xff,
-    0xfb, 0x0, 0xb, 0xff, 0xff, 0xf4, 0x0, 0x0,
-    0xb, 0xff, 0xff, 0xf3, 0x4, 0xff, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xc0,
-
-    /* U+0079 "y" */
-    0xcf, 0xff, 0xff, 0x40, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xfe, 0x6, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xff, 0x90, 0x1f, 0xff, 0xff,
-    0xd0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xf3, 0x0,
-    0xbf, 0xff, 0xff, 0x20, 0x0, 0x0, 0xff, 0xff,
-    0xfe, 0x0, 0x5, 0xff, 0xff, 0xf7, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0x80, 0x0, 0xf, 0xff, 0xff,
-    0xb0, 0x0, 0x9, 0xff, 0xff, 0xf3, 0x0, 0x0,
-    0xaf, 0xff, 0xff, 0x10, 0x0, 0xdf, 0xff, 0xfd,
-    0x0, 0x0, 0x5, 0xff, 0xff, 0xf5, 0x0, 0x2f,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xa0, 0x7, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0,
-    0xaf, 0xff, 0xfe, 0x0, 0xcf, 0xff, 0xfd, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0xf3, 0x1f, 0xff,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff,
-    0x85, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0xfd, 0xaf, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff,
-    0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xff, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff,
-    0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xff, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xdf,
-    0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0x9a, 0xff, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xff, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0xff, 0xff, 0xe4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xef, 0xfd, 0x81, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0,
-
-    /* U+007A "z" */
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfb, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfb, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfb, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf8, 0x18, 0x88, 0x88, 0x88,
-    0x88, 0xcf, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xfe, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x1e, 0xff, 0xff, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xef, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xff, 0xfd, 0x77, 0x77, 0x77,
-    0x77, 0x77, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x8f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x8f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x8f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-
-    /* U+007B "{" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x44, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xdf, 0xc0, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0xff, 0x20, 0x0, 0x0, 0xa, 0xff,
-    0xff, 0xf4, 0x0, 0x0, 0x5, 0xff, 0xff, 0xe2,
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x8f, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0x9f, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x9, 0xff,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xf6,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x15,
-    0xef, 0xff, 0xf8, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x2, 0xff, 0xff, 0xfa, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xff, 0xb1, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x4e, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff,
-    0xf4, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x9f, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x9, 0xff,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xf7,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0xfa, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0xc,
-    0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0xfe, 0x20, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x4d, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0x30,
-
-    /* U+007C "|" */
-    0x9f, 0xfc, 0x9f, 0xfc, 0x9f, 0xfc, 0x9f, 0xfc,
-    0x9f, 0xfc, 0x9f, 0xfc, 0x9f, 0xfc, 0x9f, 0xfc,
-    0x9f, 0xfc, 0x9f, 0xfc, 0x9f, 0xfc, 0x9f, 0xfc,
-    0x9f, 0xfc, 0x9f, 0xfc, 0x9f, 0xfc, 0x9f, 0xfc,
-    0x9f, 0xfc, 0x9f, 0xfc, 0x9f, 0xfc, 0x9f, 0xfc,
-    0x9f, 0xfc, 0x9f, 0xfc, 0x9f, 0xfc, 0x9f, 0xfc,
-    0x9f, 0xfc, 0x9f, 0xfc, 0x9f, 0xfc, 0x9f, 0xfc,
-    0x9f, 0xfc, 0x9f, 0xfc, 0x9f, 0xfc, 0x9f, 0xfc,
-    0x9f, 0xfc, 0x9f, 0xfc, 0x47, 0x75,
-
-    /* U+007D "}" */
-    0x2, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xd6, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x1, 0xdf, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff,
-    0xb0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0xf5, 0x0, 0x0, 0x0,
-    0x6, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0xa,
-    0xff, 0xff, 0xff, 0x30, 0x0, 0x0, 0x8, 0xff,
-    0xff, 0xf4, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0x40, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xf4, 0x0,
-    0x0, 0x5f, 0xff, 0xff, 0x72, 0x0, 0x0, 0xc,
-    0xff, 0xff, 0x60, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xfd, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0xfb, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0xbf, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x1c, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x2e, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xc1, 0x0, 0x0, 0x0, 0x9,
-    0xfe, 0x70, 0x0, 0x0, 0x0, 0x0, 0x35, 0x0,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+007E "~" */
-    0x0, 0x3, 0xae, 0xfe, 0xa3, 0x0, 0x0, 0x0,
-    0x1, 0x55, 0x54, 0x0, 0x7f, 0xff, 0xff, 0xff,
-    0x90, 0x0, 0x0, 0x6, 0xff, 0xfc, 0x5, 0xff,
-    0xff, 0xff, 0xff, 0xfb, 0x0, 0x0, 0xa, 0xff,
-    0xfa, 0xe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc1,
-    0x0, 0x3f, 0xff, 0xf7, 0x5f, 0xff, 0xfe, 0x9a,
-    0xff, 0xff, 0xff, 0xaa, 0xff, 0xff, 0xf3, 0xaf,
-    0xff, 0xe2, 0x0, 0x2d, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xc0, 0xcf, 0xff, 0x80, 0x0, 0x1, 0xcf,
-    0xff, 0xff, 0xff, 0xff, 0x20, 0xef, 0xff, 0x40,
-    0x0, 0x0, 0xa, 0xff, 0xff, 0xff, 0xf4, 0x0,
-    0x33, 0x33, 0x0, 0x0, 0x0, 0x0, 0x5b, 0xef,
-    0xe9, 0x20, 0x0,
+    0x7f, 0xfe, 0x60, 0xf, 0xff, 0xf8, 0x7, 0xff,
+    0xfc, 0x3, 0xff, 0xfe, 0x1, 0xff, 0xff, 0x0,
+    0xff, 0xff, 0x80, 0x7f, 0xff, 0xc0, 0x3a, 0xea,
+    0xbf, 0xe8, 0x0, 0xf1, 0x2a, 0xff, 0xe0, 0xf,
+    0xff, 0x68,
 
     /* U+00B0 "°" */
-    0x0, 0x5, 0xbd, 0xd9, 0x20, 0x0, 0x0, 0xaf,
-    0xff, 0xff, 0xf4, 0x0, 0x8, 0xff, 0xff, 0xff,
-    0xff, 0x20, 0x1f, 0xff, 0x60, 0x2b, 0xff, 0xa0,
-    0x6f, 0xf9, 0x0, 0x1, 0xff, 0xe0, 0x7f, 0xf5,
-    0x0, 0x0, 0xdf, 0xf0, 0x6f, 0xf7, 0x0, 0x0,
-    0xef, 0xf0, 0x2f, 0xff, 0x40, 0x9, 0xff, 0xb0,
-    0xa, 0xff, 0xfe, 0xff, 0xff, 0x30, 0x0, 0xcf,
-    0xff, 0xff, 0xf6, 0x0, 0x0, 0x7, 0xdf, 0xfb,
-    0x30, 0x0
+    0x0, 0x96, 0xf7, 0x52, 0x40, 0x1d, 0x54, 0x42,
+    0x23, 0x6a, 0x0, 0x50, 0xa0, 0x1e, 0xb2, 0x1,
+    0x70, 0x4, 0xfe, 0xa0, 0x2, 0x1, 0xc0, 0xc,
+    0xc0, 0x2a, 0x0, 0x20, 0x8, 0x3, 0x0, 0x21,
+    0x20, 0x10, 0x10, 0x1, 0x0, 0x63, 0x0, 0x90,
+    0x1, 0x8, 0x0, 0x91, 0x4, 0x2, 0x50, 0x5,
+    0xf7, 0xb0, 0x2, 0x0, 0x14, 0x60, 0x1, 0x0,
+    0xa4, 0xc0, 0x2c, 0x82, 0x0, 0x26, 0x30, 0x0
 };
 
 
@@ -3293,119 +322,49 @@ static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
 static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
     {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
     {.bitmap_index = 0, .adv_w = 159, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 0, .adv_w = 173, .box_w = 7, .box_h = 29, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 102, .adv_w = 204, .box_w = 11, .box_h = 11, .ofs_x = 1, .ofs_y = 19},
-    {.bitmap_index = 163, .adv_w = 379, .box_w = 22, .box_h = 29, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 482, .adv_w = 367, .box_w = 21, .box_h = 38, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 881, .adv_w = 473, .box_w = 27, .box_h = 29, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1273, .adv_w = 421, .box_w = 25, .box_h = 29, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1636, .adv_w = 103, .box_w = 5, .box_h = 11, .ofs_x = 1, .ofs_y = 19},
-    {.bitmap_index = 1664, .adv_w = 224, .box_w = 12, .box_h = 43, .ofs_x = 2, .ofs_y = -10},
-    {.bitmap_index = 1922, .adv_w = 225, .box_w = 12, .box_h = 43, .ofs_x = 0, .ofs_y = -10},
-    {.bitmap_index = 2180, .adv_w = 291, .box_w = 18, .box_h = 18, .ofs_x = 0, .ofs_y = 11},
-    {.bitmap_index = 2342, .adv_w = 349, .box_w = 20, .box_h = 22, .ofs_x = 1, .ofs_y = 2},
-    {.bitmap_index = 2562, .adv_w = 158, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = -8},
-    {.bitmap_index = 2614, .adv_w = 252, .box_w = 12, .box_h = 5, .ofs_x = 2, .ofs_y = 10},
-    {.bitmap_index = 2644, .adv_w = 186, .box_w = 7, .box_h = 6, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 2665, .adv_w = 238, .box_w = 16, .box_h = 32, .ofs_x = -1, .ofs_y = -3},
-    {.bitmap_index = 2921, .adv_w = 367, .box_w = 21, .box_h = 29, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3226, .adv_w = 367, .box_w = 13, .box_h = 29, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 3415, .adv_w = 367, .box_w = 21, .box_h = 29, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3720, .adv_w = 367, .box_w = 21, .box_h = 29, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 4025, .adv_w = 367, .box_w = 21, .box_h = 29, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 4330, .adv_w = 367, .box_w = 20, .box_h = 29, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 4620, .adv_w = 367, .box_w = 21, .box_h = 29, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 4925, .adv_w = 367, .box_w = 21, .box_h = 29, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 5230, .adv_w = 367, .box_w = 21, .box_h = 29, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 5535, .adv_w = 367, .box_w = 20, .box_h = 29, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 5825, .adv_w = 180, .box_w = 7, .box_h = 22, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 5902, .adv_w = 168, .box_w = 8, .box_h = 30, .ofs_x = 1, .ofs_y = -8},
-    {.bitmap_index = 6022, .adv_w = 326, .box_w = 17, .box_h = 20, .ofs_x = 1, .ofs_y = 2},
-    {.bitmap_index = 6192, .adv_w = 367, .box_w = 19, .box_h = 13, .ofs_x = 2, .ofs_y = 6},
-    {.bitmap_index = 6316, .adv_w = 330, .box_w = 18, .box_h = 20, .ofs_x = 2, .ofs_y = 2},
-    {.bitmap_index = 6496, .adv_w = 318, .box_w = 19, .box_h = 29, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 6772, .adv_w = 574, .box_w = 34, .box_h = 38, .ofs_x = 1, .ofs_y = -8},
-    {.bitmap_index = 7418, .adv_w = 430, .box_w = 27, .box_h = 29, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 7810, .adv_w = 408, .box_w = 22, .box_h = 29, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 8129, .adv_w = 419, .box_w = 24, .box_h = 29, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 8477, .adv_w = 416, .box_w = 23, .box_h = 29, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 8811, .adv_w = 360, .box_w = 20, .box_h = 29, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 9101, .adv_w = 351, .box_w = 20, .box_h = 29, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 9391, .adv_w = 436, .box_w = 25, .box_h = 29, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 9754, .adv_w = 452, .box_w = 24, .box_h = 29, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 10102, .adv_w = 187, .box_w = 7, .box_h = 29, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 10204, .adv_w = 358, .box_w = 20, .box_h = 29, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 10494, .adv_w = 407, .box_w = 24, .box_h = 29, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 10842, .adv_w = 346, .box_w = 19, .box_h = 29, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 11118, .adv_w = 560, .box_w = 31, .box_h = 29, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 11568, .adv_w = 452, .box_w = 24, .box_h = 29, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 11916, .adv_w = 441, .box_w = 25, .box_h = 29, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 12279, .adv_w = 413, .box_w = 23, .box_h = 29, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 12613, .adv_w = 441, .box_w = 25, .box_h = 34, .ofs_x = 1, .ofs_y = -5},
-    {.bitmap_index = 13038, .adv_w = 410, .box_w = 23, .box_h = 29, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 13372, .adv_w = 394, .box_w = 23, .box_h = 29, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 13706, .adv_w = 397, .box_w = 24, .box_h = 29, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 14054, .adv_w = 422, .box_w = 23, .box_h = 29, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 14388, .adv_w = 418, .box_w = 27, .box_h = 29, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 14780, .adv_w = 560, .box_w = 35, .box_h = 29, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 15288, .adv_w = 406, .box_w = 25, .box_h = 29, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 15651, .adv_w = 396, .box_w = 25, .box_h = 29, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 16014, .adv_w = 388, .box_w = 23, .box_h = 29, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 16348, .adv_w = 177, .box_w = 9, .box_h = 41, .ofs_x = 2, .ofs_y = -7},
-    {.bitmap_index = 16533, .adv_w = 270, .box_w = 19, .box_h = 32, .ofs_x = -1, .ofs_y = -3},
-    {.bitmap_index = 16837, .adv_w = 177, .box_w = 9, .box_h = 41, .ofs_x = 0, .ofs_y = -7},
-    {.bitmap_index = 17022, .adv_w = 280, .box_w = 17, .box_h = 15, .ofs_x = 0, .ofs_y = 15},
-    {.bitmap_index = 17150, .adv_w = 285, .box_w = 18, .box_h = 5, .ofs_x = 0, .ofs_y = -4},
-    {.bitmap_index = 17195, .adv_w = 211, .box_w = 11, .box_h = 7, .ofs_x = 1, .ofs_y = 25},
-    {.bitmap_index = 17234, .adv_w = 343, .box_w = 20, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 17454, .adv_w = 360, .box_w = 20, .box_h = 30, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 17754, .adv_w = 333, .box_w = 19, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 17963, .adv_w = 360, .box_w = 20, .box_h = 30, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 18263, .adv_w = 346, .box_w = 20, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 18483, .adv_w = 229, .box_w = 15, .box_h = 31, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 18716, .adv_w = 366, .box_w = 20, .box_h = 30, .ofs_x = 1, .ofs_y = -8},
-    {.bitmap_index = 19016, .adv_w = 358, .box_w = 19, .box_h = 30, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 19301, .adv_w = 169, .box_w = 7, .box_h = 30, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 19406, .adv_w = 167, .box_w = 11, .box_h = 38, .ofs_x = -2, .ofs_y = -8},
-    {.bitmap_index = 19615, .adv_w = 342, .box_w = 20, .box_h = 30, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 19915, .adv_w = 169, .box_w = 7, .box_h = 30, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 20020, .adv_w = 554, .box_w = 31, .box_h = 22, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 20361, .adv_w = 359, .box_w = 19, .box_h = 22, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 20570, .adv_w = 361, .box_w = 21, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 20801, .adv_w = 360, .box_w = 20, .box_h = 30, .ofs_x = 2, .ofs_y = -8},
-    {.bitmap_index = 21101, .adv_w = 361, .box_w = 20, .box_h = 30, .ofs_x = 1, .ofs_y = -8},
-    {.bitmap_index = 21401, .adv_w = 234, .box_w = 13, .box_h = 22, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 21544, .adv_w = 329, .box_w = 19, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 21753, .adv_w = 217, .box_w = 13, .box_h = 28, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 21935, .adv_w = 358, .box_w = 19, .box_h = 22, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 22144, .adv_w = 324, .box_w = 20, .box_h = 22, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 22364, .adv_w = 470, .box_w = 29, .box_h = 22, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 22683, .adv_w = 326, .box_w = 21, .box_h = 22, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 22914, .adv_w = 322, .box_w = 21, .box_h = 30, .ofs_x = 0, .ofs_y = -8},
-    {.bitmap_index = 23229, .adv_w = 326, .box_w = 18, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 23427, .adv_w = 211, .box_w = 13, .box_h = 40, .ofs_x = 0, .ofs_y = -8},
-    {.bitmap_index = 23687, .adv_w = 161, .box_w = 4, .box_h = 35, .ofs_x = 3, .ofs_y = -6},
-    {.bitmap_index = 23757, .adv_w = 211, .box_w = 13, .box_h = 40, .ofs_x = 0, .ofs_y = -8},
-    {.bitmap_index = 24017, .adv_w = 415, .box_w = 22, .box_h = 9, .ofs_x = 2, .ofs_y = 8},
-    {.bitmap_index = 24116, .adv_w = 249, .box_w = 12, .box_h = 11, .ofs_x = 2, .ofs_y = 19}
+    {.bitmap_index = 0, .adv_w = 252, .box_w = 12, .box_h = 5, .ofs_x = 2, .ofs_y = 10},
+    {.bitmap_index = 10, .adv_w = 367, .box_w = 21, .box_h = 29, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 187, .adv_w = 367, .box_w = 13, .box_h = 29, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 238, .adv_w = 367, .box_w = 21, .box_h = 29, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 414, .adv_w = 367, .box_w = 21, .box_h = 29, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 618, .adv_w = 367, .box_w = 21, .box_h = 29, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 755, .adv_w = 367, .box_w = 20, .box_h = 29, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 940, .adv_w = 367, .box_w = 21, .box_h = 29, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1140, .adv_w = 367, .box_w = 21, .box_h = 29, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1299, .adv_w = 367, .box_w = 21, .box_h = 29, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1518, .adv_w = 367, .box_w = 20, .box_h = 29, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1715, .adv_w = 419, .box_w = 24, .box_h = 29, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1917, .adv_w = 346, .box_w = 19, .box_h = 29, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 1951, .adv_w = 249, .box_w = 12, .box_h = 11, .ofs_x = 2, .ofs_y = 19}
 };
 
 /*---------------------
  *  CHARACTER MAPPING
  *--------------------*/
 
+static const uint16_t unicode_list_0[] = {
+    0x0, 0xd
+};
+
+static const uint16_t unicode_list_2[] = {
+    0x0, 0x9, 0x6d
+};
 
 
 /*Collect the unicode lists and glyph_id offsets*/
 static const lv_font_fmt_txt_cmap_t cmaps[] =
 {
     {
-        .range_start = 32, .range_length = 95, .glyph_id_start = 1,
-        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
+        .range_start = 32, .range_length = 14, .glyph_id_start = 1,
+        .unicode_list = unicode_list_0, .glyph_id_ofs_list = NULL, .list_length = 2, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY
     },
     {
-        .range_start = 176, .range_length = 1, .glyph_id_start = 96,
+        .range_start = 48, .range_length = 10, .glyph_id_start = 3,
         .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
+    },
+    {
+        .range_start = 67, .range_length = 110, .glyph_id_start = 13,
+        .unicode_list = unicode_list_2, .glyph_id_ofs_list = NULL, .list_length = 3, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY
     }
 };
 
@@ -3414,37 +373,6 @@ static const lv_font_fmt_txt_cmap_t cmaps[] =
  *----------------*/
 
 
-/*Pair left and right glyphs for kerning*/
-static const uint8_t kern_pair_glyph_ids[] =
-{
-    3, 3,
-    3, 8,
-    8, 3,
-    8, 8,
-    13, 3,
-    13, 8,
-    15, 3,
-    15, 8,
-    16, 16
-};
-
-/* Kerning between the respective left and right glyphs
- * 4.4 format which needs to scaled with `kern_scale`*/
-static const int8_t kern_pair_values[] =
-{
-    -19, -19, -19, -19, -77, -77, -77, -77,
-    -75
-};
-
-/*Collect the kern pair's data in one place*/
-static const lv_font_fmt_txt_kern_pair_t kern_pairs =
-{
-    .glyph_ids = kern_pair_glyph_ids,
-    .values = kern_pair_values,
-    .pair_cnt = 9,
-    .glyph_ids_size = 0
-};
-
 /*--------------------
  *  ALL CUSTOM DATA
  *--------------------*/
@@ -3462,12 +390,12 @@ static lv_font_fmt_txt_dsc_t font_dsc = {
     .glyph_bitmap = glyph_bitmap,
     .glyph_dsc = glyph_dsc,
     .cmaps = cmaps,
-    .kern_dsc = &kern_pairs,
-    .kern_scale = 16,
-    .cmap_num = 2,
+    .kern_dsc = NULL,
+    .kern_scale = 0,
+    .cmap_num = 3,
     .bpp = 4,
     .kern_classes = 0,
-    .bitmap_format = 0,
+    .bitmap_format = 1,
 #if LVGL_VERSION_MAJOR == 8
     .cache = &cache
 #endif
@@ -3486,7 +414,7 @@ const lv_font_t roboto_bold_40_data = {
 lv_font_t roboto_bold_40_data = {
 #endif
     .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,    /*Function pointer to get glyph's data*/
-    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,    /*Function pointer to get glyph's bitmap*/
+    .get_glyph_bitmap = glyph_cache_get_bitmap,    /*Function pointer to get glyph's bitmap*/
     .line_height = 44,          /*The maximum line height required by the font*/
     .base_line = 10,             /*Baseline measured from the bottom of the line*/
 #if !(LVGL_VERSION_MAJOR == 6 && LVGL_VERSION_MINOR == 0)
@@ -1,6 +1,7 @@
 /*******************************************************************************
  * Size: 24 px
  * Bpp: 4
+ * Subset: tools/font_subset.py --compress " -./0123456789ABDFHLMNORSTUXYacdeiklmnoprstw"
  * Opts: --font /fonts/Roboto-Regular.ttf -o /fonts/roboto_regular_24_data.c --no-compress --size 24 --bpp 4 --format lvgl --symbols ° --range 0x20-0x7F
  ******************************************************************************/
 
@@ -9,6 +10,7 @@
 #else
 #include "lvgl/lvgl.h"
 #endif
+#include "glyph_cache.h"
 
 #ifndef ROBOTO_REGULAR_24_DATA
 #define ROBOTO_REGULAR_24_DATA 1
@@ -24,1266 +26,440 @@
 static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
     /* U+0020 " " */
 
-    /* U+0021 "!" */
-    0xf, 0xf3, 0xf, 0xf3, 0xf, 0xf3, 0xf, 0xf3,
-    0xf, 0xf2, 0xf, 0xf2, 0xf, 0xf2, 0xf, 0xf2,
-    0xe, 0xf2, 0xe, 0xf1, 0xe, 0xf1, 0xe, 0xf1,
-    0x4, 0x50, 0x0, 0x0, 0x4, 0x60, 0x1f, 0xf6,
-    0xc, 0xf3,
-
-    /* U+0022 "\"" */
-    0x6f, 0x43, 0xf6, 0x6f, 0x43, 0xf6, 0x6f, 0x33,
-    0xf5, 0x6f, 0x13, 0xf4, 0x6f, 0x3, 0xf2, 0x5c,
-    0x3, 0xd1,
-
-    /* U+0023 "#" */
-    0x0, 0x0, 0x8, 0xf2, 0x0, 0xbf, 0x0, 0x0,
-    0x0, 0xb, 0xf0, 0x0, 0xec, 0x0, 0x0, 0x0,
-    0xe, 0xc0, 0x1, 0xf8, 0x0, 0x0, 0x0, 0x1f,
-    0x90, 0x4, 0xf5, 0x0, 0x0, 0x0, 0x4f, 0x60,
-    0x8, 0xf2, 0x0, 0xb, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf7, 0x7, 0xaa, 0xef, 0xaa, 0xaf, 0xea,
-    0xa4, 0x0, 0x0, 0xed, 0x0, 0x1f, 0x90, 0x0,
-    0x0, 0x1, 0xf9, 0x0, 0x4f, 0x60, 0x0, 0x0,
-    0x4, 0xf6, 0x0, 0x7f, 0x30, 0x0, 0x6a, 0xac,
-    0xfb, 0xaa, 0xdf, 0xaa, 0x50, 0x9f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x90, 0x0, 0xd, 0xd0, 0x1,
-    0xf9, 0x0, 0x0, 0x0, 0xf, 0xa0, 0x4, 0xf6,
-    0x0, 0x0, 0x0, 0x3f, 0x70, 0x7, 0xf3, 0x0,
-    0x0, 0x0, 0x7f, 0x30, 0xa, 0xf0, 0x0, 0x0,
-    0x0, 0xaf, 0x0, 0xd, 0xd0, 0x0, 0x0,
-
-    /* U+0024 "$" */
-    0x0, 0x0, 0xd, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xe0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xe0,
-    0x0, 0x0, 0x0, 0x18, 0xdf, 0xfd, 0x70, 0x0,
-    0x1, 0xdf, 0xff, 0xff, 0xfc, 0x0, 0xa, 0xfd,
-    0x30, 0x5, 0xff, 0x70, 0xf, 0xf4, 0x0, 0x0,
-    0x7f, 0xd0, 0xf, 0xf2, 0x0, 0x0, 0x2f, 0xf0,
-    0xe, 0xf5, 0x0, 0x0, 0x5, 0x50, 0x9, 0xfe,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xfb, 0x50,
-    0x0, 0x0, 0x0, 0x7, 0xef, 0xff, 0x91, 0x0,
-    0x0, 0x0, 0x5, 0xaf, 0xfe, 0x20, 0x0, 0x0,
-    0x0, 0x2, 0xdf, 0xc0, 0x12, 0x10, 0x0, 0x0,
-    0x2f, 0xf1, 0xaf, 0x80, 0x0, 0x0, 0xf, 0xf3,
-    0x7f, 0xc0, 0x0, 0x0, 0x3f, 0xf1, 0x2f, 0xfa,
-    0x10, 0x3, 0xdf, 0xc0, 0x6, 0xff, 0xfe, 0xff,
-    0xfe, 0x20, 0x0, 0x3a, 0xef, 0xfd, 0x81, 0x0,
-    0x0, 0x0, 0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xb0, 0x0, 0x0,
-
-    /* U+0025 "%" */
-    0x4, 0xdf, 0xe9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xc7, 0x9f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0x10, 0x9, 0xf2, 0x0, 0x1e, 0x40, 0x0,
-    0xcd, 0x0, 0x6, 0xf3, 0x0, 0xbe, 0x10, 0x0,
-    0xbe, 0x0, 0x7, 0xf3, 0x6, 0xf5, 0x0, 0x0,
-    0x6f, 0x92, 0x4e, 0xe0, 0x1e, 0xb0, 0x0, 0x0,
-    0x9, 0xff, 0xfe, 0x30, 0xaf, 0x10, 0x0, 0x0,
-    0x0, 0x14, 0x30, 0x5, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1e, 0xb0, 0x0, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0x22, 0xcf, 0xfd, 0x30,
-    0x0, 0x0, 0x4, 0xf7, 0xd, 0xe6, 0x5e, 0xe1,
-    0x0, 0x0, 0xe, 0xc0, 0x5f, 0x50, 0x4, 0xf6,
-    0x0, 0x0, 0x9f, 0x20, 0x7f, 0x20, 0x1, 0xf8,
-    0x0, 0x3, 0xf7, 0x0, 0x7f, 0x30, 0x1, 0xf8,
-    0x0, 0xc, 0xd0, 0x0, 0x4f, 0x60, 0x5, 0xf5,
-    0x0, 0x1, 0x20, 0x0, 0xd, 0xf8, 0x7e, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xaf, 0xfb, 0x20,
-
-    /* U+0026 "&" */
-    0x0, 0x7, 0xdf, 0xfb, 0x30, 0x0, 0x0, 0x0,
-    0x9f, 0xfd, 0xef, 0xf3, 0x0, 0x0, 0x2, 0xff,
-    0x50, 0x8, 0xfb, 0x0, 0x0, 0x6, 0xfd, 0x0,
-    0x1, 0xfe, 0x0, 0x0, 0x6, 0xfd, 0x0, 0x4,
-    0xfc, 0x0, 0x0, 0x2, 0xff, 0x40, 0x3e, 0xf4,
-    0x0, 0x0, 0x0, 0x9f, 0xd8, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0xd, 0xff, 0xe3, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0x8f, 0xf7, 0x0, 0x1e, 0xc0, 0x4f, 0xf4,
-    0x4, 0xff, 0x50, 0x3f, 0xb0, 0xbf, 0x90, 0x0,
-    0x6f, 0xf3, 0x7f, 0x80, 0xcf, 0x60, 0x0, 0x9,
-    0xfe, 0xef, 0x30, 0xaf, 0x80, 0x0, 0x0, 0xbf,
-    0xfb, 0x0, 0x4f, 0xf3, 0x0, 0x0, 0x9f, 0xfb,
-    0x0, 0x7, 0xff, 0xb9, 0xae, 0xfd, 0xef, 0x90,
-    0x0, 0x3a, 0xef, 0xfc, 0x70, 0x3f, 0xf6,
-
-    /* U+0027 "'" */
-    0xcf, 0xcf, 0xce, 0xcd, 0xcc, 0x87,
-
-    /* U+0028 "(" */
-    0x0, 0x0, 0x0, 0x10, 0x0, 0x1, 0xc9, 0x0,
-    0x0, 0xcf, 0x40, 0x0, 0x9f, 0x60, 0x0, 0x4f,
-    0xb0, 0x0, 0xc, 0xf3, 0x0, 0x3, 0xfc, 0x0,
-    0x0, 0x9f, 0x70, 0x0, 0xe, 0xf3, 0x0, 0x1,
-    0xff, 0x0, 0x0, 0x4f, 0xd0, 0x0, 0x5, 0xfc,
-    0x0, 0x0, 0x6f, 0xb0, 0x0, 0x6, 0xfb, 0x0,
-    0x0, 0x5f, 0xc0, 0x0, 0x4, 0xfd, 0x0, 0x0,
-    0x2f, 0xf0, 0x0, 0x0, 0xef, 0x20, 0x0, 0xa,
-    0xf6, 0x0, 0x0, 0x4f, 0xb0, 0x0, 0x0, 0xdf,
-    0x20, 0x0, 0x5, 0xf9, 0x0, 0x0, 0xb, 0xf3,
-    0x0, 0x0, 0x1e, 0xe2, 0x0, 0x0, 0x2e, 0xa0,
-    0x0, 0x0, 0x13,
-
-    /* U+0029 ")" */
-    0x1, 0x0, 0x0, 0x6, 0xe2, 0x0, 0x0, 0x1e,
-    0xe2, 0x0, 0x0, 0x3f, 0xd0, 0x0, 0x0, 0x8f,
-    0x70, 0x0, 0x1, 0xff, 0x10, 0x0, 0x9, 0xf7,
-    0x0, 0x0, 0x4f, 0xc0, 0x0, 0x0, 0xff, 0x10,
-    0x0, 0xc, 0xf5, 0x0, 0x0, 0xaf, 0x70, 0x0,
-    0x9, 0xf9, 0x0, 0x0, 0x8f, 0xa0, 0x0, 0x8,
-    0xfa, 0x0, 0x0, 0x8f, 0x90, 0x0, 0xa, 0xf8,
-    0x0, 0x0, 0xcf, 0x50, 0x0, 0xf, 0xf2, 0x0,
-    0x3, 0xfd, 0x0, 0x0, 0x8f, 0x80, 0x0, 0xe,
-    0xf1, 0x0, 0x5, 0xf9, 0x0, 0x1, 0xee, 0x10,
-    0x0, 0xbf, 0x30, 0x0, 0x6f, 0x40, 0x0, 0x1,
-    0x30, 0x0, 0x0,
-
-    /* U+002A "*" */
-    0x0, 0x0, 0xaf, 0x10, 0x0, 0x0, 0x0, 0xa,
-    0xf0, 0x0, 0x0, 0x1, 0x0, 0x9f, 0x0, 0x0,
-    0x5, 0xfa, 0x49, 0xf1, 0x7d, 0xa0, 0x6d, 0xff,
-    0xff, 0xff, 0xfb, 0x0, 0x2, 0x9f, 0xfc, 0x51,
-    0x0, 0x0, 0xc, 0xfe, 0xe1, 0x0, 0x0, 0x8,
-    0xf8, 0x5f, 0xb0, 0x0, 0x3, 0xfd, 0x0, 0xaf,
-    0x60, 0x0, 0x8, 0x30, 0x1, 0xb2, 0x0,
-
-    /* U+002B "+" */
-    0x0, 0x0, 0x5, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xfd, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x90, 0x0, 0x0,
-    0x5f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0x86, 0x0, 0x0, 0x0,
-
-    /* U+002C "," */
-    0x8, 0xfa, 0x8, 0xf9, 0x8, 0xf8, 0xc, 0xf4,
-    0x4f, 0xd0, 0x3d, 0x20, 0x0, 0x0,
-
     /* U+002D "-" */
-    0x6c, 0xcc, 0xcc, 0x28, 0xff, 0xff, 0xf2,
+    0x6c, 0xce, 0x2e, 0x33, 0xe0,
 
     /* U+002E "." */
-    0x7, 0x80, 0x4f, 0xf5, 0x1e, 0xe2,
+    0x7, 0x80, 0x48, 0x75, 0x50, 0x89, 0xc0,
 
     /* U+002F "/" */
-    0x0, 0x0, 0x0, 0xd, 0xf0, 0x0, 0x0, 0x0,
-    0x3f, 0xa0, 0x0, 0x0, 0x0, 0x9f, 0x30, 0x0,
-    0x0, 0x0, 0xfd, 0x0, 0x0, 0x0, 0x6, 0xf7,
-    0x0, 0x0, 0x0, 0xc, 0xf1, 0x0, 0x0, 0x0,
-    0x2f, 0xb0, 0x0, 0x0, 0x0, 0x8f, 0x50, 0x0,
-    0x0, 0x0, 0xee, 0x0, 0x0, 0x0, 0x5, 0xf8,
-    0x0, 0x0, 0x0, 0xb, 0xf2, 0x0, 0x0, 0x0,
-    0x1f, 0xc0, 0x0, 0x0, 0x0, 0x7f, 0x60, 0x0,
-    0x0, 0x0, 0xdf, 0x0, 0x0, 0x0, 0x3, 0xfa,
-    0x0, 0x0, 0x0, 0xa, 0xf4, 0x0, 0x0, 0x0,
-    0xf, 0xd0, 0x0, 0x0, 0x0, 0x6f, 0x70, 0x0,
-    0x0, 0x0, 0x58, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0xfb, 0x7c, 0x3, 0xe3, 0x25, 0x0, 0xfa,
+    0x82, 0x40, 0x3e, 0x62, 0x30, 0xf, 0x30, 0x50,
+    0x7, 0xd4, 0xc, 0x1, 0xe2, 0x34, 0x10, 0xf,
+    0x50, 0x70, 0x7, 0xcc, 0x2a, 0x1, 0xe5, 0x16,
+    0x0, 0xfb, 0x82, 0x80, 0x3c, 0x28, 0x64, 0x1,
+    0xe6, 0xa, 0x0, 0xfa, 0x81, 0x80, 0x3c, 0x64,
+    0xa0, 0x1f, 0x48, 0x70, 0x7, 0xca, 0x48, 0x1,
+    0xe6, 0xa, 0x0, 0xf8, 0xdd, 0x80, 0x3e,
 
     /* U+0030 "0" */
-    0x0, 0x29, 0xef, 0xfc, 0x50, 0x0, 0x2, 0xef,
-    0xfc, 0xef, 0xf9, 0x0, 0xc, 0xfb, 0x0, 0x5,
-    0xff, 0x40, 0x2f, 0xf1, 0x0, 0x0, 0x9f, 0xa0,
-    0x6f, 0xc0, 0x0, 0x0, 0x4f, 0xe0, 0x9f, 0x90,
-    0x0, 0x0, 0x1f, 0xf0, 0xaf, 0x80, 0x0, 0x0,
-    0xf, 0xf1, 0xaf, 0x80, 0x0, 0x0, 0xf, 0xf2,
-    0xaf, 0x80, 0x0, 0x0, 0xf, 0xf2, 0xaf, 0x80,
-    0x0, 0x0, 0xf, 0xf2, 0xaf, 0x80, 0x0, 0x0,
-    0xf, 0xf1, 0x8f, 0x90, 0x0, 0x0, 0x2f, 0xf0,
-    0x6f, 0xc0, 0x0, 0x0, 0x4f, 0xe0, 0x2f, 0xf2,
-    0x0, 0x0, 0x9f, 0xa0, 0xb, 0xfc, 0x10, 0x5,
-    0xff, 0x30, 0x2, 0xef, 0xfd, 0xef, 0xf8, 0x0,
-    0x0, 0x19, 0xdf, 0xfc, 0x50, 0x0,
+    0x0, 0x14, 0xf7, 0xfb, 0x14, 0x3, 0x16, 0x30,
+    0x98, 0x9d, 0x48, 0x5, 0xc2, 0x9f, 0x9d, 0x40,
+    0xc8, 0x4, 0x61, 0x40, 0x12, 0xb0, 0x70, 0x20,
+    0x18, 0x80, 0x6d, 0x4, 0xf, 0x5, 0x0, 0xe5,
+    0x1, 0x3, 0x1, 0x0, 0xe1, 0x0, 0x8, 0x7,
+    0xfc, 0x60, 0x1f, 0xfd, 0x73, 0x20, 0x10, 0xe,
+    0x20, 0x0, 0xf0, 0x28, 0x7, 0x30, 0x8, 0x20,
+    0x19, 0x0, 0x6d, 0x4, 0x2, 0x40, 0xe1, 0x0,
+    0x2b, 0x4, 0x80, 0x24, 0x4f, 0xb7, 0xa8, 0x1c,
+    0xc0, 0x5, 0xec, 0x44, 0x13, 0xa8, 0x0,
 
     /* U+0031 "1" */
-    0x0, 0x0, 0x5b, 0x80, 0x39, 0xff, 0xf8, 0xdf,
-    0xff, 0xef, 0x8f, 0xb5, 0xa, 0xf8, 0x10, 0x0,
-    0xaf, 0x80, 0x0, 0xa, 0xf8, 0x0, 0x0, 0xaf,
-    0x80, 0x0, 0xa, 0xf8, 0x0, 0x0, 0xaf, 0x80,
-    0x0, 0xa, 0xf8, 0x0, 0x0, 0xaf, 0x80, 0x0,
-    0xa, 0xf8, 0x0, 0x0, 0xaf, 0x80, 0x0, 0xa,
-    0xf8, 0x0, 0x0, 0xaf, 0x80, 0x0, 0xa, 0xf8,
-    0x0, 0x0, 0xaf, 0x80,
+    0x0, 0xcb, 0x70, 0x7, 0x3f, 0x48, 0x1b, 0x8c,
+    0x2, 0x0, 0x24, 0xaf, 0x40, 0x7, 0x5a, 0x80,
+    0x61, 0x0, 0xff, 0xff, 0x80, 0x7e,
 
     /* U+0032 "2" */
-    0x0, 0x3a, 0xef, 0xfc, 0x60, 0x0, 0x6, 0xff,
-    0xfd, 0xef, 0xfa, 0x0, 0x3f, 0xf6, 0x0, 0x5,
-    0xff, 0x50, 0xaf, 0xa0, 0x0, 0x0, 0x9f, 0xb0,
-    0xdf, 0x50, 0x0, 0x0, 0x6f, 0xc0, 0x22, 0x0,
-    0x0, 0x0, 0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0x50, 0x0, 0x0, 0x0, 0x7, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xf3, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0x50, 0x0, 0x0, 0x0, 0x2e, 0xf7,
-    0x0, 0x0, 0x0, 0x1, 0xdf, 0x80, 0x0, 0x0,
-    0x0, 0x1d, 0xf9, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xa0, 0x0, 0x0, 0x0, 0xb, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xfd, 0xcc, 0xcc, 0xcc, 0xc7,
-    0x9f, 0xff, 0xff, 0xff, 0xff, 0xf9,
+    0x0, 0x1d, 0x77, 0xfb, 0x18, 0x3, 0x36, 0x28,
+    0x90, 0x9c, 0xd0, 0x0, 0xe4, 0x27, 0xf7, 0xa8,
+    0x15, 0x41, 0x20, 0xac, 0x1, 0x2b, 0x7, 0x3,
+    0x87, 0x80, 0x77, 0x83, 0x87, 0xea, 0x80, 0x70,
+    0x83, 0x1, 0x10, 0x3, 0xd6, 0x1e, 0x1, 0xf9,
+    0xcc, 0x94, 0x3, 0xe4, 0x80, 0xe0, 0xf, 0x8e,
+    0xc2, 0x8c, 0x3, 0xc5, 0xa1, 0xa, 0x1, 0xe1,
+    0xf1, 0x77, 0x0, 0x78, 0x70, 0x9a, 0x0, 0x3e,
+    0xd2, 0x59, 0x0, 0xfa, 0xcd, 0x28, 0x3, 0xe7,
+    0x40, 0x6c, 0xcf, 0x9f, 0x80, 0x4, 0x67, 0xf7,
+    0x0,
 
     /* U+0033 "3" */
-    0x0, 0x3a, 0xef, 0xeb, 0x40, 0x0, 0x6f, 0xfe,
-    0xce, 0xff, 0x80, 0x3f, 0xf6, 0x0, 0x5, 0xff,
-    0x39, 0xfa, 0x0, 0x0, 0xb, 0xf8, 0x7a, 0x40,
-    0x0, 0x0, 0x8f, 0xa0, 0x0, 0x0, 0x0, 0x9,
-    0xf9, 0x0, 0x0, 0x0, 0x2, 0xff, 0x30, 0x0,
-    0x26, 0x69, 0xff, 0x60, 0x0, 0x8, 0xff, 0xff,
-    0x90, 0x0, 0x0, 0x25, 0x68, 0xef, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0x80, 0x0, 0x0, 0x0,
-    0x5, 0xfd, 0x78, 0x20, 0x0, 0x0, 0x4f, 0xec,
-    0xf7, 0x0, 0x0, 0x7, 0xfc, 0x6f, 0xf5, 0x0,
-    0x4, 0xff, 0x60, 0x9f, 0xfe, 0xce, 0xff, 0xa0,
-    0x0, 0x4b, 0xef, 0xeb, 0x50, 0x0,
+    0x0, 0x1d, 0x77, 0xf5, 0xa0, 0x4, 0xd8, 0xa0,
+    0x60, 0x97, 0x0, 0x72, 0x13, 0xd9, 0xd4, 0xe,
+    0x74, 0xa, 0xc0, 0x12, 0xa0, 0x5f, 0x2f, 0x0,
+    0x71, 0x81, 0x3d, 0x20, 0x7, 0x8, 0x18, 0x7,
+    0xc4, 0xc1, 0x40, 0x11, 0x33, 0x27, 0x42, 0x4c,
+    0x2, 0xa9, 0x93, 0x3, 0x30, 0x3, 0x55, 0x25,
+    0xc5, 0xb0, 0x3, 0x12, 0xb4, 0x71, 0x9a, 0x0,
+    0x3f, 0x48, 0x2b, 0xc1, 0x0, 0x70, 0x81, 0xdb,
+    0xa8, 0x7, 0x18, 0x15, 0x4, 0x28, 0x4, 0x90,
+    0x14, 0xcc, 0xa, 0xec, 0xeb, 0x5, 0x60, 0x9b,
+    0x40, 0x30, 0x4a, 0xa0, 0x0,
 
     /* U+0034 "4" */
-    0x0, 0x0, 0x0, 0x1, 0xff, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0x90, 0x0, 0x0, 0x0, 0x1e, 0xfb,
-    0xf9, 0x0, 0x0, 0x0, 0xa, 0xf6, 0x9f, 0x90,
-    0x0, 0x0, 0x5, 0xfc, 0x9, 0xf9, 0x0, 0x0,
-    0x1, 0xef, 0x20, 0x9f, 0x90, 0x0, 0x0, 0xaf,
-    0x70, 0x9, 0xf9, 0x0, 0x0, 0x4f, 0xd0, 0x0,
-    0x9f, 0x90, 0x0, 0xe, 0xf3, 0x0, 0x9, 0xf9,
-    0x0, 0x9, 0xf8, 0x0, 0x0, 0x9f, 0x90, 0x3,
-    0xff, 0xdc, 0xcc, 0xce, 0xfe, 0xcc, 0x6f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x9, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0x90, 0x0,
+    0x0, 0xf8, 0x7f, 0xd2, 0x1, 0xfd, 0x40, 0x1f,
+    0xf2, 0xa0, 0x7, 0xf8, 0x6c, 0x10, 0x3, 0xfa,
+    0xc6, 0x48, 0x3, 0xf2, 0xa8, 0xd8, 0x3, 0xf0,
+    0xd8, 0x70, 0x7, 0xf5, 0x8c, 0x10, 0x7, 0xe4,
+    0x52, 0x70, 0xf, 0xea, 0xe, 0x0, 0xfe, 0x91,
+    0x73, 0x0, 0xfc, 0x6c, 0xb, 0x99, 0x9c, 0x1f,
+    0x30, 0xa0, 0x2, 0x33, 0xc2, 0x2, 0x66, 0x6f,
+    0xff, 0x98, 0x1b, 0xfc, 0x1, 0xff, 0xdb,
 
     /* U+0035 "5" */
-    0x0, 0xcf, 0xff, 0xff, 0xff, 0xf0, 0x0, 0xdf,
-    0xff, 0xff, 0xff, 0xf0, 0x0, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x4, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xfc, 0xae, 0xfe,
-    0xa2, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0x30,
-    0x5, 0xdb, 0x20, 0x4, 0xef, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xf7, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf8,
-    0x19, 0x80, 0x0, 0x0, 0xb, 0xf7, 0xf, 0xf3,
-    0x0, 0x0, 0x1f, 0xf4, 0x9, 0xfd, 0x20, 0x1,
-    0xbf, 0xd0, 0x0, 0xcf, 0xfd, 0xdf, 0xfe, 0x30,
-    0x0, 0x7, 0xcf, 0xfe, 0x91, 0x0,
+    0x0, 0x67, 0xff, 0xe0, 0x8, 0x40, 0x3f, 0xe2,
+    0xe, 0xff, 0xf0, 0x0, 0x40, 0x2, 0x1, 0xf8,
+    0xc0, 0x80, 0x3f, 0x98, 0x18, 0x3, 0xf8, 0x41,
+    0xeb, 0xbf, 0xa8, 0x80, 0x22, 0x3, 0x51, 0x1,
+    0x5d, 0x30, 0x1, 0x11, 0x37, 0xfd, 0x62, 0x1c,
+    0x0, 0x5d, 0xb2, 0x0, 0x26, 0x1, 0x20, 0x7,
+    0xe2, 0x30, 0x30, 0xf, 0xe6, 0xf, 0x19, 0x80,
+    0xf, 0x8, 0x78, 0xb3, 0x98, 0x6, 0x14, 0x3,
+    0x6, 0xe, 0x20, 0x0, 0xd0, 0x12, 0x4, 0x99,
+    0x6e, 0xdc, 0x83, 0xc0, 0x16, 0x41, 0x91, 0x5,
+    0xbc, 0xc0,
 
     /* U+0036 "6" */
-    0x0, 0x0, 0x18, 0xce, 0xe0, 0x0, 0x0, 0x6,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x6f, 0xf9, 0x20,
-    0x0, 0x0, 0x2, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0x9, 0xf9, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf3,
-    0x7b, 0xcb, 0x50, 0x0, 0x2f, 0xfd, 0xff, 0xff,
-    0xfb, 0x0, 0x5f, 0xff, 0x61, 0x6, 0xff, 0x70,
-    0x6f, 0xf4, 0x0, 0x0, 0x7f, 0xe0, 0x6f, 0xc0,
-    0x0, 0x0, 0xf, 0xf3, 0x6f, 0xb0, 0x0, 0x0,
-    0xd, 0xf5, 0x6f, 0xc0, 0x0, 0x0, 0xd, 0xf5,
-    0x3f, 0xf0, 0x0, 0x0, 0xf, 0xf3, 0xd, 0xf6,
-    0x0, 0x0, 0x5f, 0xe0, 0x6, 0xff, 0x50, 0x3,
-    0xef, 0x70, 0x0, 0x9f, 0xfe, 0xdf, 0xfb, 0x0,
-    0x0, 0x5, 0xcf, 0xfd, 0x60, 0x0,
+    0x0, 0xc3, 0x19, 0xdc, 0x0, 0xf3, 0x73, 0x98,
+    0x90, 0x7, 0x34, 0x83, 0x6f, 0xe0, 0x6, 0x29,
+    0xa, 0x92, 0x0, 0xf5, 0x83, 0x28, 0x7, 0xe7,
+    0xa, 0x7b, 0xcb, 0x50, 0x8, 0x84, 0x3a, 0x10,
+    0xd2, 0xac, 0x0, 0xe0, 0x2, 0x9e, 0xf9, 0x4,
+    0x70, 0x30, 0x5, 0xb0, 0x83, 0x40, 0x48, 0x4,
+    0x68, 0x1, 0x9c, 0x4, 0xc0, 0xe, 0x1, 0xe2,
+    0x6, 0x0, 0x38, 0x7, 0xf2, 0x81, 0x80, 0x78,
+    0x81, 0x8c, 0x81, 0x80, 0x32, 0x80, 0x98, 0x58,
+    0x4a, 0x80, 0xe, 0xc2, 0x40, 0xc, 0xc0, 0xae,
+    0xdc, 0x14, 0x70, 0xa, 0x68, 0xc4, 0x89, 0x36,
+    0x0,
 
     /* U+0037 "7" */
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x71, 0xcc,
-    0xcc, 0xcc, 0xcc, 0xcf, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x6, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x4, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xf9, 0x0, 0x0, 0x0, 0x0,
+    0x1f, 0xff, 0xf9, 0xc0, 0xcf, 0xf8, 0x0, 0x43,
+    0x99, 0xfb, 0x80, 0x94, 0x3, 0xfa, 0x2, 0x80,
+    0x3f, 0x85, 0x41, 0xc0, 0x3f, 0xa0, 0x1c, 0x3,
+    0xf8, 0x58, 0x24, 0x3, 0xf9, 0x81, 0x44, 0x3,
+    0xfa, 0x42, 0x40, 0x3f, 0x98, 0x50, 0xc0, 0x3f,
+    0xac, 0x3c, 0x3, 0xf9, 0x48, 0x88, 0x1, 0xfd,
+    0x1, 0x60, 0x1f, 0xc8, 0x42, 0xc0, 0x1f, 0xde,
+    0x12, 0x1, 0xfc, 0x68, 0xc, 0x1, 0xfd, 0x20,
+    0xc2, 0x1, 0xe0,
 
     /* U+0038 "8" */
-    0x0, 0x2a, 0xef, 0xfc, 0x60, 0x0, 0x4, 0xff,
-    0xfd, 0xef, 0xfb, 0x0, 0xe, 0xfa, 0x0, 0x4,
-    0xff, 0x60, 0x3f, 0xf0, 0x0, 0x0, 0x8f, 0xb0,
-    0x4f, 0xe0, 0x0, 0x0, 0x6f, 0xc0, 0xf, 0xf3,
-    0x0, 0x0, 0xbf, 0x70, 0x6, 0xff, 0x74, 0x5b,
-    0xfc, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xc0, 0x0,
-    0x4, 0xff, 0xa7, 0x8e, 0xfa, 0x0, 0x1e, 0xf5,
-    0x0, 0x1, 0xcf, 0x80, 0x7f, 0xb0, 0x0, 0x0,
-    0x4f, 0xe0, 0xaf, 0x80, 0x0, 0x0, 0xf, 0xf2,
-    0xaf, 0x80, 0x0, 0x0, 0xf, 0xf2, 0x7f, 0xd0,
-    0x0, 0x0, 0x5f, 0xf0, 0x1f, 0xf9, 0x0, 0x3,
-    0xef, 0x80, 0x4, 0xff, 0xfd, 0xef, 0xfb, 0x0,
-    0x0, 0x29, 0xef, 0xfc, 0x60, 0x0,
+    0x0, 0x15, 0x77, 0xfb, 0x18, 0x3, 0x26, 0xa8,
+    0x90, 0x9c, 0xd8, 0x5, 0x40, 0xbf, 0xbd, 0x60,
+    0x8c, 0x6, 0x21, 0x40, 0x12, 0x38, 0x68, 0x38,
+    0x8, 0x7, 0x70, 0x38, 0x20, 0x9, 0x80, 0x6d,
+    0xb, 0x0, 0x48, 0x63, 0xa2, 0xda, 0x1b, 0x80,
+    0x1a, 0x82, 0x2e, 0x90, 0xf0, 0x2, 0x4a, 0x5,
+    0x87, 0x13, 0xa0, 0x0, 0xd0, 0x55, 0x1e, 0x3c,
+    0xd6, 0x1, 0x85, 0x14, 0x2, 0x18, 0x6, 0xd,
+    0x3, 0x0, 0xe4, 0x1, 0x20, 0xf, 0xfd, 0xa0,
+    0xa0, 0x1c, 0xa0, 0x2, 0x60, 0x29, 0x0, 0x8e,
+    0xc1, 0xc0, 0x6c, 0x1b, 0xf7, 0xb0, 0x52, 0x0,
+    0x9, 0xac, 0x24, 0x27, 0x36, 0x0,
 
     /* U+0039 "9" */
-    0x0, 0x3a, 0xef, 0xea, 0x20, 0x0, 0x5f, 0xff,
-    0xdf, 0xfe, 0x30, 0x1f, 0xf8, 0x0, 0x1b, 0xfd,
-    0x7, 0xfc, 0x0, 0x0, 0xe, 0xf5, 0xbf, 0x60,
-    0x0, 0x0, 0x8f, 0xad, 0xf5, 0x0, 0x0, 0x5,
-    0xfd, 0xcf, 0x60, 0x0, 0x0, 0x4f, 0xe8, 0xfc,
-    0x0, 0x0, 0x8, 0xfe, 0x2f, 0xf8, 0x0, 0x8,
-    0xff, 0xe0, 0x7f, 0xff, 0xdf, 0xfb, 0xfc, 0x0,
-    0x4c, 0xff, 0xc4, 0x5f, 0xa0, 0x0, 0x0, 0x0,
-    0x8, 0xf7, 0x0, 0x0, 0x0, 0x0, 0xef, 0x20,
-    0x0, 0x0, 0x0, 0x9f, 0xb0, 0x0, 0x0, 0x4,
-    0xbf, 0xe2, 0x0, 0x5, 0xef, 0xff, 0xd2, 0x0,
-    0x0, 0x6f, 0xeb, 0x50, 0x0, 0x0,
-
-    /* U+003A ":" */
-    0x2e, 0xd1, 0x6f, 0xf3, 0x8, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0x70, 0x6f, 0xf3,
-    0x2e, 0xd1,
-
-    /* U+003B ";" */
-    0x6, 0xfa, 0xa, 0xff, 0x2, 0x95, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xea, 0x5, 0xfc,
-    0x6, 0xfb, 0x9, 0xf7, 0x1f, 0xf1, 0x3e, 0x50,
-    0x0, 0x0,
-
-    /* U+003C "<" */
-    0x0, 0x0, 0x0, 0x0, 0x18, 0x50, 0x0, 0x0,
-    0x2, 0x9f, 0xf7, 0x0, 0x0, 0x3a, 0xff, 0xfc,
-    0x30, 0x4, 0xbf, 0xff, 0x92, 0x0, 0x1c, 0xff,
-    0xd6, 0x0, 0x0, 0x3, 0xff, 0xa1, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0xfa, 0x30, 0x0, 0x0, 0x0,
-    0x7e, 0xff, 0xd6, 0x0, 0x0, 0x0, 0x6, 0xdf,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0x5c, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0x40,
-
-    /* U+003D "=" */
-    0x3e, 0xee, 0xee, 0xee, 0xee, 0x83, 0xff, 0xff,
-    0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xee, 0xee, 0xee, 0xee,
-    0xe8, 0x3f, 0xff, 0xff, 0xff, 0xff, 0x90,
-
-    /* U+003E ">" */
-    0x58, 0x20, 0x0, 0x0, 0x0, 0x6, 0xff, 0xa3,
-    0x0, 0x0, 0x0, 0x2a, 0xff, 0xfc, 0x50, 0x0,
-    0x0, 0x1, 0x6d, 0xff, 0xe7, 0x0, 0x0, 0x0,
-    0x3, 0x9f, 0xff, 0x60, 0x0, 0x0, 0x0, 0x6f,
-    0xfa, 0x0, 0x0, 0x28, 0xef, 0xfb, 0x30, 0x5,
-    0xbf, 0xff, 0x92, 0x0, 0x4e, 0xff, 0xe7, 0x10,
-    0x0, 0x6, 0xfc, 0x50, 0x0, 0x0, 0x0, 0x34,
-    0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+003F "?" */
-    0x0, 0x19, 0xef, 0xfc, 0x50, 0x0, 0x2e, 0xff,
-    0xff, 0xff, 0x70, 0xb, 0xfc, 0x20, 0x9, 0xff,
-    0x10, 0xff, 0x20, 0x0, 0xe, 0xf5, 0x2, 0x20,
-    0x0, 0x0, 0xcf, 0x60, 0x0, 0x0, 0x0, 0xf,
-    0xf3, 0x0, 0x0, 0x0, 0x9, 0xfc, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0x20, 0x0, 0x0, 0x7, 0xff,
-    0x40, 0x0, 0x0, 0x3, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0xaf, 0xa0, 0x0, 0x0, 0x0, 0xc, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x12, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x37,
-    0x10, 0x0, 0x0, 0x0, 0xd, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0x50, 0x0, 0x0,
-
-    /* U+0040 "@" */
-    0x0, 0x0, 0x0, 0x39, 0xdf, 0xfe, 0xc8, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x1b, 0xff, 0xb9, 0x89,
-    0xcf, 0xf9, 0x0, 0x0, 0x0, 0x2, 0xef, 0x71,
-    0x0, 0x0, 0x1, 0x8f, 0xc0, 0x0, 0x0, 0x1e,
-    0xe3, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf9, 0x0,
-    0x0, 0xbf, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0x30, 0x4, 0xf8, 0x0, 0x0, 0x5d, 0xfe,
-    0x91, 0x0, 0xe, 0x90, 0xb, 0xf1, 0x0, 0x7,
-    0xfd, 0x8a, 0xfd, 0x0, 0x9, 0xe0, 0x1f, 0xa0,
-    0x0, 0x3f, 0xc0, 0x0, 0xfc, 0x0, 0x5, 0xf2,
-    0x4f, 0x60, 0x0, 0xcf, 0x20, 0x0, 0xfb, 0x0,
-    0x3, 0xf4, 0x7f, 0x30, 0x1, 0xfb, 0x0, 0x2,
-    0xf9, 0x0, 0x2, 0xf5, 0x9f, 0x10, 0x5, 0xf7,
-    0x0, 0x3, 0xf8, 0x0, 0x2, 0xf5, 0xaf, 0x0,
-    0x8, 0xf5, 0x0, 0x4, 0xf6, 0x0, 0x3, 0xf4,
-    0xaf, 0x10, 0x9, 0xf4, 0x0, 0x6, 0xf5, 0x0,
-    0x6, 0xf1, 0x9f, 0x20, 0x8, 0xf5, 0x0, 0xa,
-    0xf4, 0x0, 0xb, 0xd0, 0x6f, 0x40, 0x5, 0xfb,
-    0x0, 0x5f, 0xf6, 0x0, 0x3f, 0x70, 0x3f, 0x80,
-    0x0, 0xef, 0xdc, 0xf6, 0xfe, 0x78, 0xfc, 0x0,
-    0xe, 0xe0, 0x0, 0x3c, 0xfd, 0x40, 0x4d, 0xfe,
-    0x80, 0x0, 0x7, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2e,
-    0xf7, 0x0, 0x0, 0x0, 0x2, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xbf, 0xfb, 0x87, 0x8b, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0x9d, 0xff, 0xfc,
-    0x82, 0x0, 0x0, 0x0,
+    0x0, 0x1d, 0x77, 0xf5, 0x10, 0x4, 0xb8, 0xa2,
+    0x42, 0xb8, 0x60, 0x34, 0xf, 0xfb, 0xc8, 0x3c,
+    0xc, 0x7, 0x0, 0x1, 0xb1, 0x25, 0xc0, 0xa0,
+    0xe, 0x60, 0xf6, 0x3, 0x0, 0xed, 0x7, 0x10,
+    0x30, 0xe, 0x10, 0x34, 0xa, 0x0, 0xec, 0x0,
+    0x50, 0x1c, 0x0, 0x50, 0xe0, 0x2, 0x80, 0x7f,
+    0xdf, 0x74, 0x2, 0x7, 0xb3, 0x2, 0x3b, 0xe0,
+    0x60, 0x2, 0x67, 0xfb, 0x13, 0x43, 0x40, 0x3f,
+    0x30, 0x28, 0x7, 0xd2, 0x28, 0x40, 0x1c, 0x96,
+    0xc3, 0x20, 0x12, 0xf7, 0xda, 0x16, 0x10, 0x4,
+    0x62, 0x24, 0xad, 0x20, 0x0,
 
     /* U+0041 "A" */
-    0x0, 0x0, 0x0, 0x5f, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xf9, 0xef, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xf3, 0x8f, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xd0, 0x2f, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0x70, 0xd, 0xf5, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0x20, 0x7, 0xfb, 0x0, 0x0,
-    0x0, 0x6, 0xfc, 0x0, 0x1, 0xff, 0x10, 0x0,
-    0x0, 0xc, 0xf6, 0x0, 0x0, 0xbf, 0x70, 0x0,
-    0x0, 0x2f, 0xf1, 0x0, 0x0, 0x5f, 0xd0, 0x0,
-    0x0, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x0,
-    0x0, 0xef, 0xee, 0xee, 0xee, 0xef, 0xfa, 0x0,
-    0x5, 0xfe, 0x0, 0x0, 0x0, 0x4, 0xff, 0x0,
-    0xb, 0xf9, 0x0, 0x0, 0x0, 0x0, 0xef, 0x60,
-    0x1f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xc0,
-    0x7f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf2,
+    0x0, 0xf2, 0xff, 0x80, 0x3f, 0xf8, 0x3c, 0x0,
+    0x60, 0xf, 0xf8, 0x50, 0x1, 0x40, 0x1f, 0xf4,
+    0x83, 0x9, 0x90, 0x7, 0xf9, 0x42, 0x98, 0x28,
+    0x3, 0xf9, 0x8, 0x87, 0x40, 0xc0, 0x1f, 0xdc,
+    0x14, 0x4, 0x41, 0x50, 0xf, 0x85, 0x41, 0x40,
+    0x14, 0x1c, 0x1, 0xf3, 0x81, 0x90, 0x1, 0x81,
+    0x4, 0x3, 0xd4, 0x14, 0x1, 0xa, 0x3, 0x0,
+    0x71, 0x18, 0x38, 0x6, 0xe0, 0xa0, 0xe, 0xa0,
+    0x7, 0x7f, 0xea, 0x2, 0x40, 0xc, 0xc0, 0x23,
+    0xf0, 0x3, 0x80, 0x25, 0x11, 0x77, 0x7d, 0x60,
+    0xa0, 0x17, 0x3, 0x80, 0x7c, 0x82, 0xc, 0x2,
+    0x81, 0x40, 0x1f, 0x98, 0x28, 0x18, 0x8, 0xc0,
+    0x3f, 0x50, 0x19, 0x0,
 
     /* U+0042 "B" */
-    0xf, 0xff, 0xff, 0xff, 0xd8, 0x10, 0x0, 0xff,
-    0xee, 0xee, 0xff, 0xfe, 0x20, 0xf, 0xf4, 0x0,
-    0x0, 0x3d, 0xfc, 0x0, 0xff, 0x40, 0x0, 0x0,
-    0x4f, 0xf0, 0xf, 0xf4, 0x0, 0x0, 0x2, 0xff,
-    0x20, 0xff, 0x40, 0x0, 0x0, 0x5f, 0xf0, 0xf,
-    0xf4, 0x0, 0x0, 0x3e, 0xf8, 0x0, 0xff, 0xee,
-    0xee, 0xff, 0xf8, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0xff, 0xa1, 0x0, 0xff, 0x40, 0x0, 0x3, 0xcf,
-    0xc0, 0xf, 0xf4, 0x0, 0x0, 0x0, 0xff, 0x50,
-    0xff, 0x40, 0x0, 0x0, 0xb, 0xf8, 0xf, 0xf4,
-    0x0, 0x0, 0x0, 0xbf, 0x90, 0xff, 0x40, 0x0,
-    0x0, 0xe, 0xf6, 0xf, 0xf4, 0x0, 0x0, 0x2b,
-    0xff, 0x10, 0xff, 0xed, 0xdd, 0xef, 0xff, 0x40,
-    0xf, 0xff, 0xff, 0xff, 0xd9, 0x20, 0x0,
-
-    /* U+0043 "C" */
-    0x0, 0x0, 0x7c, 0xff, 0xeb, 0x40, 0x0, 0x0,
-    0x3e, 0xff, 0xee, 0xff, 0xf9, 0x0, 0x2, 0xef,
-    0xc3, 0x0, 0x6, 0xff, 0x70, 0xa, 0xfc, 0x0,
-    0x0, 0x0, 0x6f, 0xf0, 0x1f, 0xf4, 0x0, 0x0,
-    0x0, 0xf, 0xf5, 0x5f, 0xe0, 0x0, 0x0, 0x0,
-    0x6, 0x94, 0x8f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xe0, 0x0,
-    0x0, 0x0, 0x6, 0x84, 0x1f, 0xf3, 0x0, 0x0,
-    0x0, 0xf, 0xf5, 0xa, 0xfc, 0x0, 0x0, 0x0,
-    0x6f, 0xf0, 0x2, 0xff, 0xb2, 0x0, 0x6, 0xff,
-    0x70, 0x0, 0x3e, 0xff, 0xed, 0xff, 0xf9, 0x0,
-    0x0, 0x1, 0x8d, 0xff, 0xea, 0x40, 0x0,
+    0xf, 0xff, 0xb6, 0x4, 0x3, 0x84, 0x70, 0x13,
+    0xf9, 0x0, 0x6a, 0xee, 0xbf, 0x8, 0x78, 0x3,
+    0xf8, 0xe4, 0xc, 0x3, 0xfc, 0xc0, 0x2, 0x0,
+    0xfe, 0x70, 0x1, 0x0, 0x7e, 0x3b, 0x7, 0x0,
+    0xd5, 0xdd, 0x7e, 0xb, 0xc0, 0x6, 0x11, 0xc0,
+    0x11, 0x8, 0x6, 0xbf, 0xfd, 0x86, 0xba, 0x1,
+    0xfc, 0x78, 0x6, 0xa0, 0x1f, 0xe4, 0xd, 0x0,
+    0xff, 0xc2, 0x1, 0xfe, 0x50, 0xf0, 0xf, 0xc5,
+    0x62, 0xe, 0x1, 0x56, 0xed, 0xda, 0x81, 0x62,
+    0x1, 0x9, 0x14, 0x24, 0xda, 0x80,
 
     /* U+0044 "D" */
-    0xf, 0xff, 0xff, 0xfd, 0x92, 0x0, 0x0, 0xf,
-    0xfe, 0xee, 0xef, 0xff, 0x70, 0x0, 0xf, 0xf4,
-    0x0, 0x1, 0x8f, 0xf8, 0x0, 0xf, 0xf4, 0x0,
-    0x0, 0x4, 0xff, 0x30, 0xf, 0xf4, 0x0, 0x0,
-    0x0, 0x9f, 0xb0, 0xf, 0xf4, 0x0, 0x0, 0x0,
-    0x3f, 0xf0, 0xf, 0xf4, 0x0, 0x0, 0x0, 0xf,
-    0xf3, 0xf, 0xf4, 0x0, 0x0, 0x0, 0xe, 0xf4,
-    0xf, 0xf4, 0x0, 0x0, 0x0, 0xe, 0xf5, 0xf,
-    0xf4, 0x0, 0x0, 0x0, 0xe, 0xf5, 0xf, 0xf4,
-    0x0, 0x0, 0x0, 0xf, 0xf3, 0xf, 0xf4, 0x0,
-    0x0, 0x0, 0x4f, 0xf0, 0xf, 0xf4, 0x0, 0x0,
-    0x0, 0xaf, 0xb0, 0xf, 0xf4, 0x0, 0x0, 0x5,
-    0xff, 0x30, 0xf, 0xf4, 0x0, 0x1, 0x8f, 0xf8,
-    0x0, 0xf, 0xfe, 0xdd, 0xef, 0xff, 0x70, 0x0,
-    0xf, 0xff, 0xff, 0xfc, 0x82, 0x0, 0x0,
-
-    /* U+0045 "E" */
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xf, 0xfe,
-    0xee, 0xee, 0xee, 0xe9, 0xf, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xf4, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xfe, 0xdd, 0xdd, 0xdd, 0x80,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xa0, 0xf, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xf4, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xfe, 0xdd, 0xdd, 0xdd, 0xdb,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xfd,
+    0xf, 0xff, 0x6c, 0x90, 0x7, 0xc2, 0x38, 0x9b,
+    0x5c, 0x3, 0xd5, 0xdd, 0x9c, 0x22, 0x0, 0x1f,
+    0xc3, 0x16, 0xe, 0x60, 0x1f, 0xe4, 0x60, 0x80,
+    0xf, 0xfa, 0x81, 0x0, 0x3f, 0xe3, 0x0, 0x18,
+    0x7, 0xfc, 0x20, 0xe0, 0x1f, 0xfc, 0x11, 0x0,
+    0xff, 0xe6, 0x88, 0x30, 0x7, 0xf9, 0x0, 0x6,
+    0x1, 0xfe, 0xe0, 0x40, 0xf, 0xf2, 0xa8, 0x20,
+    0x3, 0xf0, 0xc5, 0x3, 0x98, 0x6, 0xad, 0xd7,
+    0x71, 0xc2, 0x20, 0x1, 0xc2, 0x44, 0x13, 0x7d,
+    0x70, 0x8,
 
     /* U+0046 "F" */
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xf, 0xfe,
-    0xee, 0xee, 0xee, 0xe7, 0xf, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xf4, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xfe, 0xdd, 0xdd, 0xdd, 0x50,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0x60, 0xf, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xf4, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xf4, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0047 "G" */
-    0x0, 0x1, 0x8d, 0xff, 0xeb, 0x60, 0x0, 0x0,
-    0x4e, 0xff, 0xfe, 0xff, 0xfc, 0x10, 0x2, 0xff,
-    0xc3, 0x0, 0x5, 0xef, 0xb0, 0xb, 0xfc, 0x0,
-    0x0, 0x0, 0x3f, 0xf3, 0x1f, 0xf4, 0x0, 0x0,
-    0x0, 0xb, 0xe7, 0x5f, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xb0, 0x0, 0x8, 0xdd, 0xdd, 0xd8, 0x8f,
-    0xb0, 0x0, 0x9, 0xff, 0xff, 0xf9, 0x7f, 0xc0,
-    0x0, 0x0, 0x0, 0xa, 0xf9, 0x4f, 0xf0, 0x0,
-    0x0, 0x0, 0xa, 0xf9, 0xf, 0xf6, 0x0, 0x0,
-    0x0, 0xa, 0xf9, 0x9, 0xfe, 0x10, 0x0, 0x0,
-    0xa, 0xf9, 0x1, 0xdf, 0xe4, 0x0, 0x1, 0x7f,
-    0xf7, 0x0, 0x1c, 0xff, 0xfd, 0xef, 0xff, 0x90,
-    0x0, 0x0, 0x6b, 0xef, 0xfd, 0x93, 0x0,
+    0xf, 0xff, 0xf4, 0x0, 0x42, 0x3f, 0xbc, 0x2,
+    0xae, 0xef, 0x9c, 0x3, 0xff, 0xcf, 0x5b, 0xbe,
+    0x50, 0xc, 0x24, 0x5e, 0x30, 0xd, 0x7f, 0xfe,
+    0x60, 0xf, 0xff, 0xf8, 0x7, 0xf8,
 
     /* U+0048 "H" */
-    0xf, 0xf4, 0x0, 0x0, 0x0, 0x2, 0xff, 0x10,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x2f, 0xf1, 0xf,
-    0xf4, 0x0, 0x0, 0x0, 0x2, 0xff, 0x10, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x2f, 0xf1, 0xf, 0xf4,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0x10, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x2f, 0xf1, 0xf, 0xf4, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0x10, 0xff, 0xed, 0xdd,
-    0xdd, 0xdd, 0xef, 0xf1, 0xf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x10, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x2f, 0xf1, 0xf, 0xf4, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0x10, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x2f, 0xf1, 0xf, 0xf4, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0x10, 0xff, 0x40, 0x0, 0x0, 0x0, 0x2f,
-    0xf1, 0xf, 0xf4, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0x10, 0xff, 0x40, 0x0, 0x0, 0x0, 0x2f, 0xf1,
-    0xf, 0xf4, 0x0, 0x0, 0x0, 0x2, 0xff, 0x10,
-
-    /* U+0049 "I" */
-    0xdf, 0x6d, 0xf6, 0xdf, 0x6d, 0xf6, 0xdf, 0x6d,
-    0xf6, 0xdf, 0x6d, 0xf6, 0xdf, 0x6d, 0xf6, 0xdf,
-    0x6d, 0xf6, 0xdf, 0x6d, 0xf6, 0xdf, 0x6d, 0xf6,
-    0xdf, 0x60,
-
-    /* U+004A "J" */
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xf6, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xf6, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xf6, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf6,
-    0x5e, 0xd0, 0x0, 0x0, 0xe, 0xf5, 0x3f, 0xf2,
-    0x0, 0x0, 0x3f, 0xf2, 0xd, 0xfc, 0x20, 0x2,
-    0xdf, 0xc0, 0x3, 0xff, 0xfe, 0xef, 0xfe, 0x20,
-    0x0, 0x19, 0xdf, 0xfd, 0x81, 0x0,
-
-    /* U+004B "K" */
-    0xf, 0xf4, 0x0, 0x0, 0x0, 0x9f, 0xe2, 0x0,
-    0xff, 0x40, 0x0, 0x0, 0x8f, 0xf3, 0x0, 0xf,
-    0xf4, 0x0, 0x0, 0x6f, 0xf5, 0x0, 0x0, 0xff,
-    0x40, 0x0, 0x5f, 0xf6, 0x0, 0x0, 0xf, 0xf4,
-    0x0, 0x4f, 0xf8, 0x0, 0x0, 0x0, 0xff, 0x40,
-    0x3f, 0xfa, 0x0, 0x0, 0x0, 0xf, 0xf4, 0x2e,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0xff, 0x5d, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0xf, 0xfe, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xfd, 0x7f, 0xf5,
-    0x0, 0x0, 0x0, 0xf, 0xfd, 0x10, 0x9f, 0xf2,
-    0x0, 0x0, 0x0, 0xff, 0x40, 0x0, 0xcf, 0xd0,
-    0x0, 0x0, 0xf, 0xf4, 0x0, 0x2, 0xef, 0xa0,
-    0x0, 0x0, 0xff, 0x40, 0x0, 0x4, 0xff, 0x60,
-    0x0, 0xf, 0xf4, 0x0, 0x0, 0x8, 0xff, 0x30,
-    0x0, 0xff, 0x40, 0x0, 0x0, 0xc, 0xfd, 0x0,
-    0xf, 0xf4, 0x0, 0x0, 0x0, 0x1e, 0xfa, 0x0,
+    0xf, 0xf2, 0x0, 0x7c, 0x5f, 0xe1, 0x0, 0xff,
+    0xff, 0x80, 0x7f, 0xf1, 0xab, 0x77, 0xec, 0x0,
+    0xf0, 0x91, 0x7c, 0x20, 0x1e, 0xbf, 0xff, 0xb4,
+    0x3, 0xff, 0xfe, 0x1, 0xff, 0xd5,
 
     /* U+004C "L" */
-    0xf, 0xf4, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xf4, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xf4, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xf4, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xfe, 0xdd, 0xdd, 0xdd, 0xd4,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xf5,
+    0xf, 0xf2, 0x0, 0x7f, 0xff, 0xc0, 0x3f, 0xff,
+    0xe0, 0x1f, 0xfd, 0x1a, 0xdd, 0xf9, 0x0, 0x21,
+    0x22, 0xf8, 0x40,
 
     /* U+004D "M" */
-    0xf, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0xf, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xff, 0xf, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xff, 0xf, 0xfe, 0xf4, 0x0, 0x0,
-    0x0, 0x5, 0xfe, 0xff, 0xf, 0xf8, 0xfb, 0x0,
-    0x0, 0x0, 0xc, 0xf8, 0xff, 0xf, 0xf2, 0xff,
-    0x10, 0x0, 0x0, 0x2f, 0xf3, 0xff, 0xf, 0xf1,
-    0xaf, 0x80, 0x0, 0x0, 0x8f, 0x92, 0xff, 0xf,
-    0xf2, 0x4f, 0xe0, 0x0, 0x0, 0xef, 0x33, 0xff,
-    0xf, 0xf2, 0xd, 0xf5, 0x0, 0x5, 0xfc, 0x3,
-    0xff, 0xf, 0xf3, 0x7, 0xfb, 0x0, 0xc, 0xf6,
-    0x4, 0xff, 0xf, 0xf3, 0x1, 0xff, 0x20, 0x2f,
-    0xf0, 0x4, 0xff, 0xf, 0xf3, 0x0, 0xaf, 0x80,
-    0x9f, 0x90, 0x4, 0xff, 0xf, 0xf3, 0x0, 0x3f,
-    0xe1, 0xef, 0x20, 0x4, 0xff, 0xf, 0xf3, 0x0,
-    0xd, 0xfb, 0xfc, 0x0, 0x4, 0xff, 0xf, 0xf3,
-    0x0, 0x6, 0xff, 0xf5, 0x0, 0x4, 0xff, 0xf,
-    0xf3, 0x0, 0x0, 0xff, 0xe0, 0x0, 0x4, 0xff,
-    0xf, 0xf3, 0x0, 0x0, 0x9f, 0x80, 0x0, 0x4,
-    0xff,
+    0xf, 0xf8, 0x40, 0x3f, 0x8b, 0xfe, 0x0, 0xcc,
+    0x1, 0xfd, 0x40, 0x1f, 0x48, 0x7, 0xf3, 0x0,
+    0x78, 0x44, 0x80, 0x1f, 0x28, 0x88, 0x3, 0x98,
+    0x3c, 0x3, 0xe9, 0x6, 0x0, 0xea, 0x4, 0x10,
+    0xe, 0x23, 0xb, 0x0, 0xe3, 0x50, 0x90, 0xe,
+    0xa0, 0x61, 0x0, 0xe3, 0xe0, 0x60, 0xe, 0x60,
+    0xa1, 0x0, 0xf2, 0x10, 0xa8, 0x4, 0xa2, 0x66,
+    0x0, 0xf0, 0x85, 0x7, 0x0, 0x52, 0x14, 0xe,
+    0x1, 0xf3, 0x2, 0x10, 0x11, 0x83, 0x0, 0x7f,
+    0xa, 0x85, 0x5, 0x83, 0x0, 0x7f, 0xd2, 0xc,
+    0x2e, 0x16, 0x1, 0xff, 0x19, 0xd, 0x9, 0x90,
+    0x7, 0xfe, 0xb0, 0x40, 0x90, 0xf, 0xfe, 0xb,
+    0x0, 0x5, 0x40, 0x3f, 0xf8, 0x4c, 0xc, 0x1,
+    0xf0,
 
     /* U+004E "N" */
-    0xf, 0xf9, 0x0, 0x0, 0x0, 0x2, 0xff, 0x10,
-    0xff, 0xf3, 0x0, 0x0, 0x0, 0x2f, 0xf1, 0xf,
-    0xff, 0xd0, 0x0, 0x0, 0x2, 0xff, 0x10, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x2f, 0xf1, 0xf, 0xf9,
-    0xff, 0x30, 0x0, 0x2, 0xff, 0x10, 0xff, 0x4b,
-    0xfd, 0x0, 0x0, 0x2f, 0xf1, 0xf, 0xf4, 0x1f,
-    0xf8, 0x0, 0x2, 0xff, 0x10, 0xff, 0x40, 0x6f,
-    0xf3, 0x0, 0x2f, 0xf1, 0xf, 0xf4, 0x0, 0xbf,
-    0xc0, 0x2, 0xff, 0x10, 0xff, 0x40, 0x2, 0xff,
-    0x70, 0x2f, 0xf1, 0xf, 0xf4, 0x0, 0x6, 0xff,
-    0x22, 0xff, 0x10, 0xff, 0x40, 0x0, 0xc, 0xfc,
-    0x2f, 0xf1, 0xf, 0xf4, 0x0, 0x0, 0x2f, 0xf9,
-    0xff, 0x10, 0xff, 0x40, 0x0, 0x0, 0x7f, 0xff,
-    0xf1, 0xf, 0xf4, 0x0, 0x0, 0x0, 0xcf, 0xff,
-    0x10, 0xff, 0x40, 0x0, 0x0, 0x2, 0xff, 0xf1,
-    0xf, 0xf4, 0x0, 0x0, 0x0, 0x8, 0xff, 0x10,
+    0xf, 0xf4, 0x80, 0x7c, 0x5f, 0xe1, 0x0, 0x98,
+    0xc0, 0x3f, 0xf8, 0x5c, 0x1, 0xff, 0xc2, 0x28,
+    0x0, 0xff, 0xcc, 0xe, 0x60, 0x1f, 0xf6, 0xa0,
+    0x70, 0x7, 0xfe, 0xa0, 0x28, 0x0, 0xff, 0x86,
+    0x41, 0xcc, 0x3, 0xfe, 0x64, 0xf, 0x0, 0xff,
+    0xd2, 0x6, 0xe0, 0x1f, 0xf1, 0x48, 0x41, 0x0,
+    0x7f, 0xcc, 0x61, 0xc0, 0x1f, 0xfb, 0x80, 0xec,
+    0x3, 0xfe, 0x28, 0x6, 0x0, 0xff, 0xce, 0x60,
+    0x1f, 0xfc, 0x2e, 0x0, 0xff, 0xe1, 0x13, 0x80,
+    0x40,
 
     /* U+004F "O" */
-    0x0, 0x0, 0x7c, 0xff, 0xea, 0x30, 0x0, 0x0,
-    0x2, 0xdf, 0xff, 0xff, 0xff, 0x80, 0x0, 0x1,
-    0xef, 0xd4, 0x0, 0x18, 0xff, 0x80, 0x0, 0x9f,
-    0xd1, 0x0, 0x0, 0x5, 0xff, 0x20, 0x1f, 0xf4,
-    0x0, 0x0, 0x0, 0xc, 0xf9, 0x5, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xd0, 0x8f, 0xb0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0x9, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xf1, 0x9f, 0xa0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0x29, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xf1, 0x8f, 0xb0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0x5, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xd0, 0x1f, 0xf4, 0x0, 0x0, 0x0, 0xc,
-    0xf9, 0x0, 0x9f, 0xd1, 0x0, 0x0, 0x5, 0xff,
-    0x20, 0x1, 0xef, 0xd4, 0x0, 0x17, 0xff, 0x80,
-    0x0, 0x2, 0xdf, 0xff, 0xef, 0xff, 0x90, 0x0,
-    0x0, 0x0, 0x7c, 0xff, 0xea, 0x40, 0x0, 0x0,
-
-    /* U+0050 "P" */
-    0xf, 0xff, 0xff, 0xff, 0xeb, 0x50, 0x0, 0xf,
-    0xfe, 0xee, 0xee, 0xff, 0xfb, 0x0, 0xf, 0xf4,
-    0x0, 0x0, 0x6, 0xff, 0x90, 0xf, 0xf4, 0x0,
-    0x0, 0x0, 0x6f, 0xf0, 0xf, 0xf4, 0x0, 0x0,
-    0x0, 0x1f, 0xf3, 0xf, 0xf4, 0x0, 0x0, 0x0,
-    0xf, 0xf3, 0xf, 0xf4, 0x0, 0x0, 0x0, 0x5f,
-    0xf1, 0xf, 0xf4, 0x0, 0x0, 0x4, 0xef, 0xa0,
-    0xf, 0xfe, 0xdd, 0xdd, 0xff, 0xfc, 0x10, 0xf,
-    0xff, 0xff, 0xff, 0xec, 0x60, 0x0, 0xf, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0051 "Q" */
-    0x0, 0x1, 0x7c, 0xff, 0xe9, 0x20, 0x0, 0x0,
-    0x3, 0xef, 0xff, 0xff, 0xff, 0x70, 0x0, 0x2,
-    0xff, 0xc4, 0x0, 0x29, 0xff, 0x60, 0x0, 0xbf,
-    0xc0, 0x0, 0x0, 0x7, 0xff, 0x10, 0x2f, 0xf3,
-    0x0, 0x0, 0x0, 0xd, 0xf7, 0x7, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xc0, 0x9f, 0xa0, 0x0,
-    0x0, 0x0, 0x5, 0xfe, 0xb, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xf0, 0xbf, 0x80, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xb, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xf0, 0x9f, 0xa0, 0x0, 0x0, 0x0,
-    0x5, 0xfe, 0x7, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xc0, 0x2f, 0xf3, 0x0, 0x0, 0x0, 0xd,
-    0xf7, 0x0, 0xbf, 0xc0, 0x0, 0x0, 0x7, 0xff,
-    0x10, 0x2, 0xff, 0xc3, 0x0, 0x18, 0xff, 0x60,
-    0x0, 0x3, 0xef, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x1, 0x7c, 0xff, 0xef, 0xfc, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3e, 0xfe, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1c, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0x0,
+    0x0, 0xcf, 0x9f, 0xee, 0xa3, 0x0, 0xf1, 0x6c,
+    0x18, 0x0, 0x57, 0x20, 0x3, 0xe, 0x11, 0x2f,
+    0xfd, 0xce, 0xf, 0x0, 0x14, 0x9, 0x62, 0x0,
+    0x6, 0x28, 0x1c, 0x80, 0x58, 0x24, 0x40, 0x39,
+    0x4c, 0x2c, 0x10, 0x5, 0x0, 0x3e, 0xa0, 0x40,
+    0xd0, 0x50, 0xf, 0xca, 0x4, 0x2, 0x2, 0x1,
+    0xf8, 0x40, 0x2, 0x1, 0xff, 0xc2, 0x30, 0xf,
+    0xfe, 0x11, 0x88, 0x8, 0x7, 0xe1, 0x0, 0xe,
+    0x82, 0x80, 0x7e, 0x50, 0x20, 0x40, 0x14, 0x0,
+    0xfa, 0x81, 0x0, 0x58, 0x24, 0x40, 0x39, 0x4c,
+    0x2c, 0x1, 0x2, 0x58, 0x80, 0x1, 0x7a, 0x7,
+    0x20, 0x0, 0xe1, 0x12, 0xff, 0xb9, 0x0, 0xd0,
+    0x1, 0x8b, 0x60, 0xc0, 0x44, 0xb7, 0x20, 0x10,
 
     /* U+0052 "R" */
-    0xf, 0xff, 0xff, 0xff, 0xd8, 0x20, 0x0, 0xf,
-    0xfe, 0xee, 0xef, 0xff, 0xf4, 0x0, 0xf, 0xf4,
-    0x0, 0x0, 0x2c, 0xff, 0x10, 0xf, 0xf4, 0x0,
-    0x0, 0x0, 0xff, 0x60, 0xf, 0xf4, 0x0, 0x0,
-    0x0, 0xbf, 0x90, 0xf, 0xf4, 0x0, 0x0, 0x0,
-    0xbf, 0x90, 0xf, 0xf4, 0x0, 0x0, 0x1, 0xff,
-    0x60, 0xf, 0xf4, 0x0, 0x0, 0x3c, 0xfe, 0x0,
-    0xf, 0xfe, 0xdd, 0xde, 0xff, 0xe2, 0x0, 0xf,
-    0xff, 0xff, 0xff, 0xfa, 0x0, 0x0, 0xf, 0xf4,
-    0x0, 0x7, 0xfd, 0x0, 0x0, 0xf, 0xf4, 0x0,
-    0x0, 0xef, 0x60, 0x0, 0xf, 0xf4, 0x0, 0x0,
-    0x6f, 0xe0, 0x0, 0xf, 0xf4, 0x0, 0x0, 0xd,
-    0xf7, 0x0, 0xf, 0xf4, 0x0, 0x0, 0x5, 0xff,
-    0x10, 0xf, 0xf4, 0x0, 0x0, 0x0, 0xdf, 0x90,
-    0xf, 0xf4, 0x0, 0x0, 0x0, 0x4f, 0xf2,
+    0xf, 0xff, 0xb6, 0x8, 0x3, 0xc2, 0x38, 0x9,
+    0xf5, 0x0, 0x3a, 0xbb, 0xaf, 0xd3, 0xb, 0x10,
+    0xf, 0xe2, 0xc0, 0x3, 0x80, 0x7f, 0xc8, 0x1e,
+    0x1, 0xff, 0xcc, 0x14, 0xf, 0x0, 0xfe, 0x3d,
+    0x1, 0x60, 0xd, 0x5b, 0xb7, 0x61, 0x8e, 0x0,
+    0x70, 0x91, 0x42, 0xb, 0xc4, 0x1, 0xd7, 0xff,
+    0x40, 0x38, 0x7, 0xfc, 0xe2, 0x4c, 0x1, 0xff,
+    0x40, 0x40, 0x7, 0xfc, 0xc4, 0x2e, 0x1, 0xff,
+    0x40, 0x40, 0x80, 0x7f, 0x94, 0x82, 0x0, 0x3f,
+    0xe9, 0x6, 0x20,
 
     /* U+0053 "S" */
-    0x0, 0x1, 0x7c, 0xff, 0xeb, 0x40, 0x0, 0x0,
-    0x3e, 0xff, 0xee, 0xff, 0xf9, 0x0, 0x0, 0xef,
-    0xb2, 0x0, 0x5, 0xff, 0x80, 0x6, 0xfe, 0x0,
-    0x0, 0x0, 0x5f, 0xf0, 0x8, 0xfc, 0x0, 0x0,
-    0x0, 0xf, 0xf4, 0x5, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xd4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2d, 0xff, 0xd8, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x6d, 0xff, 0xfe, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x38, 0xdf, 0xfd, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xdf, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xf3, 0xf, 0xf4, 0x0, 0x0,
-    0x0, 0xf, 0xf5, 0xc, 0xfa, 0x0, 0x0, 0x0,
-    0x2f, 0xf3, 0x4, 0xff, 0x92, 0x0, 0x3, 0xdf,
-    0xd0, 0x0, 0x5f, 0xff, 0xed, 0xef, 0xfe, 0x20,
-    0x0, 0x1, 0x7c, 0xff, 0xec, 0x70, 0x0,
+    0x0, 0x85, 0xf3, 0xfd, 0xd6, 0x80, 0x1c, 0x7f,
+    0x6, 0x23, 0x25, 0xc8, 0x6, 0xd1, 0x4d, 0xee,
+    0x7d, 0x3, 0x40, 0x1, 0x84, 0x56, 0x40, 0x12,
+    0xd0, 0x38, 0x3, 0x80, 0x80, 0x3c, 0xa0, 0x4,
+    0xd, 0x3, 0x10, 0xf, 0x7f, 0x90, 0x14, 0x43,
+    0x10, 0x3, 0xfd, 0x84, 0x4b, 0xd8, 0x30, 0xf,
+    0x8b, 0x64, 0x88, 0xf9, 0xce, 0x1, 0xf3, 0x6e,
+    0x39, 0xc, 0x69, 0x0, 0x7c, 0x71, 0xb8, 0x44,
+    0xe0, 0xf, 0xf1, 0xf8, 0x19, 0x83, 0xfc, 0x80,
+    0x1e, 0x20, 0x3, 0x1, 0x87, 0x0, 0x78, 0x80,
+    0xc, 0x10, 0xb, 0x24, 0x1, 0x1f, 0x81, 0x18,
+    0x25, 0x3, 0x6f, 0x6f, 0x61, 0xf, 0x80, 0x4b,
+    0xd0, 0x62, 0x40, 0x71, 0xc4, 0x0,
 
     /* U+0054 "T" */
-    0x6f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x5e,
-    0xee, 0xee, 0xff, 0xee, 0xee, 0xea, 0x0, 0x0,
-    0x0, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0x40, 0x0, 0x0,
+    0x6f, 0xff, 0xfd, 0x86, 0x23, 0xc0, 0x1, 0x1e,
+    0x65, 0xee, 0xe0, 0x5, 0x77, 0x6a, 0x0, 0xff,
+    0xff, 0x80, 0x7f, 0xff, 0xc0, 0x3f, 0xfc, 0x40,
 
     /* U+0055 "U" */
-    0x5f, 0xe0, 0x0, 0x0, 0x0, 0x4f, 0xf5, 0xfe,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0x5f, 0xe0, 0x0,
-    0x0, 0x0, 0x4f, 0xf5, 0xfe, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0x5f, 0xe0, 0x0, 0x0, 0x0, 0x4f,
-    0xf5, 0xfe, 0x0, 0x0, 0x0, 0x4, 0xff, 0x5f,
-    0xe0, 0x0, 0x0, 0x0, 0x4f, 0xf5, 0xfe, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0x5f, 0xe0, 0x0, 0x0,
-    0x0, 0x4f, 0xf5, 0xfe, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0x5f, 0xe0, 0x0, 0x0, 0x0, 0x4f, 0xf5,
-    0xfe, 0x0, 0x0, 0x0, 0x4, 0xff, 0x4f, 0xf0,
-    0x0, 0x0, 0x0, 0x6f, 0xe0, 0xff, 0x60, 0x0,
-    0x0, 0xc, 0xfa, 0x8, 0xff, 0x60, 0x0, 0x2a,
-    0xff, 0x20, 0xa, 0xff, 0xfd, 0xef, 0xfe, 0x40,
-    0x0, 0x4, 0xae, 0xff, 0xc8, 0x10, 0x0,
-
-    /* U+0056 "V" */
-    0x7f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xc1,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0xf, 0xf6, 0xb,
-    0xfa, 0x0, 0x0, 0x0, 0x5, 0xff, 0x10, 0x5f,
-    0xf0, 0x0, 0x0, 0x0, 0xbf, 0xa0, 0x0, 0xff,
-    0x50, 0x0, 0x0, 0x1f, 0xf4, 0x0, 0x9, 0xfb,
-    0x0, 0x0, 0x6, 0xfe, 0x0, 0x0, 0x4f, 0xf1,
-    0x0, 0x0, 0xcf, 0x80, 0x0, 0x0, 0xdf, 0x60,
-    0x0, 0x1f, 0xf2, 0x0, 0x0, 0x8, 0xfb, 0x0,
-    0x7, 0xfd, 0x0, 0x0, 0x0, 0x2f, 0xf1, 0x0,
-    0xcf, 0x70, 0x0, 0x0, 0x0, 0xcf, 0x60, 0x2f,
-    0xf1, 0x0, 0x0, 0x0, 0x6, 0xfc, 0x7, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xf1, 0xdf, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xaf, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xd0, 0x0, 0x0, 0x0,
-
-    /* U+0057 "W" */
-    0x2f, 0xf1, 0x0, 0x0, 0x4, 0xfe, 0x0, 0x0,
-    0x0, 0x9f, 0xa0, 0xef, 0x50, 0x0, 0x0, 0x9f,
-    0xf2, 0x0, 0x0, 0xd, 0xf6, 0xa, 0xf8, 0x0,
-    0x0, 0xd, 0xff, 0x70, 0x0, 0x1, 0xff, 0x20,
-    0x6f, 0xc0, 0x0, 0x2, 0xfe, 0xfb, 0x0, 0x0,
-    0x4f, 0xe0, 0x3, 0xff, 0x0, 0x0, 0x6f, 0x9e,
-    0xf0, 0x0, 0x8, 0xfb, 0x0, 0xe, 0xf3, 0x0,
-    0xb, 0xf4, 0xaf, 0x40, 0x0, 0xbf, 0x70, 0x0,
-    0xbf, 0x70, 0x0, 0xff, 0x5, 0xf8, 0x0, 0xf,
-    0xf3, 0x0, 0x7, 0xfb, 0x0, 0x4f, 0xb0, 0x1f,
-    0xd0, 0x3, 0xff, 0x0, 0x0, 0x3f, 0xe0, 0x9,
-    0xf6, 0x0, 0xcf, 0x10, 0x6f, 0xb0, 0x0, 0x0,
-    0xff, 0x20, 0xdf, 0x10, 0x8, 0xf6, 0xa, 0xf7,
-    0x0, 0x0, 0xb, 0xf6, 0x2f, 0xd0, 0x0, 0x3f,
-    0xa0, 0xdf, 0x30, 0x0, 0x0, 0x7f, 0x96, 0xf8,
-    0x0, 0x0, 0xfe, 0x1f, 0xf0, 0x0, 0x0, 0x3,
-    0xfc, 0xaf, 0x30, 0x0, 0xa, 0xf7, 0xfc, 0x0,
-    0x0, 0x0, 0xf, 0xfe, 0xe0, 0x0, 0x0, 0x6f,
-    0xdf, 0x80, 0x0, 0x0, 0x0, 0xcf, 0xfa, 0x0,
-    0x0, 0x1, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0x50, 0x0, 0x0, 0xd, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xf1, 0x0, 0x0, 0x0, 0x8f,
-    0xc0, 0x0, 0x0,
+    0x5f, 0xe0, 0xf, 0x93, 0xfc, 0x1, 0xff, 0xff,
+    0x0, 0xff, 0xfc, 0x8, 0x8, 0x7, 0xc4, 0x2,
+    0x80, 0x6, 0x0, 0xf5, 0x2, 0x3, 0x84, 0xb0,
+    0x4, 0x54, 0x61, 0x1, 0xa, 0x13, 0xfb, 0xda,
+    0xa3, 0x64, 0x0, 0xab, 0x51, 0x21, 0x37, 0xf4,
+    0x0,
 
     /* U+0058 "X" */
-    0xd, 0xfc, 0x0, 0x0, 0x0, 0xa, 0xfe, 0x10,
-    0x3f, 0xf6, 0x0, 0x0, 0x4, 0xff, 0x50, 0x0,
-    0x9f, 0xe1, 0x0, 0x0, 0xef, 0xa0, 0x0, 0x0,
-    0xef, 0xa0, 0x0, 0x8f, 0xf1, 0x0, 0x0, 0x4,
-    0xff, 0x40, 0x3f, 0xf6, 0x0, 0x0, 0x0, 0xa,
-    0xfd, 0xc, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x1e,
-    0xfd, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xfb, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0xc, 0xfd, 0xb, 0xfd,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0x30, 0x2f, 0xf8,
-    0x0, 0x0, 0x1, 0xff, 0x90, 0x0, 0x7f, 0xf2,
-    0x0, 0x0, 0xbf, 0xe0, 0x0, 0x0, 0xdf, 0xc0,
-    0x0, 0x5f, 0xf4, 0x0, 0x0, 0x3, 0xff, 0x70,
-    0x1e, 0xfa, 0x0, 0x0, 0x0, 0x9, 0xff, 0x20,
+    0xd, 0xfc, 0x0, 0xfa, 0xbf, 0x84, 0x38, 0xd,
+    0x80, 0x39, 0x14, 0x2c, 0x40, 0xd8, 0x20, 0x40,
+    0x35, 0x2, 0xa8, 0x2, 0x91, 0x15, 0x80, 0x50,
+    0x21, 0x60, 0x1d, 0x40, 0xa8, 0x6, 0xe1, 0x22,
+    0x1, 0xc8, 0xa1, 0x21, 0xe0, 0x6c, 0x1, 0xf5,
+    0x89, 0x69, 0x87, 0x0, 0x7e, 0x18, 0x2, 0x8,
+    0x20, 0xf, 0xe6, 0x10, 0x3, 0x0, 0x7f, 0x9c,
+    0x40, 0x10, 0x1, 0xfc, 0x50, 0x8, 0xc, 0x60,
+    0x1f, 0xb8, 0xa, 0xd0, 0x38, 0x3, 0xe6, 0x30,
+    0xe0, 0x90, 0x28, 0x0, 0xe1, 0x90, 0x63, 0x2,
+    0x80, 0x72, 0x0, 0xd4, 0x3, 0x20, 0x13, 0x90,
+    0x70, 0x4, 0xa8, 0x14, 0x1, 0xdc, 0x6, 0xe0,
+    0x36, 0xa, 0x80, 0x1c, 0x6c, 0x10, 0x40,
 
     /* U+0059 "Y" */
-    0x8f, 0xf1, 0x0, 0x0, 0x0, 0x9, 0xfe, 0x1,
-    0xef, 0x80, 0x0, 0x0, 0x2, 0xff, 0x60, 0x7,
-    0xff, 0x10, 0x0, 0x0, 0xaf, 0xd0, 0x0, 0xd,
-    0xf9, 0x0, 0x0, 0x3f, 0xf4, 0x0, 0x0, 0x5f,
-    0xf2, 0x0, 0xb, 0xfb, 0x0, 0x0, 0x0, 0xcf,
-    0xa0, 0x3, 0xff, 0x20, 0x0, 0x0, 0x3, 0xff,
-    0x20, 0xbf, 0x90, 0x0, 0x0, 0x0, 0xa, 0xfa,
-    0x4f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xfd,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0x50, 0x0, 0x0, 0x0,
-
-    /* U+005A "Z" */
-    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1b, 0xee,
-    0xee, 0xee, 0xee, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xf7, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x1e, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0x30, 0x0, 0x0, 0x0, 0x1, 0xef,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xdd, 0xdd, 0xdd, 0xdd, 0xd5,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70,
-
-    /* U+005B "[" */
-    0x4f, 0xff, 0xf2, 0x4f, 0xfc, 0xc1, 0x4f, 0xe0,
-    0x0, 0x4f, 0xe0, 0x0, 0x4f, 0xe0, 0x0, 0x4f,
-    0xe0, 0x0, 0x4f, 0xe0, 0x0, 0x4f, 0xe0, 0x0,
-    0x4f, 0xe0, 0x0, 0x4f, 0xe0, 0x0, 0x4f, 0xe0,
-    0x0, 0x4f, 0xe0, 0x0, 0x4f, 0xe0, 0x0, 0x4f,
-    0xe0, 0x0, 0x4f, 0xe0, 0x0, 0x4f, 0xe0, 0x0,
-    0x4f, 0xe0, 0x0, 0x4f, 0xe0, 0x0, 0x4f, 0xe0,
-    0x0, 0x4f, 0xe0, 0x0, 0x4f, 0xe0, 0x0, 0x4f,
-    0xfc, 0xc1, 0x4f, 0xff, 0xf2,
-
-    /* U+005C "\\" */
-    0x5f, 0xb0, 0x0, 0x0, 0x0, 0xe, 0xf2, 0x0,
-    0x0, 0x0, 0x8, 0xf8, 0x0, 0x0, 0x0, 0x2,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x40, 0x0,
-    0x0, 0x0, 0x6f, 0xa0, 0x0, 0x0, 0x0, 0xf,
-    0xf1, 0x0, 0x0, 0x0, 0xa, 0xf7, 0x0, 0x0,
-    0x0, 0x3, 0xfd, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0x30, 0x0, 0x0, 0x0, 0x7f, 0x90, 0x0, 0x0,
-    0x0, 0x1f, 0xf0, 0x0, 0x0, 0x0, 0xb, 0xf5,
-    0x0, 0x0, 0x0, 0x5, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0x20, 0x0, 0x0, 0x0, 0x8f, 0x80,
-    0x0, 0x0, 0x0, 0x2f, 0xe0, 0x0, 0x0, 0x0,
-    0xc, 0xf4, 0x0, 0x0, 0x0, 0x3, 0x84,
-
-    /* U+005D "]" */
-    0xef, 0xff, 0x8b, 0xce, 0xf8, 0x0, 0xaf, 0x80,
-    0xa, 0xf8, 0x0, 0xaf, 0x80, 0xa, 0xf8, 0x0,
-    0xaf, 0x80, 0xa, 0xf8, 0x0, 0xaf, 0x80, 0xa,
-    0xf8, 0x0, 0xaf, 0x80, 0xa, 0xf8, 0x0, 0xaf,
-    0x80, 0xa, 0xf8, 0x0, 0xaf, 0x80, 0xa, 0xf8,
-    0x0, 0xaf, 0x80, 0xa, 0xf8, 0x0, 0xaf, 0x80,
-    0xa, 0xf8, 0x0, 0xaf, 0x8a, 0xce, 0xf8, 0xef,
-    0xff, 0x80,
-
-    /* U+005E "^" */
-    0x0, 0x0, 0x66, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0x20, 0x0, 0x0, 0x9, 0xff, 0x90, 0x0, 0x0,
-    0xf, 0xee, 0xf0, 0x0, 0x0, 0x6f, 0x88, 0xf6,
-    0x0, 0x0, 0xcf, 0x22, 0xfc, 0x0, 0x3, 0xfc,
-    0x0, 0xcf, 0x30, 0xa, 0xf5, 0x0, 0x5f, 0xa0,
-    0x1f, 0xe0, 0x0, 0xe, 0xf1,
-
-    /* U+005F "_" */
-    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xaf, 0xff, 0xff,
-    0xff, 0xff, 0xfc,
-
-    /* U+0060 "`" */
-    0x17, 0x83, 0x0, 0x7, 0xfe, 0x0, 0x0, 0x9f,
-    0x90, 0x0, 0xb, 0xf3,
+    0x8f, 0xf0, 0x80, 0x7d, 0x3f, 0xc1, 0x22, 0x12,
+    0x1, 0xe2, 0x60, 0x80, 0x19, 0x7, 0x10, 0xe,
+    0x80, 0x26, 0x0, 0x39, 0x4, 0x0, 0x63, 0x50,
+    0x90, 0xd, 0x0, 0xc4, 0x1, 0x40, 0x22, 0x0,
+    0x32, 0x98, 0x40, 0x0, 0xd0, 0x24, 0x3, 0xde,
+    0xa, 0x41, 0x0, 0xc4, 0x1, 0xe3, 0x50, 0x84,
+    0x40, 0x40, 0x7, 0xe8, 0x5, 0x90, 0x71, 0x0,
+    0xfc, 0x4c, 0x4, 0x30, 0x1, 0xfe, 0x80, 0x4,
+    0x80, 0x7f, 0xc2, 0x0, 0x20, 0xf, 0xff, 0xf8,
+    0x7, 0x80,
 
     /* U+0061 "a" */
-    0x0, 0x3a, 0xef, 0xeb, 0x40, 0x0, 0x7f, 0xfd,
-    0xce, 0xff, 0x60, 0x2f, 0xf5, 0x0, 0x8, 0xff,
-    0x4, 0xa7, 0x0, 0x0, 0xf, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0x40, 0x4, 0xae, 0xff, 0xff,
-    0xf4, 0xa, 0xff, 0xb9, 0x88, 0xff, 0x45, 0xfe,
-    0x20, 0x0, 0xe, 0xf4, 0xaf, 0x80, 0x0, 0x0,
-    0xef, 0x4b, 0xf8, 0x0, 0x0, 0x2f, 0xf4, 0x7f,
-    0xf4, 0x0, 0x4d, 0xff, 0x50, 0xdf, 0xff, 0xff,
-    0xee, 0xf7, 0x1, 0x9e, 0xfe, 0x91, 0x7c, 0x80,
-
-    /* U+0062 "b" */
-    0x5f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xd2,
-    0xae, 0xfe, 0x80, 0x0, 0x5f, 0xee, 0xfd, 0xef,
-    0xfd, 0x0, 0x5f, 0xfc, 0x20, 0x4, 0xff, 0x80,
-    0x5f, 0xf1, 0x0, 0x0, 0x6f, 0xf0, 0x5f, 0xd0,
-    0x0, 0x0, 0xf, 0xf3, 0x5f, 0xd0, 0x0, 0x0,
-    0xd, 0xf5, 0x5f, 0xd0, 0x0, 0x0, 0xc, 0xf6,
-    0x5f, 0xd0, 0x0, 0x0, 0xd, 0xf5, 0x5f, 0xd0,
-    0x0, 0x0, 0xf, 0xf3, 0x5f, 0xf0, 0x0, 0x0,
-    0x5f, 0xe0, 0x5f, 0xfa, 0x0, 0x1, 0xdf, 0x80,
-    0x5f, 0xdf, 0xea, 0xaf, 0xfc, 0x0, 0x5f, 0xa2,
-    0xae, 0xfe, 0x80, 0x0,
+    0x0, 0x1d, 0x77, 0xf5, 0xa0, 0x4, 0xf8, 0xa6,
+    0x60, 0x4b, 0x60, 0x28, 0xa, 0xdc, 0xe7, 0x9,
+    0x6, 0x58, 0x50, 0xa, 0x0, 0x6, 0x94, 0xe0,
+    0x1c, 0x20, 0xe0, 0x4, 0xae, 0xff, 0x84, 0x2,
+    0xab, 0x55, 0x33, 0xb8, 0x2, 0x55, 0xe, 0xdc,
+    0xc4, 0x4, 0x1, 0xe0, 0xc4, 0x1, 0xf0, 0x80,
+    0x78, 0x84, 0x1, 0x80, 0xe8, 0x0, 0x4f, 0x0,
+    0xb, 0x90, 0x5f, 0xfa, 0xcc, 0x40, 0x83, 0x18,
+    0x40, 0x5b, 0xe4, 0xfc,
 
     /* U+0063 "c" */
-    0x0, 0x29, 0xef, 0xfb, 0x40, 0x0, 0x3f, 0xff,
-    0xce, 0xff, 0x70, 0xe, 0xf9, 0x0, 0x5, 0xff,
-    0x36, 0xfd, 0x0, 0x0, 0x9, 0xf9, 0xbf, 0x70,
-    0x0, 0x0, 0x28, 0x6d, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0x40, 0x0, 0x0, 0x0, 0xd, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0x70, 0x0, 0x0,
-    0x3, 0x26, 0xfd, 0x0, 0x0, 0x7, 0xfa, 0xe,
-    0xf9, 0x0, 0x5, 0xff, 0x30, 0x3f, 0xff, 0xde,
-    0xff, 0x70, 0x0, 0x19, 0xef, 0xfb, 0x30, 0x0,
+    0x0, 0x14, 0xf7, 0xfa, 0xd0, 0x2, 0x3d, 0x61,
+    0x31, 0x4b, 0x70, 0x6, 0x83, 0x7e, 0x75, 0x4,
+    0x1b, 0x9, 0x48, 0x4, 0xac, 0x15, 0xa1, 0x40,
+    0x1d, 0x6f, 0xec, 0x4, 0x1, 0xc5, 0xc, 0x60,
+    0x20, 0x1f, 0x8c, 0x4, 0x3, 0xf3, 0x1, 0x0,
+    0x78, 0xcb, 0x42, 0x80, 0x39, 0xf2, 0x18, 0x4a,
+    0x40, 0x25, 0x80, 0x90, 0xd0, 0x6f, 0xde, 0xa0,
+    0x83, 0x3, 0xe6, 0x12, 0x14, 0xc7, 0x0,
 
     /* U+0064 "d" */
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xd0, 0x0, 0x0,
-    0x0, 0x5, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xd0, 0x0, 0x0, 0x0, 0x5, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xd0, 0x3, 0xbf, 0xfd, 0x65,
-    0xfd, 0x4, 0xff, 0xfd, 0xef, 0xef, 0xd1, 0xef,
-    0xb1, 0x0, 0x5f, 0xfd, 0x6f, 0xe0, 0x0, 0x0,
-    0x8f, 0xdb, 0xf9, 0x0, 0x0, 0x5, 0xfd, 0xdf,
-    0x50, 0x0, 0x0, 0x5f, 0xde, 0xf4, 0x0, 0x0,
-    0x5, 0xfd, 0xdf, 0x50, 0x0, 0x0, 0x5f, 0xdb,
-    0xf8, 0x0, 0x0, 0x5, 0xfd, 0x6f, 0xd0, 0x0,
-    0x0, 0x7f, 0xd0, 0xef, 0x70, 0x0, 0x2e, 0xfd,
-    0x4, 0xff, 0xda, 0xbf, 0xdf, 0xd0, 0x2, 0xbf,
-    0xfd, 0x73, 0xfd,
+    0x0, 0xfc, 0xbf, 0xa0, 0x1f, 0xfe, 0x23, 0xbf,
+    0xf6, 0xb0, 0x6, 0x4c, 0x40, 0x23, 0x9b, 0x0,
+    0xd, 0x2, 0x76, 0xf5, 0x8, 0x1, 0xc4, 0x56,
+    0x20, 0x5, 0x70, 0x6, 0x83, 0x80, 0x76, 0x80,
+    0x18, 0x30, 0x3, 0xf1, 0x80, 0x80, 0x7e, 0x30,
+    0x10, 0xf, 0xcc, 0x1a, 0x1, 0xfb, 0x41, 0x40,
+    0x38, 0x80, 0xc, 0x24, 0xe0, 0x11, 0x48, 0x5,
+    0x41, 0x1b, 0x57, 0xa6, 0x1, 0x26, 0xa1, 0x2b,
+    0x47, 0x0, 0x0,
 
     /* U+0065 "e" */
-    0x0, 0x18, 0xdf, 0xfb, 0x40, 0x0, 0x2e, 0xff,
-    0xce, 0xff, 0x60, 0xd, 0xfa, 0x0, 0x6, 0xff,
-    0x15, 0xfe, 0x0, 0x0, 0xa, 0xf7, 0xaf, 0x80,
-    0x0, 0x0, 0x6f, 0xbd, 0xfd, 0xcc, 0xcc, 0xcd,
-    0xfd, 0xef, 0xff, 0xff, 0xff, 0xff, 0xde, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0x80, 0x0, 0x0,
-    0x0, 0x7, 0xfe, 0x10, 0x0, 0x0, 0x40, 0xe,
-    0xfc, 0x20, 0x1, 0xaf, 0x60, 0x2e, 0xff, 0xdd,
-    0xff, 0xc1, 0x0, 0x18, 0xdf, 0xfd, 0x70, 0x0,
-
-    /* U+0066 "f" */
-    0x0, 0x0, 0x6d, 0xff, 0x40, 0x0, 0x8f, 0xfe,
-    0xe4, 0x0, 0xf, 0xf8, 0x0, 0x0, 0x3, 0xff,
-    0x0, 0x0, 0x0, 0x4f, 0xe0, 0x0, 0x4, 0xff,
-    0xff, 0xff, 0x90, 0x3a, 0xcf, 0xfa, 0xa6, 0x0,
-    0x4, 0xfe, 0x0, 0x0, 0x0, 0x4f, 0xe0, 0x0,
-    0x0, 0x4, 0xfe, 0x0, 0x0, 0x0, 0x4f, 0xe0,
-    0x0, 0x0, 0x4, 0xfe, 0x0, 0x0, 0x0, 0x4f,
-    0xe0, 0x0, 0x0, 0x4, 0xfe, 0x0, 0x0, 0x0,
-    0x4f, 0xe0, 0x0, 0x0, 0x4, 0xfe, 0x0, 0x0,
-    0x0, 0x4f, 0xe0, 0x0, 0x0, 0x4, 0xfe, 0x0,
-    0x0,
-
-    /* U+0067 "g" */
-    0x0, 0x3b, 0xff, 0xd7, 0x2f, 0xd0, 0x5f, 0xfd,
-    0x9b, 0xfd, 0xfd, 0x1e, 0xf8, 0x0, 0x2, 0xef,
-    0xd6, 0xfd, 0x0, 0x0, 0x6, 0xfd, 0xaf, 0x80,
-    0x0, 0x0, 0x5f, 0xdd, 0xf5, 0x0, 0x0, 0x5,
-    0xfd, 0xdf, 0x50, 0x0, 0x0, 0x5f, 0xdd, 0xf6,
-    0x0, 0x0, 0x5, 0xfd, 0xaf, 0x90, 0x0, 0x0,
-    0x5f, 0xd6, 0xfe, 0x0, 0x0, 0x8, 0xfd, 0xe,
-    0xfb, 0x10, 0x6, 0xff, 0xd0, 0x4f, 0xff, 0xdf,
-    0xfd, 0xfd, 0x0, 0x3b, 0xff, 0xd6, 0x5f, 0xd0,
-    0x0, 0x0, 0x0, 0x6, 0xfc, 0x3, 0x10, 0x0,
-    0x0, 0xbf, 0x91, 0xed, 0x40, 0x0, 0x7f, 0xf2,
-    0x8, 0xff, 0xed, 0xff, 0xf6, 0x0, 0x4, 0xae,
-    0xfe, 0xa3, 0x0,
-
-    /* U+0068 "h" */
-    0x5f, 0xd0, 0x0, 0x0, 0x0, 0x5, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xd0, 0x0, 0x0, 0x0,
-    0x5, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xd0,
-    0x0, 0x0, 0x0, 0x5, 0xfd, 0x8, 0xef, 0xea,
-    0x10, 0x5f, 0xed, 0xfd, 0xef, 0xfd, 0x5, 0xff,
-    0xd2, 0x0, 0x4f, 0xf5, 0x5f, 0xf2, 0x0, 0x0,
-    0xaf, 0x85, 0xfd, 0x0, 0x0, 0x8, 0xf9, 0x5f,
-    0xd0, 0x0, 0x0, 0x8f, 0xa5, 0xfd, 0x0, 0x0,
-    0x8, 0xfa, 0x5f, 0xd0, 0x0, 0x0, 0x8f, 0xa5,
-    0xfd, 0x0, 0x0, 0x8, 0xfa, 0x5f, 0xd0, 0x0,
-    0x0, 0x8f, 0xa5, 0xfd, 0x0, 0x0, 0x8, 0xfa,
-    0x5f, 0xd0, 0x0, 0x0, 0x8f, 0xa5, 0xfd, 0x0,
-    0x0, 0x8, 0xfa,
+    0x0, 0xc, 0x6f, 0xfa, 0xd0, 0x2, 0x2f, 0x72,
+    0x31, 0x4b, 0x60, 0x7, 0x8a, 0xfe, 0x74, 0x84,
+    0x8a, 0x90, 0xd0, 0x4, 0xca, 0xd, 0xe0, 0xc0,
+    0x1d, 0x81, 0x8e, 0xb, 0x99, 0xd6, 0xc, 0x60,
+    0x46, 0x7c, 0x40, 0x1a, 0xff, 0xfe, 0xd5, 0xc,
+    0x0, 0xfd, 0x80, 0xc2, 0x1, 0xc8, 0xe, 0x22,
+    0xd2, 0x0, 0xd, 0x5b, 0x6, 0x9, 0xee, 0xdc,
+    0xa6, 0xe0, 0x5e, 0xe4, 0x5a, 0x30, 0x40,
 
     /* U+0069 "i" */
-    0x1e, 0xd1, 0x4f, 0xf2, 0x6, 0x50, 0x0, 0x0,
-    0x2f, 0xf0, 0x2f, 0xf0, 0x2f, 0xf0, 0x2f, 0xf0,
-    0x2f, 0xf0, 0x2f, 0xf0, 0x2f, 0xf0, 0x2f, 0xf0,
-    0x2f, 0xf0, 0x2f, 0xf0, 0x2f, 0xf0, 0x2f, 0xf0,
-    0x2f, 0xf0,
-
-    /* U+006A "j" */
-    0x0, 0x3f, 0xb0, 0x0, 0x7f, 0xf0, 0x0, 0x7,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xe0, 0x0,
-    0x4f, 0xe0, 0x0, 0x4f, 0xe0, 0x0, 0x4f, 0xe0,
-    0x0, 0x4f, 0xe0, 0x0, 0x4f, 0xe0, 0x0, 0x4f,
-    0xe0, 0x0, 0x4f, 0xe0, 0x0, 0x4f, 0xe0, 0x0,
-    0x4f, 0xe0, 0x0, 0x4f, 0xe0, 0x0, 0x4f, 0xe0,
-    0x0, 0x4f, 0xe0, 0x0, 0x4f, 0xe0, 0x0, 0x4f,
-    0xe0, 0x0, 0x8f, 0xc0, 0xbe, 0xff, 0x60, 0xbf,
-    0xe8, 0x0,
+    0x1e, 0xd1, 0x51, 0x23, 0x49, 0xa2, 0x6, 0x50,
+    0x2f, 0xf0, 0x7, 0xff, 0x94,
 
     /* U+006B "k" */
-    0x5f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xd0,
-    0x0, 0x8, 0xff, 0x20, 0x5f, 0xd0, 0x0, 0x7f,
-    0xf3, 0x0, 0x5f, 0xd0, 0x6, 0xff, 0x50, 0x0,
-    0x5f, 0xd0, 0x4f, 0xf6, 0x0, 0x0, 0x5f, 0xd3,
-    0xff, 0x70, 0x0, 0x0, 0x5f, 0xee, 0xfd, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0xff, 0x60, 0x0, 0x0,
-    0x5f, 0xfb, 0x6f, 0xf2, 0x0, 0x0, 0x5f, 0xe0,
-    0xa, 0xfd, 0x0, 0x0, 0x5f, 0xd0, 0x1, 0xef,
-    0x90, 0x0, 0x5f, 0xd0, 0x0, 0x3f, 0xf5, 0x0,
-    0x5f, 0xd0, 0x0, 0x8, 0xff, 0x20, 0x5f, 0xd0,
-    0x0, 0x0, 0xcf, 0xc0,
+    0x5f, 0xd0, 0xf, 0xff, 0xa4, 0x7f, 0x88, 0x3,
+    0xe7, 0x70, 0x61, 0x0, 0x79, 0xa0, 0x28, 0xc0,
+    0x3c, 0x92, 0x12, 0xa0, 0x1e, 0x3b, 0x8, 0x60,
+    0xf, 0x1e, 0x81, 0x38, 0x7, 0xc2, 0x20, 0x26,
+    0x0, 0xfc, 0x92, 0x12, 0x40, 0x1e, 0x1b, 0x65,
+    0xf, 0x0, 0xf1, 0x80, 0x2c, 0x4a, 0x40, 0x3f,
+    0xe, 0x83, 0x28, 0x7, 0xe3, 0x70, 0xa2, 0x0,
+    0xfd, 0x6, 0x1c, 0x0,
 
     /* U+006C "l" */
-    0x2f, 0xf0, 0x2f, 0xf0, 0x2f, 0xf0, 0x2f, 0xf0,
-    0x2f, 0xf0, 0x2f, 0xf0, 0x2f, 0xf0, 0x2f, 0xf0,
-    0x2f, 0xf0, 0x2f, 0xf0, 0x2f, 0xf0, 0x2f, 0xf0,
-    0x2f, 0xf0, 0x2f, 0xf0, 0x2f, 0xf0, 0x2f, 0xf0,
-    0x2f, 0xf0, 0x2f, 0xf0,
+    0x2f, 0xf0, 0x7, 0xff, 0xe4,
 
     /* U+006D "m" */
-    0x6f, 0xb2, 0xae, 0xfe, 0x91, 0x4, 0xcf, 0xfd,
-    0x70, 0x6, 0xfe, 0xfc, 0x9b, 0xff, 0xc7, 0xfc,
-    0x9b, 0xff, 0xa0, 0x6f, 0xf7, 0x0, 0x2, 0xff,
-    0xf6, 0x0, 0x4, 0xff, 0x16, 0xfe, 0x0, 0x0,
-    0xa, 0xfd, 0x0, 0x0, 0xd, 0xf5, 0x6f, 0xd0,
-    0x0, 0x0, 0x9f, 0xa0, 0x0, 0x0, 0xcf, 0x66,
-    0xfd, 0x0, 0x0, 0x9, 0xf9, 0x0, 0x0, 0xc,
-    0xf6, 0x6f, 0xd0, 0x0, 0x0, 0x9f, 0x90, 0x0,
-    0x0, 0xcf, 0x66, 0xfd, 0x0, 0x0, 0x9, 0xf9,
-    0x0, 0x0, 0xc, 0xf6, 0x6f, 0xd0, 0x0, 0x0,
-    0x9f, 0x90, 0x0, 0x0, 0xcf, 0x66, 0xfd, 0x0,
-    0x0, 0x9, 0xf9, 0x0, 0x0, 0xc, 0xf6, 0x6f,
-    0xd0, 0x0, 0x0, 0x9f, 0x90, 0x0, 0x0, 0xcf,
-    0x66, 0xfd, 0x0, 0x0, 0x9, 0xf9, 0x0, 0x0,
-    0xc, 0xf6, 0x6f, 0xd0, 0x0, 0x0, 0x9f, 0x90,
-    0x0, 0x0, 0xcf, 0x60,
+    0x6f, 0xb2, 0xae, 0xfe, 0x91, 0x4, 0xcf, 0xf6,
+    0xb8, 0x6, 0x5d, 0x67, 0x41, 0x6d, 0x7b, 0x6,
+    0x42, 0x8a, 0x0, 0x86, 0x32, 0x6f, 0x40, 0xe2,
+    0x72, 0x6e, 0xc0, 0xa2, 0x0, 0x17, 0x0, 0x89,
+    0x40, 0x98, 0x2, 0x42, 0x4, 0x0, 0x18, 0x7,
+    0x18, 0x38, 0x7, 0x8, 0x18, 0x7, 0xf8, 0xc0,
+    0x3f, 0xff, 0xe0, 0x1f, 0xff, 0x60,
 
     /* U+006E "n" */
-    0x5f, 0xb1, 0x8e, 0xfe, 0xa1, 0x5, 0xfd, 0xde,
-    0xaa, 0xff, 0xd0, 0x5f, 0xfa, 0x0, 0x1, 0xff,
-    0x55, 0xff, 0x0, 0x0, 0xa, 0xf8, 0x5f, 0xd0,
-    0x0, 0x0, 0x8f, 0x95, 0xfd, 0x0, 0x0, 0x8,
-    0xfa, 0x5f, 0xd0, 0x0, 0x0, 0x8f, 0xa5, 0xfd,
-    0x0, 0x0, 0x8, 0xfa, 0x5f, 0xd0, 0x0, 0x0,
-    0x8f, 0xa5, 0xfd, 0x0, 0x0, 0x8, 0xfa, 0x5f,
-    0xd0, 0x0, 0x0, 0x8f, 0xa5, 0xfd, 0x0, 0x0,
-    0x8, 0xfa, 0x5f, 0xd0, 0x0, 0x0, 0x8f, 0xa0,
+    0x5f, 0xb1, 0x8e, 0xfe, 0xa1, 0x0, 0x9b, 0x19,
+    0x14, 0x57, 0x0, 0x22, 0x7e, 0xaa, 0x70, 0x12,
+    0x80, 0x54, 0x1, 0xa, 0x86, 0x80, 0x8, 0x3,
+    0x88, 0x4, 0x3, 0xfc, 0x60, 0x1f, 0xff, 0xf0,
+    0x0,
 
     /* U+006F "o" */
-    0x0, 0x18, 0xdf, 0xfc, 0x60, 0x0, 0x2, 0xef,
-    0xfc, 0xdf, 0xfb, 0x0, 0xd, 0xfb, 0x10, 0x3,
-    0xef, 0x90, 0x6f, 0xe0, 0x0, 0x0, 0x4f, 0xf1,
-    0xbf, 0x80, 0x0, 0x0, 0xd, 0xf6, 0xdf, 0x50,
-    0x0, 0x0, 0xa, 0xf9, 0xef, 0x40, 0x0, 0x0,
-    0x9, 0xf9, 0xdf, 0x50, 0x0, 0x0, 0xa, 0xf9,
-    0xbf, 0x80, 0x0, 0x0, 0xd, 0xf6, 0x6f, 0xe0,
-    0x0, 0x0, 0x4f, 0xf1, 0xd, 0xfb, 0x10, 0x3,
-    0xef, 0x90, 0x2, 0xef, 0xfd, 0xdf, 0xfb, 0x0,
-    0x0, 0x18, 0xdf, 0xfc, 0x60, 0x0,
+    0x0, 0xc, 0x6f, 0xfb, 0x18, 0x3, 0x17, 0xb9,
+    0x19, 0x1c, 0xd8, 0x5, 0xe2, 0x9d, 0x9b, 0x82,
+    0x92, 0xc, 0x43, 0x62, 0x0, 0x3a, 0x6, 0x1d,
+    0x6, 0x0, 0xe4, 0x20, 0x76, 0xd, 0x0, 0xf3,
+    0x87, 0x98, 0x8, 0x7, 0x8c, 0x0, 0x60, 0x20,
+    0x1e, 0x30, 0x3, 0x6, 0x80, 0x79, 0xc3, 0xf4,
+    0x18, 0x3, 0x90, 0x81, 0xd8, 0x86, 0xc4, 0x0,
+    0x74, 0xc, 0x21, 0xe2, 0x9d, 0xba, 0xc1, 0x49,
+    0x0, 0x17, 0xb9, 0x14, 0x73, 0x60, 0x0,
 
     /* U+0070 "p" */
-    0x5f, 0xa2, 0xae, 0xfe, 0x80, 0x0, 0x5f, 0xef,
-    0xd9, 0xaf, 0xfc, 0x0, 0x5f, 0xf8, 0x0, 0x2,
-    0xef, 0x80, 0x5f, 0xe0, 0x0, 0x0, 0x5f, 0xe0,
-    0x5f, 0xd0, 0x0, 0x0, 0xf, 0xf3, 0x5f, 0xd0,
-    0x0, 0x0, 0xd, 0xf5, 0x5f, 0xd0, 0x0, 0x0,
-    0xd, 0xf5, 0x5f, 0xd0, 0x0, 0x0, 0xe, 0xf5,
-    0x5f, 0xd0, 0x0, 0x0, 0x1f, 0xf2, 0x5f, 0xe0,
-    0x0, 0x0, 0x7f, 0xe0, 0x5f, 0xfa, 0x10, 0x5,
-    0xff, 0x70, 0x5f, 0xef, 0xfd, 0xef, 0xfc, 0x0,
-    0x5f, 0xd2, 0xae, 0xfe, 0x80, 0x0, 0x5f, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xd0,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+0071 "q" */
-    0x0, 0x3b, 0xff, 0xd7, 0x3f, 0xd0, 0x5f, 0xfc,
-    0x9a, 0xfe, 0xfd, 0x1f, 0xf8, 0x0, 0x1, 0xdf,
-    0xd7, 0xfd, 0x0, 0x0, 0x6, 0xfd, 0xbf, 0x80,
-    0x0, 0x0, 0x5f, 0xdd, 0xf5, 0x0, 0x0, 0x5,
-    0xfd, 0xef, 0x40, 0x0, 0x0, 0x5f, 0xdd, 0xf5,
-    0x0, 0x0, 0x5, 0xfd, 0xbf, 0x80, 0x0, 0x0,
-    0x5f, 0xd6, 0xfe, 0x0, 0x0, 0x7, 0xfd, 0xe,
-    0xfb, 0x10, 0x4, 0xff, 0xd0, 0x4f, 0xff, 0xde,
-    0xfe, 0xfd, 0x0, 0x3b, 0xff, 0xd7, 0x6f, 0xd0,
-    0x0, 0x0, 0x0, 0x5, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xd0, 0x0, 0x0, 0x0, 0x5, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xd0, 0x0, 0x0,
-    0x0, 0x5, 0xfd,
+    0x5f, 0xa2, 0xae, 0xfe, 0x80, 0xe, 0x4d, 0x77,
+    0x28, 0xbe, 0x0, 0x61, 0x7d, 0x9a, 0xd1, 0x38,
+    0x0, 0x86, 0x0, 0x22, 0xb0, 0x60, 0x8, 0xc0,
+    0x39, 0x40, 0x4c, 0x3, 0xf8, 0x81, 0x80, 0x3f,
+    0xf9, 0x26, 0x1, 0xfe, 0x11, 0x3, 0x80, 0xc,
+    0x3, 0x98, 0x4, 0x80, 0x3, 0x42, 0x0, 0x58,
+    0x9, 0x0, 0x85, 0x7b, 0x7a, 0x80, 0xdc, 0x2,
+    0x3d, 0x53, 0x11, 0x3e, 0x0, 0x71, 0x57, 0x7f,
+    0x40, 0x7, 0xff, 0x9c,
 
     /* U+0072 "r" */
-    0x5f, 0xc3, 0xcf, 0xb5, 0xfe, 0xff, 0xeb, 0x5f,
-    0xfb, 0x10, 0x5, 0xff, 0x0, 0x0, 0x5f, 0xd0,
-    0x0, 0x5, 0xfd, 0x0, 0x0, 0x5f, 0xd0, 0x0,
-    0x5, 0xfd, 0x0, 0x0, 0x5f, 0xd0, 0x0, 0x5,
-    0xfd, 0x0, 0x0, 0x5f, 0xd0, 0x0, 0x5, 0xfd,
-    0x0, 0x0, 0x5f, 0xd0, 0x0, 0x0,
+    0x5f, 0xc3, 0xcf, 0xb0, 0x1, 0x61, 0x88, 0x4,
+    0x29, 0xdc, 0xb0, 0xa, 0xc4, 0x3, 0x10, 0x7,
+    0xff, 0xc0,
 
     /* U+0073 "s" */
-    0x0, 0x5c, 0xff, 0xe9, 0x10, 0x0, 0x9f, 0xfd,
-    0xcf, 0xff, 0x20, 0x3f, 0xf4, 0x0, 0x1b, 0xfc,
-    0x6, 0xfc, 0x0, 0x0, 0x2f, 0xe0, 0x5f, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xfb, 0x73, 0x0,
-    0x0, 0x0, 0x6d, 0xff, 0xfe, 0x70, 0x0, 0x0,
-    0x1, 0x5a, 0xff, 0x90, 0x12, 0x0, 0x0, 0x4,
-    0xff, 0x1d, 0xf6, 0x0, 0x0, 0xf, 0xf2, 0x7f,
-    0xe3, 0x0, 0x7, 0xff, 0x0, 0xbf, 0xfe, 0xde,
-    0xff, 0x50, 0x0, 0x6c, 0xff, 0xea, 0x30, 0x0,
+    0x0, 0x2e, 0x7f, 0xba, 0x44, 0x2, 0x9a, 0x32,
+    0x31, 0x6e, 0x20, 0x36, 0xb, 0xdc, 0xe4, 0xe,
+    0x5, 0x3, 0x40, 0x0, 0xc8, 0x10, 0x18, 0x19,
+    0x0, 0x45, 0xfc, 0xa, 0x81, 0xb6, 0xe6, 0x1,
+    0xd7, 0x24, 0x91, 0x9c, 0xe0, 0x19, 0xb7, 0xa9,
+    0x46, 0x24, 0x4, 0x80, 0x2, 0xb5, 0x60, 0xc3,
+    0x9a, 0xc0, 0x19, 0x0, 0x7, 0x41, 0x6, 0x1,
+    0x38, 0x0, 0x9d, 0x7, 0x3b, 0x7a, 0x2, 0x80,
+    0x17, 0x26, 0x24, 0xb, 0x8a, 0x0,
 
     /* U+0074 "t" */
-    0x0, 0x9f, 0x90, 0x0, 0x0, 0x9f, 0x90, 0x0,
-    0x0, 0x9f, 0x90, 0x0, 0xef, 0xff, 0xff, 0xf0,
-    0x9a, 0xef, 0xea, 0xa0, 0x0, 0x9f, 0x90, 0x0,
-    0x0, 0x9f, 0x90, 0x0, 0x0, 0x9f, 0x90, 0x0,
-    0x0, 0x9f, 0x90, 0x0, 0x0, 0x9f, 0x90, 0x0,
-    0x0, 0x9f, 0x90, 0x0, 0x0, 0x9f, 0x90, 0x0,
-    0x0, 0x9f, 0x90, 0x0, 0x0, 0x8f, 0xc0, 0x0,
-    0x0, 0x3f, 0xff, 0xe0, 0x0, 0x6, 0xef, 0xe0,
-
-    /* U+0075 "u" */
-    0x6f, 0xc0, 0x0, 0x0, 0x9f, 0x96, 0xfc, 0x0,
-    0x0, 0x9, 0xf9, 0x6f, 0xc0, 0x0, 0x0, 0x9f,
-    0x96, 0xfc, 0x0, 0x0, 0x9, 0xf9, 0x6f, 0xc0,
-    0x0, 0x0, 0x9f, 0x96, 0xfc, 0x0, 0x0, 0x9,
-    0xf9, 0x6f, 0xc0, 0x0, 0x0, 0x9f, 0x96, 0xfc,
-    0x0, 0x0, 0x9, 0xf9, 0x6f, 0xc0, 0x0, 0x0,
-    0x9f, 0x94, 0xfe, 0x0, 0x0, 0xa, 0xf9, 0x1f,
-    0xf4, 0x0, 0x5, 0xff, 0x90, 0x8f, 0xfb, 0xac,
-    0xfe, 0xf9, 0x0, 0x7d, 0xff, 0xc5, 0x8f, 0x90,
-
-    /* U+0076 "v" */
-    0x6f, 0xc0, 0x0, 0x0, 0x2f, 0xf0, 0x1f, 0xf1,
-    0x0, 0x0, 0x7f, 0xa0, 0xb, 0xf6, 0x0, 0x0,
-    0xcf, 0x50, 0x5, 0xfb, 0x0, 0x1, 0xff, 0x0,
-    0x0, 0xff, 0x10, 0x6, 0xf9, 0x0, 0x0, 0xaf,
-    0x60, 0xc, 0xf4, 0x0, 0x0, 0x5f, 0xb0, 0x1f,
-    0xe0, 0x0, 0x0, 0xe, 0xf0, 0x6f, 0x90, 0x0,
-    0x0, 0x9, 0xf5, 0xbf, 0x30, 0x0, 0x0, 0x4,
-    0xfb, 0xfd, 0x0, 0x0, 0x0, 0x0, 0xef, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xd0, 0x0, 0x0,
+    0x0, 0x4f, 0xc8, 0x7, 0xff, 0x1f, 0xbd, 0x81,
+    0xbf, 0xc0, 0xea, 0x20, 0x2a, 0xa0, 0x9a, 0x70,
+    0x7a, 0xa0, 0x7, 0xff, 0xbc, 0x41, 0x40, 0x3a,
+    0xc0, 0xff, 0x80, 0x23, 0x91, 0x0, 0x80,
 
     /* U+0077 "w" */
-    0x5f, 0xc0, 0x0, 0x0, 0xff, 0x0, 0x0, 0xd,
-    0xf5, 0x1f, 0xf1, 0x0, 0x5, 0xff, 0x50, 0x0,
-    0x1f, 0xf1, 0xc, 0xf5, 0x0, 0xa, 0xff, 0xa0,
-    0x0, 0x4f, 0xc0, 0x8, 0xf9, 0x0, 0xe, 0xde,
-    0xe0, 0x0, 0x8f, 0x70, 0x3, 0xfd, 0x0, 0x4f,
-    0x8a, 0xf3, 0x0, 0xcf, 0x30, 0x0, 0xef, 0x10,
-    0x8f, 0x35, 0xf8, 0x0, 0xfe, 0x0, 0x0, 0xaf,
-    0x50, 0xde, 0x0, 0xfd, 0x4, 0xfa, 0x0, 0x0,
-    0x6f, 0x92, 0xfa, 0x0, 0xbf, 0x28, 0xf5, 0x0,
-    0x0, 0x1f, 0xd7, 0xf5, 0x0, 0x6f, 0x7c, 0xf1,
-    0x0, 0x0, 0xc, 0xfd, 0xf0, 0x0, 0x1f, 0xcf,
-    0xc0, 0x0, 0x0, 0x8, 0xff, 0xb0, 0x0, 0xc,
-    0xff, 0x80, 0x0, 0x0, 0x3, 0xff, 0x60, 0x0,
-    0x7, 0xff, 0x30, 0x0, 0x0, 0x0, 0xff, 0x10,
-    0x0, 0x2, 0xfe, 0x0, 0x0,
-
-    /* U+0078 "x" */
-    0x1f, 0xf6, 0x0, 0x0, 0x9f, 0xe0, 0x6, 0xfe,
-    0x10, 0x3, 0xff, 0x40, 0x0, 0xcf, 0x90, 0xc,
-    0xfa, 0x0, 0x0, 0x2f, 0xf2, 0x6f, 0xe1, 0x0,
-    0x0, 0x7, 0xfc, 0xef, 0x50, 0x0, 0x0, 0x0,
-    0xdf, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xfc, 0x0, 0x0,
-    0x0, 0x9, 0xfb, 0xdf, 0x70, 0x0, 0x0, 0x3f,
-    0xf2, 0x3f, 0xf2, 0x0, 0x0, 0xdf, 0x80, 0xa,
-    0xfc, 0x0, 0x8, 0xfe, 0x0, 0x1, 0xff, 0x60,
-    0x3f, 0xf5, 0x0, 0x0, 0x6f, 0xf1,
-
-    /* U+0079 "y" */
-    0x8f, 0xc0, 0x0, 0x0, 0x6f, 0xe0, 0x3f, 0xf2,
-    0x0, 0x0, 0xbf, 0x80, 0xd, 0xf7, 0x0, 0x0,
-    0xff, 0x30, 0x7, 0xfc, 0x0, 0x5, 0xfd, 0x0,
-    0x2, 0xff, 0x10, 0xa, 0xf8, 0x0, 0x0, 0xcf,
-    0x70, 0xe, 0xf2, 0x0, 0x0, 0x6f, 0xc0, 0x3f,
-    0xd0, 0x0, 0x0, 0x1f, 0xf1, 0x8f, 0x70, 0x0,
-    0x0, 0xb, 0xf7, 0xdf, 0x20, 0x0, 0x0, 0x5,
-    0xfe, 0xfc, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0x60, 0x0, 0x0, 0x0, 0x0, 0xef, 0x10,
-    0x0, 0x0, 0x0, 0x9, 0xfa, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xf2, 0x0, 0x0, 0x0, 0xe, 0xfc,
-    0x20, 0x0, 0x0, 0x0,
-
-    /* U+007A "z" */
-    0xdf, 0xff, 0xff, 0xff, 0xfc, 0xa, 0xcc, 0xcc,
-    0xcc, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x7f, 0xe1,
-    0x0, 0x0, 0x0, 0x3f, 0xf5, 0x0, 0x0, 0x0,
-    0xd, 0xf9, 0x0, 0x0, 0x0, 0xa, 0xfd, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0x20, 0x0, 0x0, 0x2,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0xcf, 0xa0, 0x0,
-    0x0, 0x0, 0x9f, 0xd0, 0x0, 0x0, 0x0, 0x4f,
-    0xf3, 0x0, 0x0, 0x0, 0xe, 0xff, 0xcc, 0xcc,
-    0xcc, 0xc1, 0xff, 0xff, 0xff, 0xff, 0xff, 0x10,
-
-    /* U+007B "{" */
-    0x0, 0x0, 0x2, 0xa8, 0x0, 0x0, 0x4f, 0xf7,
-    0x0, 0x1, 0xff, 0x30, 0x0, 0x7, 0xfb, 0x0,
-    0x0, 0xb, 0xf8, 0x0, 0x0, 0xc, 0xf6, 0x0,
-    0x0, 0xc, 0xf6, 0x0, 0x0, 0xc, 0xf6, 0x0,
-    0x0, 0xd, 0xf6, 0x0, 0x0, 0x1f, 0xf2, 0x0,
-    0x15, 0xdf, 0xa0, 0x0, 0x4f, 0xfd, 0x0, 0x0,
-    0x2c, 0xff, 0x80, 0x0, 0x0, 0x5f, 0xf1, 0x0,
-    0x0, 0xe, 0xf5, 0x0, 0x0, 0xc, 0xf6, 0x0,
-    0x0, 0xc, 0xf6, 0x0, 0x0, 0xc, 0xf6, 0x0,
-    0x0, 0xb, 0xf7, 0x0, 0x0, 0x9, 0xfa, 0x0,
-    0x0, 0x4, 0xff, 0x10, 0x0, 0x0, 0xaf, 0xc2,
-    0x0, 0x0, 0x8, 0xfb, 0x0, 0x0, 0x0, 0x12,
-
-    /* U+007C "|" */
-    0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
-    0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
-    0xfd, 0xfd, 0xfd, 0xfd, 0x76,
-
-    /* U+007D "}" */
-    0x0, 0x0, 0x0, 0x0, 0x8c, 0x40, 0x0, 0x0,
-    0x5e, 0xf7, 0x0, 0x0, 0x1, 0xff, 0x30, 0x0,
-    0x0, 0x9f, 0x90, 0x0, 0x0, 0x6f, 0xc0, 0x0,
-    0x0, 0x5f, 0xd0, 0x0, 0x0, 0x5f, 0xd0, 0x0,
-    0x0, 0x5f, 0xd0, 0x0, 0x0, 0x4f, 0xe0, 0x0,
-    0x0, 0xf, 0xf3, 0x0, 0x0, 0x7, 0xfe, 0x72,
-    0x0, 0x0, 0x9f, 0xf6, 0x0, 0x7, 0xfe, 0x71,
-    0x0, 0xf, 0xf3, 0x0, 0x0, 0x4f, 0xe0, 0x0,
-    0x0, 0x5f, 0xd0, 0x0, 0x0, 0x5f, 0xd0, 0x0,
-    0x0, 0x5f, 0xd0, 0x0, 0x0, 0x6f, 0xc0, 0x0,
-    0x0, 0x9f, 0x90, 0x0, 0x2, 0xff, 0x30, 0x0,
-    0x5e, 0xf7, 0x0, 0x0, 0x7c, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+007E "~" */
-    0x0, 0x6d, 0xeb, 0x30, 0x0, 0x0, 0x97, 0x7,
-    0xff, 0xff, 0xf7, 0x0, 0x2, 0xfb, 0x1f, 0xf3,
-    0x6, 0xff, 0x80, 0xb, 0xf6, 0x5f, 0x90, 0x0,
-    0x4f, 0xff, 0xff, 0xc0, 0x49, 0x40, 0x0, 0x2,
-    0xaf, 0xfa, 0x10,
-
-    /* U+00B0 "°" */
-    0x3, 0xcf, 0xd3, 0x1, 0xed, 0x8d, 0xf1, 0x6f,
-    0x10, 0x1f, 0x66, 0xf1, 0x1, 0xf6, 0x1f, 0xd8,
-    0xdf, 0x10, 0x3c, 0xfd, 0x30
+    0x5f, 0xc0, 0xe, 0xff, 0x0, 0x76, 0xfa, 0xa0,
+    0x18, 0x80, 0x4a, 0x0, 0x50, 0x8, 0x48, 0x10,
+    0x4c, 0x10, 0x2, 0xf0, 0x7, 0x80, 0x4a, 0x6,
+    0x20, 0x81, 0x80, 0x12, 0x10, 0xa0, 0x5, 0x81,
+    0x60, 0xb, 0x4, 0x0, 0x20, 0xaa, 0x9, 0x80,
+    0x10, 0x10, 0x0, 0x62, 0x42, 0x18, 0x17, 0xe1,
+    0x60, 0x3, 0x13, 0x0, 0x90, 0x10, 0x14, 0x4d,
+    0x41, 0x41, 0x1, 0x0, 0x36, 0x6, 0x11, 0x10,
+    0x0, 0x84, 0x4c, 0xf, 0x0, 0xce, 0x8, 0xa1,
+    0xe0, 0xd, 0x5, 0x40, 0x40, 0xc, 0x26, 0x54,
+    0xa, 0x0, 0x70, 0xb3, 0x30, 0x80, 0x72, 0x1,
+    0x20, 0x4, 0x26, 0x60, 0x40, 0xf, 0x58, 0x3,
+    0x40, 0x35, 0x80, 0x2c, 0x3, 0xc6, 0x0, 0x70,
+    0xc, 0xa0, 0x26, 0x1
 };
 
 
@@ -1294,119 +470,102 @@ static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
 static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
     {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
     {.bitmap_index = 0, .adv_w = 95, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 0, .adv_w = 99, .box_w = 4, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 34, .adv_w = 123, .box_w = 6, .box_h = 6, .ofs_x = 1, .ofs_y = 12},
-    {.bitmap_index = 52, .adv_w = 236, .box_w = 14, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 171, .adv_w = 216, .box_w = 12, .box_h = 22, .ofs_x = 1, .ofs_y = -2},
-    {.bitmap_index = 303, .adv_w = 281, .box_w = 16, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 439, .adv_w = 239, .box_w = 14, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 558, .adv_w = 67, .box_w = 2, .box_h = 6, .ofs_x = 1, .ofs_y = 12},
-    {.bitmap_index = 564, .adv_w = 131, .box_w = 7, .box_h = 26, .ofs_x = 1, .ofs_y = -6},
-    {.bitmap_index = 655, .adv_w = 134, .box_w = 7, .box_h = 26, .ofs_x = 0, .ofs_y = -6},
-    {.bitmap_index = 746, .adv_w = 165, .box_w = 11, .box_h = 10, .ofs_x = 0, .ofs_y = 7},
-    {.bitmap_index = 801, .adv_w = 218, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 1},
-    {.bitmap_index = 886, .adv_w = 76, .box_w = 4, .box_h = 7, .ofs_x = 0, .ofs_y = -4},
-    {.bitmap_index = 900, .adv_w = 106, .box_w = 7, .box_h = 2, .ofs_x = 0, .ofs_y = 6},
-    {.bitmap_index = 907, .adv_w = 101, .box_w = 4, .box_h = 3, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 913, .adv_w = 158, .box_w = 10, .box_h = 19, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 1008, .adv_w = 216, .box_w = 12, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1110, .adv_w = 216, .box_w = 7, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 1170, .adv_w = 216, .box_w = 12, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1272, .adv_w = 216, .box_w = 11, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1366, .adv_w = 216, .box_w = 13, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1477, .adv_w = 216, .box_w = 12, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1579, .adv_w = 216, .box_w = 12, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1681, .adv_w = 216, .box_w = 13, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1792, .adv_w = 216, .box_w = 12, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1894, .adv_w = 216, .box_w = 11, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1988, .adv_w = 93, .box_w = 4, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2014, .adv_w = 81, .box_w = 4, .box_h = 17, .ofs_x = 0, .ofs_y = -4},
-    {.bitmap_index = 2048, .adv_w = 195, .box_w = 11, .box_h = 11, .ofs_x = 0, .ofs_y = 2},
-    {.bitmap_index = 2109, .adv_w = 211, .box_w = 11, .box_h = 7, .ofs_x = 1, .ofs_y = 5},
-    {.bitmap_index = 2148, .adv_w = 201, .box_w = 11, .box_h = 11, .ofs_x = 1, .ofs_y = 2},
-    {.bitmap_index = 2209, .adv_w = 182, .box_w = 11, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2303, .adv_w = 345, .box_w = 20, .box_h = 22, .ofs_x = 1, .ofs_y = -5},
-    {.bitmap_index = 2523, .adv_w = 251, .box_w = 16, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2659, .adv_w = 239, .box_w = 13, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2770, .adv_w = 250, .box_w = 14, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2889, .adv_w = 252, .box_w = 14, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3008, .adv_w = 218, .box_w = 12, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3110, .adv_w = 212, .box_w = 12, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3212, .adv_w = 262, .box_w = 14, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3331, .adv_w = 274, .box_w = 15, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3459, .adv_w = 104, .box_w = 3, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 3485, .adv_w = 212, .box_w = 12, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3587, .adv_w = 241, .box_w = 15, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3715, .adv_w = 207, .box_w = 12, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3817, .adv_w = 335, .box_w = 18, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3970, .adv_w = 274, .box_w = 15, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 4098, .adv_w = 264, .box_w = 15, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 4226, .adv_w = 242, .box_w = 14, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 4345, .adv_w = 264, .box_w = 15, .box_h = 20, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 4495, .adv_w = 237, .box_w = 14, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 4614, .adv_w = 228, .box_w = 14, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 4733, .adv_w = 229, .box_w = 14, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 4852, .adv_w = 249, .box_w = 13, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 4963, .adv_w = 245, .box_w = 15, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 5091, .adv_w = 341, .box_w = 21, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 5270, .adv_w = 241, .box_w = 15, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 5398, .adv_w = 231, .box_w = 15, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 5526, .adv_w = 230, .box_w = 13, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 5637, .adv_w = 102, .box_w = 6, .box_h = 23, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 5706, .adv_w = 158, .box_w = 10, .box_h = 19, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 5801, .adv_w = 102, .box_w = 5, .box_h = 23, .ofs_x = 0, .ofs_y = -4},
-    {.bitmap_index = 5859, .adv_w = 161, .box_w = 10, .box_h = 9, .ofs_x = 0, .ofs_y = 9},
-    {.bitmap_index = 5904, .adv_w = 173, .box_w = 11, .box_h = 2, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 5915, .adv_w = 119, .box_w = 6, .box_h = 4, .ofs_x = 0, .ofs_y = 15},
-    {.bitmap_index = 5927, .adv_w = 209, .box_w = 11, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 5999, .adv_w = 216, .box_w = 12, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 6107, .adv_w = 201, .box_w = 11, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 6179, .adv_w = 217, .box_w = 11, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 6278, .adv_w = 204, .box_w = 11, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 6350, .adv_w = 134, .box_w = 9, .box_h = 18, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 6431, .adv_w = 216, .box_w = 11, .box_h = 18, .ofs_x = 1, .ofs_y = -5},
-    {.bitmap_index = 6530, .adv_w = 212, .box_w = 11, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 6629, .adv_w = 93, .box_w = 4, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 6663, .adv_w = 92, .box_w = 6, .box_h = 22, .ofs_x = -1, .ofs_y = -5},
-    {.bitmap_index = 6729, .adv_w = 195, .box_w = 12, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 6837, .adv_w = 93, .box_w = 4, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 6873, .adv_w = 337, .box_w = 19, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 6997, .adv_w = 212, .box_w = 11, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 7069, .adv_w = 219, .box_w = 12, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 7147, .adv_w = 216, .box_w = 12, .box_h = 18, .ofs_x = 1, .ofs_y = -5},
-    {.bitmap_index = 7255, .adv_w = 218, .box_w = 11, .box_h = 18, .ofs_x = 1, .ofs_y = -5},
-    {.bitmap_index = 7354, .adv_w = 130, .box_w = 7, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 7400, .adv_w = 198, .box_w = 11, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 7472, .adv_w = 126, .box_w = 8, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 7536, .adv_w = 212, .box_w = 11, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 7608, .adv_w = 186, .box_w = 12, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 7686, .adv_w = 289, .box_w = 18, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 7803, .adv_w = 191, .box_w = 12, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 7881, .adv_w = 182, .box_w = 12, .box_h = 18, .ofs_x = 0, .ofs_y = -5},
-    {.bitmap_index = 7989, .adv_w = 191, .box_w = 11, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 8061, .adv_w = 130, .box_w = 8, .box_h = 24, .ofs_x = 0, .ofs_y = -5},
-    {.bitmap_index = 8157, .adv_w = 94, .box_w = 2, .box_h = 21, .ofs_x = 2, .ofs_y = -4},
-    {.bitmap_index = 8178, .adv_w = 130, .box_w = 8, .box_h = 25, .ofs_x = 0, .ofs_y = -5},
-    {.bitmap_index = 8278, .adv_w = 261, .box_w = 14, .box_h = 5, .ofs_x = 1, .ofs_y = 5},
-    {.bitmap_index = 8313, .adv_w = 143, .box_w = 7, .box_h = 6, .ofs_x = 1, .ofs_y = 11}
+    {.bitmap_index = 0, .adv_w = 106, .box_w = 7, .box_h = 2, .ofs_x = 0, .ofs_y = 6},
+    {.bitmap_index = 5, .adv_w = 101, .box_w = 4, .box_h = 3, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 12, .adv_w = 158, .box_w = 10, .box_h = 19, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 75, .adv_w = 216, .box_w = 12, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 154, .adv_w = 216, .box_w = 7, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 176, .adv_w = 216, .box_w = 12, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 257, .adv_w = 216, .box_w = 11, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 342, .adv_w = 216, .box_w = 13, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 405, .adv_w = 216, .box_w = 12, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 487, .adv_w = 216, .box_w = 12, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 576, .adv_w = 216, .box_w = 13, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 643, .adv_w = 216, .box_w = 12, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 737, .adv_w = 216, .box_w = 11, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 822, .adv_w = 251, .box_w = 16, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 922, .adv_w = 239, .box_w = 13, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1000, .adv_w = 252, .box_w = 14, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1074, .adv_w = 212, .box_w = 12, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1104, .adv_w = 274, .box_w = 15, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1134, .adv_w = 207, .box_w = 12, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1153, .adv_w = 335, .box_w = 18, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1258, .adv_w = 274, .box_w = 15, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1331, .adv_w = 264, .box_w = 15, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1435, .adv_w = 237, .box_w = 14, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1510, .adv_w = 228, .box_w = 14, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1612, .adv_w = 229, .box_w = 14, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1636, .adv_w = 249, .box_w = 13, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1677, .adv_w = 241, .box_w = 15, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1780, .adv_w = 231, .box_w = 15, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1854, .adv_w = 209, .box_w = 11, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1922, .adv_w = 201, .box_w = 11, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1985, .adv_w = 217, .box_w = 11, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2052, .adv_w = 204, .box_w = 11, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2115, .adv_w = 93, .box_w = 4, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2128, .adv_w = 195, .box_w = 12, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2188, .adv_w = 93, .box_w = 4, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2193, .adv_w = 337, .box_w = 19, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2247, .adv_w = 212, .box_w = 11, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2280, .adv_w = 219, .box_w = 12, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2351, .adv_w = 216, .box_w = 12, .box_h = 18, .ofs_x = 1, .ofs_y = -5},
+    {.bitmap_index = 2419, .adv_w = 130, .box_w = 7, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2437, .adv_w = 198, .box_w = 11, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2507, .adv_w = 126, .box_w = 8, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2538, .adv_w = 289, .box_w = 18, .box_h = 13, .ofs_x = 0, .ofs_y = 0}
 };
 
 /*---------------------
  *  CHARACTER MAPPING
  *--------------------*/
 
+static const uint16_t unicode_list_2[] = {
+    0x0, 0x1, 0x3, 0x5, 0x7
+};
+
+static const uint16_t unicode_list_5[] = {
+    0x0, 0x1, 0x9, 0xb, 0xc, 0xd, 0x11
+};
+
+static const uint16_t unicode_list_7[] = {
+    0x0, 0x1, 0x2, 0x5
+};
 
 
 /*Collect the unicode lists and glyph_id offsets*/
 static const lv_font_fmt_txt_cmap_t cmaps[] =
 {
     {
-        .range_start = 32, .range_length = 95, .glyph_id_start = 1,
+        .range_start = 32, .range_length = 1, .glyph_id_start = 1,
         .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
     },
     {
-        .range_start = 176, .range_length = 1, .glyph_id_start = 96,
+        .range_start = 45, .range_length = 13, .glyph_id_start = 2,
         .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
+    },
+    {
+        .range_start = 65, .range_length = 8, .glyph_id_start = 15,
+        .unicode_list = unicode_list_2, .glyph_id_ofs_list = NULL, .list_length = 5, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY
+    },
+    {
+        .range_start = 76, .range_length = 4, .glyph_id_start = 20,
+        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
+    },
+    {
+        .range_start = 82, .range_length = 4, .glyph_id_start = 24,
+        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
+    },
+    {
+        .range_start = 88, .range_length = 18, .glyph_id_start = 28,
+        .unicode_list = unicode_list_5, .glyph_id_ofs_list = NULL, .list_length = 7, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY
+    },
+    {
+        .range_start = 107, .range_length = 6, .glyph_id_start = 35,
+        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
+    },
+    {
+        .range_start = 114, .range_length = 6, .glyph_id_start = 41,
+        .unicode_list = unicode_list_7, .glyph_id_ofs_list = NULL, .list_length = 4, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY
     }
 };
 
@@ -1418,22 +577,13 @@ static const lv_font_fmt_txt_cmap_t cmaps[] =
 /*Pair left and right glyphs for kerning*/
 static const uint8_t kern_pair_glyph_ids[] =
 {
-    3, 3,
-    3, 8,
-    8, 3,
-    8, 8,
-    13, 3,
-    13, 8,
-    15, 3,
-    15, 8,
-    16, 16
+    4, 4
 };
 
 /* Kerning between the respective left and right glyphs
  * 4.4 format which needs to scaled with `kern_scale`*/
 static const int8_t kern_pair_values[] =
 {
-    -20, -20, -20, -20, -32, -32, -32, -32,
     -42
 };
 
@@ -1442,7 +592,7 @@ static const lv_font_fmt_txt_kern_pair_t kern_pairs =
 {
     .glyph_ids = kern_pair_glyph_ids,
     .values = kern_pair_values,
-    .pair_cnt = 9,
+    .pair_cnt = 1,
     .glyph_ids_size = 0
 };
 
@@ -1465,10 +615,10 @@ static lv_font_fmt_txt_dsc_t font_dsc = {
     .cmaps = cmaps,
     .kern_dsc = &kern_pairs,
     .kern_scale = 16,
-    .cmap_num = 2,
+    .cmap_num = 8,
     .bpp = 4,
     .kern_classes = 0,
-    .bitmap_format = 0,
+    .bitmap_format = 1,
 #if LVGL_VERSION_MAJOR == 8
     .cache = &cache
 #endif
@@ -1487,7 +637,7 @@ const lv_font_t roboto_regular_24_data = {
 lv_font_t roboto_regular_24_data = {
 #endif
     .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,    /*Function pointer to get glyph's data*/
-    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,    /*Function pointer to get glyph's bitmap*/
+    .get_glyph_bitmap = glyph_cache_get_bitmap,    /*Function pointer to get glyph's bitmap*/
     .line_height = 26,          /*The maximum line height required by the font*/
     .base_line = 6,             /*Baseline measured from the bottom of the line*/
 #if !(LVGL_VERSION_MAJOR == 6 && LVGL_VERSION_MINOR == 0)
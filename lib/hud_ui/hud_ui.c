@@ -7,6 +7,7 @@
  *********************/
 
 #include "hud_ui.h"
+#include "fonts/glyph_cache.h"
 
 /*********************
  *      DEFINES
@@ -34,6 +35,9 @@
 
 void hud_ui_init(const char * asset_path)
 {
+    /*Before any label can fetch a glyph*/
+    glyph_cache_init();
+
     hud_ui_init_gen(asset_path);
 
     /* Add your own custom code here if needed */
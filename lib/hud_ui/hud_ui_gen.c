@@ -70,6 +70,8 @@ const void * back;
 extern const void * back_data;
 const void * restart;
 extern const void * restart_data;
+const void * fuel;
+extern const void * fuel_data;
 
 /*----------------
  * Global styles
@@ -85,12 +87,23 @@ lv_subject_t engine_rpm;
 lv_subject_t coolant_temp;
 lv_subject_t speed;
 lv_subject_t fuel_capacity;
+lv_subject_t gear;
+lv_subject_t fuel_economy;
+lv_subject_t acceleration;
+lv_subject_t trip_a;
+lv_subject_t trip_b;
+lv_subject_t trip_total;
 lv_subject_t can_error;
 lv_subject_t con_error;
+lv_subject_t rpm_stale;
+lv_subject_t speed_stale;
+lv_subject_t fuel_stale;
+lv_subject_t temp_stale;
 lv_subject_t settings_brightness;
 lv_subject_t settings_rotation;
 lv_subject_t settings_hud;
 lv_subject_t settings_restart;
+lv_subject_t settings_tank;
 
 /**********************
  *      MACROS
@@ -127,6 +140,7 @@ void hud_ui_init_gen(const char * asset_path)
     disconnect = &disconnect_data;
     back = &back_data;
     restart = &restart_data;
+    fuel = &fuel_data;
 
     /*----------------
      * Global styles
@@ -151,12 +165,38 @@ void hud_ui_init_gen(const char * asset_path)
     lv_subject_init_int(&coolant_temp, 0);
     lv_subject_init_int(&speed, 0);
     lv_subject_init_int(&fuel_capacity, 0);
+    lv_subject_init_int(&gear, 0);
+    lv_subject_set_min_value_int(&gear, 0);
+    lv_subject_set_max_value_int(&gear, 6);
+    lv_subject_init_int(&fuel_economy, 0);
+    lv_subject_init_int(&acceleration, 0);
+    static char trip_a_buf[UI_SUBJECT_STRING_LENGTH];
+    static char trip_a_prev_buf[UI_SUBJECT_STRING_LENGTH];
+    lv_subject_init_string(&trip_a, trip_a_buf, trip_a_prev_buf, UI_SUBJECT_STRING_LENGTH, "0.0 km");
+    static char trip_b_buf[UI_SUBJECT_STRING_LENGTH];
+    static char trip_b_prev_buf[UI_SUBJECT_STRING_LENGTH];
+    lv_subject_init_string(&trip_b, trip_b_buf, trip_b_prev_buf, UI_SUBJECT_STRING_LENGTH, "0.0 km");
+    static char trip_total_buf[UI_SUBJECT_STRING_LENGTH];
+    static char trip_total_prev_buf[UI_SUBJECT_STRING_LENGTH];
+    lv_subject_init_string(&trip_total, trip_total_buf, trip_total_prev_buf, UI_SUBJECT_STRING_LENGTH, "0 km");
     lv_subject_init_int(&can_error, 0);
     lv_subject_set_min_value_int(&can_error, 0);
     lv_subject_set_max_value_int(&can_error, 1);
     lv_subject_init_int(&con_error, 1);
     lv_subject_set_min_value_int(&con_error, 0);
     lv_subject_set_max_value_int(&con_error, 1);
+    lv_subject_init_int(&rpm_stale, 1);
+    lv_subject_set_min_value_int(&rpm_stale, 0);
+    lv_subject_set_max_value_int(&rpm_stale, 1);
+    lv_subject_init_int(&speed_stale, 1);
+    lv_subject_set_min_value_int(&speed_stale, 0);
+    lv_subject_set_max_value_int(&speed_stale, 1);
+    lv_subject_init_int(&fuel_stale, 1);
+    lv_subject_set_min_value_int(&fuel_stale, 0);
+    lv_subject_set_max_value_int(&fuel_stale, 1);
+    lv_subject_init_int(&temp_stale, 1);
+    lv_subject_set_min_value_int(&temp_stale, 0);
+    lv_subject_set_max_value_int(&temp_stale, 1);
     lv_subject_init_int(&settings_brightness, 127);
     lv_subject_set_min_value_int(&settings_brightness, 10);
     lv_subject_set_max_value_int(&settings_brightness, 255);
@@ -169,6 +209,9 @@ void hud_ui_init_gen(const char * asset_path)
     lv_subject_init_int(&settings_restart, 0);
     lv_subject_set_min_value_int(&settings_restart, 0);
     lv_subject_set_max_value_int(&settings_restart, 1);
+    lv_subject_init_int(&settings_tank, 50);
+    lv_subject_set_min_value_int(&settings_tank, 20);
+    lv_subject_set_max_value_int(&settings_tank, 120);
 
     /*----------------
      * Translations
@@ -176,6 +219,8 @@ void hud_ui_init_gen(const char * asset_path)
 
 #if LV_USE_XML
     /* Register widgets */
+    lv_xml_widget_register("digit_sprite", digit_sprite_xml_create, digit_sprite_xml_apply);
+    lv_xml_widget_register("arc_gauge", arc_gauge_xml_create, arc_gauge_xml_apply);
 
     /* Register fonts */
     lv_xml_register_font(NULL, "roboto_regular_24", roboto_regular_24);
@@ -187,12 +232,23 @@ void hud_ui_init_gen(const char * asset_path)
     lv_xml_register_subject(NULL, "coolant_temp", &coolant_temp);
     lv_xml_register_subject(NULL, "speed", &speed);
     lv_xml_register_subject(NULL, "fuel_capacity", &fuel_capacity);
+    lv_xml_register_subject(NULL, "gear", &gear);
+    lv_xml_register_subject(NULL, "fuel_economy", &fuel_economy);
+    lv_xml_register_subject(NULL, "acceleration", &acceleration);
+    lv_xml_register_subject(NULL, "trip_a", &trip_a);
+    lv_xml_register_subject(NULL, "trip_b", &trip_b);
+    lv_xml_register_subject(NULL, "trip_total", &trip_total);
     lv_xml_register_subject(NULL, "can_error", &can_error);
     lv_xml_register_subject(NULL, "con_error", &con_error);
+    lv_xml_register_subject(NULL, "rpm_stale", &rpm_stale);
+    lv_xml_register_subject(NULL, "speed_stale", &speed_stale);
+    lv_xml_register_subject(NULL, "fuel_stale", &fuel_stale);
+    lv_xml_register_subject(NULL, "temp_stale", &temp_stale);
     lv_xml_register_subject(NULL, "settings_brightness", &settings_brightness);
     lv_xml_register_subject(NULL, "settings_rotation", &settings_rotation);
     lv_xml_register_subject(NULL, "settings_hud", &settings_hud);
     lv_xml_register_subject(NULL, "settings_restart", &settings_restart);
+    lv_xml_register_subject(NULL, "settings_tank", &settings_tank);
 
     /* Register callbacks */
 #endif
@@ -209,6 +265,7 @@ void hud_ui_init_gen(const char * asset_path)
     lv_xml_register_image(NULL, "disconnect", disconnect);
     lv_xml_register_image(NULL, "back", back);
     lv_xml_register_image(NULL, "restart", restart);
+    lv_xml_register_image(NULL, "fuel", fuel);
 #endif
 
 #if LV_USE_XML == 0
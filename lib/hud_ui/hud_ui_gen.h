@@ -67,6 +67,7 @@ extern const void * warning;
 extern const void * disconnect;
 extern const void * back;
 extern const void * restart;
+extern const void * fuel;
 
 /*----------------
  * Subjects
@@ -76,12 +77,23 @@ extern lv_subject_t engine_rpm;
 extern lv_subject_t coolant_temp;
 extern lv_subject_t speed;
 extern lv_subject_t fuel_capacity;
+extern lv_subject_t gear;
+extern lv_subject_t fuel_economy;
+extern lv_subject_t acceleration;
+extern lv_subject_t trip_a;
+extern lv_subject_t trip_b;
+extern lv_subject_t trip_total;
 extern lv_subject_t can_error;
 extern lv_subject_t con_error;
+extern lv_subject_t rpm_stale;
+extern lv_subject_t speed_stale;
+extern lv_subject_t fuel_stale;
+extern lv_subject_t temp_stale;
 extern lv_subject_t settings_brightness;
 extern lv_subject_t settings_rotation;
 extern lv_subject_t settings_hud;
 extern lv_subject_t settings_restart;
+extern lv_subject_t settings_tank;
 
 /**********************
  * GLOBAL PROTOTYPES
@@ -107,9 +119,12 @@ void hud_ui_init_gen(const char * asset_path);
 
 /*Include all the widget and components of this library*/
 #include "components/settings_item/settings_item_gen.h"
+#include "widgets/digit_sprite/digit_sprite.h"
+#include "widgets/arc_gauge/arc_gauge.h"
 #include "screens/boot_gen.h"
 #include "screens/dashboard_gen.h"
 #include "screens/settings_gen.h"
+#include "screens/trip_gen.h"
 
 #ifdef __cplusplus
 } /*extern "C"*/
@@ -37,7 +37,7 @@ lv_obj_t * dashboard_create(void)
     static lv_style_t style_dashboard;
     static lv_style_t style_arc;
     static lv_style_t style_arc_indicator;
-    static lv_style_t style_knob;
+    static lv_style_t style_stale;
 
     static bool style_inited = false;
 
@@ -55,8 +55,9 @@ lv_obj_t * dashboard_create(void)
         lv_style_set_arc_rounded(&style_arc_indicator, false);
         lv_style_set_arc_color(&style_arc_indicator, lv_color_hex(0xffffff));
 
-        lv_style_init(&style_knob);
-        lv_style_set_bg_opa(&style_knob, 0);
+        lv_style_init(&style_stale);
+        lv_style_set_text_opa(&style_stale, 90);
+        lv_style_set_arc_opa(&style_stale, 90);
 
         style_inited = true;
     }
@@ -66,52 +67,64 @@ lv_obj_t * dashboard_create(void)
 
     lv_obj_add_style(lv_obj_0, &style_dark, 0);
     lv_obj_add_style(lv_obj_0, &style_dashboard, 0);
-    lv_obj_t * lv_arc_0 = lv_arc_create(lv_obj_0);
-    lv_obj_set_align(lv_arc_0, LV_ALIGN_TOP_MID);
-    lv_obj_set_width(lv_arc_0, 466);
-    lv_obj_set_height(lv_arc_0, 466);
-    lv_arc_set_min_value(lv_arc_0, 0);
-    lv_arc_set_max_value(lv_arc_0, 8000);
-    lv_arc_bind_value(lv_arc_0, &engine_rpm);
-    lv_obj_set_flag(lv_arc_0, LV_OBJ_FLAG_CLICKABLE, false);
-    lv_obj_add_style(lv_arc_0, &style_arc, 0);
-    lv_obj_add_style(lv_arc_0, &style_arc_indicator, LV_PART_INDICATOR);
-    lv_obj_add_style(lv_arc_0, &style_knob, LV_PART_KNOB);
+    lv_obj_t * rpm_arc = arc_gauge_create(lv_obj_0);
+    lv_obj_set_name(rpm_arc, "rpm_arc");
+    lv_obj_set_align(rpm_arc, LV_ALIGN_TOP_MID);
+    lv_obj_set_width(rpm_arc, 466);
+    lv_obj_set_height(rpm_arc, 466);
+    arc_gauge_set_min_value(rpm_arc, 0);
+    arc_gauge_set_max_value(rpm_arc, 8000);
+    arc_gauge_bind_value(rpm_arc, &engine_rpm);
+    lv_obj_add_style(rpm_arc, &style_arc, 0);
+    lv_obj_add_style(rpm_arc, &style_arc_indicator, LV_PART_INDICATOR);
+    lv_obj_add_style(rpm_arc, &style_stale, LV_STATE_DISABLED);
+    lv_obj_add_style(rpm_arc, &style_stale, LV_PART_INDICATOR | LV_STATE_DISABLED);
+    lv_obj_bind_state_if_eq(rpm_arc, &rpm_stale, LV_STATE_DISABLED, 1);
     
     lv_obj_t * lv_label_0 = lv_label_create(lv_obj_0);
     lv_label_bind_text(lv_label_0, &engine_rpm, NULL);
     lv_obj_set_align(lv_label_0, LV_ALIGN_TOP_MID);
     lv_obj_set_y(lv_label_0, 60);
+    lv_obj_add_style(lv_label_0, &style_stale, LV_STATE_DISABLED);
+    lv_obj_bind_state_if_eq(lv_label_0, &rpm_stale, LV_STATE_DISABLED, 1);
+    
+    lv_obj_t * digit_sprite_0 = digit_sprite_create(lv_obj_0);
+    digit_sprite_bind_value(digit_sprite_0, &speed);
+    lv_obj_set_align(digit_sprite_0, LV_ALIGN_CENTER);
+    lv_obj_set_style_text_font(digit_sprite_0, roboto_bold_150, 0);
+    lv_obj_set_y(digit_sprite_0, -30);
+    lv_obj_add_style(digit_sprite_0, &style_stale, LV_STATE_DISABLED);
+    lv_obj_bind_state_if_eq(digit_sprite_0, &speed_stale, LV_STATE_DISABLED, 1);
     
     lv_obj_t * lv_label_1 = lv_label_create(lv_obj_0);
-    lv_label_bind_text(lv_label_1, &speed, NULL);
-    lv_obj_set_align(lv_label_1, LV_ALIGN_CENTER);
-    lv_obj_set_style_text_font(lv_label_1, roboto_bold_150, 0);
-    lv_obj_set_y(lv_label_1, -30);
+    lv_label_bind_text(lv_label_1, &coolant_temp, "%02d°C");
+    lv_obj_set_align(lv_label_1, LV_ALIGN_BOTTOM_MID);
+    lv_obj_set_y(lv_label_1, -120);
+    lv_obj_add_style(lv_label_1, &style_stale, LV_STATE_DISABLED);
+    lv_obj_bind_state_if_eq(lv_label_1, &temp_stale, LV_STATE_DISABLED, 1);
+    
+    lv_obj_t * fuel_arc = arc_gauge_create(lv_obj_0);
+    lv_obj_set_name(fuel_arc, "fuel_arc");
+    arc_gauge_set_bg_start_angle(fuel_arc, 55);
+    arc_gauge_set_bg_end_angle(fuel_arc, 125);
+    lv_obj_set_align(fuel_arc, LV_ALIGN_TOP_MID);
+    lv_obj_set_width(fuel_arc, 466);
+    lv_obj_set_height(fuel_arc, 466);
+    arc_gauge_set_min_value(fuel_arc, 0);
+    arc_gauge_set_max_value(fuel_arc, 50);
+    arc_gauge_bind_value(fuel_arc, &fuel_capacity);
+    lv_obj_add_style(fuel_arc, &style_arc, 0);
+    lv_obj_add_style(fuel_arc, &style_arc_indicator, LV_PART_INDICATOR);
+    lv_obj_add_style(fuel_arc, &style_stale, LV_STATE_DISABLED);
+    lv_obj_add_style(fuel_arc, &style_stale, LV_PART_INDICATOR | LV_STATE_DISABLED);
+    lv_obj_bind_state_if_eq(fuel_arc, &fuel_stale, LV_STATE_DISABLED, 1);
     
     lv_obj_t * lv_label_2 = lv_label_create(lv_obj_0);
-    lv_label_bind_text(lv_label_2, &coolant_temp, "%02d°C");
+    lv_label_bind_text(lv_label_2, &fuel_capacity, "%d L");
     lv_obj_set_align(lv_label_2, LV_ALIGN_BOTTOM_MID);
-    lv_obj_set_y(lv_label_2, -120);
-    
-    lv_obj_t * lv_arc_1 = lv_arc_create(lv_obj_0);
-    lv_arc_set_bg_start_angle(lv_arc_1, 55);
-    lv_arc_set_bg_end_angle(lv_arc_1, 125);
-    lv_obj_set_align(lv_arc_1, LV_ALIGN_TOP_MID);
-    lv_obj_set_width(lv_arc_1, 466);
-    lv_obj_set_height(lv_arc_1, 466);
-    lv_arc_set_min_value(lv_arc_1, 0);
-    lv_arc_set_max_value(lv_arc_1, 50);
-    lv_arc_bind_value(lv_arc_1, &fuel_capacity);
-    lv_obj_set_flag(lv_arc_1, LV_OBJ_FLAG_CLICKABLE, false);
-    lv_obj_add_style(lv_arc_1, &style_arc, 0);
-    lv_obj_add_style(lv_arc_1, &style_arc_indicator, LV_PART_INDICATOR);
-    lv_obj_add_style(lv_arc_1, &style_knob, LV_PART_KNOB);
-    
-    lv_obj_t * lv_label_3 = lv_label_create(lv_obj_0);
-    lv_label_bind_text(lv_label_3, &fuel_capacity, "%d L");
-    lv_obj_set_align(lv_label_3, LV_ALIGN_BOTTOM_MID);
-    lv_obj_set_y(lv_label_3, -40);
+    lv_obj_set_y(lv_label_2, -40);
+    lv_obj_add_style(lv_label_2, &style_stale, LV_STATE_DISABLED);
+    lv_obj_bind_state_if_eq(lv_label_2, &fuel_stale, LV_STATE_DISABLED, 1);
     
     lv_obj_t * lv_image_0 = lv_image_create(lv_obj_0);
     lv_image_set_src(lv_image_0, warning);
@@ -85,19 +85,34 @@ lv_obj_t * settings_create(void)
     
     lv_obj_t * settings_item_0 = settings_item_create(lv_obj_1, brightness);
     lv_obj_set_style_pad_column(settings_item_0, 50, 0);
-    lv_obj_t * lv_slider_0 = lv_slider_create(settings_item_0);
-    lv_slider_set_min_value(lv_slider_0, 10);
-    lv_slider_set_max_value(lv_slider_0, 255);
-    lv_slider_bind_value(lv_slider_0, &settings_brightness);
-    lv_obj_set_ext_click_area(lv_slider_0, 50);
-    lv_obj_add_style(lv_slider_0, &style_slider, 0);
+    lv_obj_t * brightness_slider = lv_slider_create(settings_item_0);
+    lv_obj_set_name(brightness_slider, "brightness_slider");
+    lv_slider_set_min_value(brightness_slider, 10);
+    lv_slider_set_max_value(brightness_slider, 255);
+    lv_slider_bind_value(brightness_slider, &settings_brightness);
+    lv_obj_set_ext_click_area(brightness_slider, 50);
+    lv_obj_add_style(brightness_slider, &style_slider, 0);
+    
+    lv_obj_t * settings_item_1 = settings_item_create(lv_obj_1, fuel);
+    lv_obj_set_style_pad_column(settings_item_1, 20, 0);
+    lv_obj_t * tank_slider = lv_slider_create(settings_item_1);
+    lv_obj_set_name(tank_slider, "tank_slider");
+    lv_slider_set_min_value(tank_slider, 20);
+    lv_slider_set_max_value(tank_slider, 120);
+    lv_slider_bind_value(tank_slider, &settings_tank);
+    lv_obj_set_ext_click_area(tank_slider, 50);
+    lv_obj_add_style(tank_slider, &style_slider, 0);
     
-    lv_obj_t * settings_item_1 = settings_item_create(lv_obj_1, hud);
     lv_obj_t * lv_label_1 = lv_label_create(settings_item_1);
     lv_obj_set_flex_grow(lv_label_1, 1);
-    lv_label_set_text(lv_label_1, "HUD Mode");
+    lv_label_bind_text(lv_label_1, &settings_tank, "%d L");
+    
+    lv_obj_t * settings_item_2 = settings_item_create(lv_obj_1, hud);
+    lv_obj_t * lv_label_2 = lv_label_create(settings_item_2);
+    lv_obj_set_flex_grow(lv_label_2, 1);
+    lv_label_set_text(lv_label_2, "HUD Mode");
     
-    lv_obj_t * lv_dropdown_0 = lv_dropdown_create(settings_item_1);
+    lv_obj_t * lv_dropdown_0 = lv_dropdown_create(settings_item_2);
     lv_dropdown_set_options(lv_dropdown_0, "OFF\nX Flip\nY Flip\nXY Flip");
     lv_dropdown_bind_value(lv_dropdown_0, &settings_hud);
     lv_dropdown_set_symbol(lv_dropdown_0, NULL);
@@ -106,20 +121,20 @@ lv_obj_t * settings_create(void)
     lv_obj_set_style_pad_all(lv_dropdown_0, 10, 0);
     lv_obj_add_style(lv_dropdown_list_0, &style_dropdown, 0);
     
-    lv_obj_t * settings_item_2 = settings_item_create(lv_obj_1, restart);
-    lv_obj_t * lv_label_2 = lv_label_create(settings_item_2);
-    lv_obj_set_flex_grow(lv_label_2, 1);
-    lv_label_set_text(lv_label_2, "Restart on Disconnect");
+    lv_obj_t * settings_item_3 = settings_item_create(lv_obj_1, restart);
+    lv_obj_t * lv_label_3 = lv_label_create(settings_item_3);
+    lv_obj_set_flex_grow(lv_label_3, 1);
+    lv_label_set_text(lv_label_3, "Restart on Disconnect");
     
-    lv_obj_t * lv_switch_0 = lv_switch_create(settings_item_2);
+    lv_obj_t * lv_switch_0 = lv_switch_create(settings_item_3);
     lv_obj_bind_checked(lv_switch_0, &settings_restart);
     
     lv_obj_t * settings_restart = settings_item_create(lv_obj_1, restart);
     lv_obj_set_name(settings_restart, "settings_restart");
     lv_obj_add_style(settings_restart, &style_pressed, LV_STATE_PRESSED);
-    lv_obj_t * lv_label_3 = lv_label_create(settings_restart);
-    lv_obj_set_flex_grow(lv_label_3, 1);
-    lv_label_set_text(lv_label_3, "Restart Now");
+    lv_obj_t * lv_label_4 = lv_label_create(settings_restart);
+    lv_obj_set_flex_grow(lv_label_4, 1);
+    lv_label_set_text(lv_label_4, "Restart Now");
 
     LV_TRACE_OBJ_CREATE("finished");
 
@@ -0,0 +1,129 @@
+/**
+ * @file trip_gen.c
+ * @brief Template source file for LVGL objects
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "trip_gen.h"
+#include "hud_ui.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/***********************
+ *  STATIC VARIABLES
+ **********************/
+
+/***********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+lv_obj_t * trip_create(void)
+{
+    LV_TRACE_OBJ_CREATE("begin");
+
+    static lv_style_t style_cont;
+    static lv_style_t style_trip;
+    static lv_style_t style_pressed;
+
+    static bool style_inited = false;
+
+    if (!style_inited) {
+        lv_style_init(&style_cont);
+        lv_style_set_width(&style_cont, 360);
+        lv_style_set_height(&style_cont, 300);
+        lv_style_set_pad_all(&style_cont, 0);
+        lv_style_set_pad_row(&style_cont, 0);
+        lv_style_set_radius(&style_cont, 0);
+        lv_style_set_border_width(&style_cont, 0);
+        lv_style_set_bg_opa(&style_cont, 0);
+        lv_style_set_layout(&style_cont, LV_LAYOUT_FLEX);
+        lv_style_set_flex_flow(&style_cont, LV_FLEX_FLOW_COLUMN);
+
+        lv_style_init(&style_trip);
+        lv_style_set_width(&style_trip, 360);
+        lv_style_set_height(&style_trip, 100);
+        lv_style_set_pad_all(&style_trip, 0);
+        lv_style_set_border_width(&style_trip, 1);
+        lv_style_set_border_side(&style_trip, LV_BORDER_SIDE_BOTTOM);
+        lv_style_set_radius(&style_trip, 0);
+        lv_style_set_bg_opa(&style_trip, 0);
+        lv_style_set_layout(&style_trip, LV_LAYOUT_FLEX);
+        lv_style_set_flex_flow(&style_trip, LV_FLEX_FLOW_COLUMN);
+        lv_style_set_flex_main_place(&style_trip, LV_FLEX_ALIGN_CENTER);
+        lv_style_set_flex_cross_place(&style_trip, LV_FLEX_ALIGN_CENTER);
+        lv_style_set_flex_track_place(&style_trip, LV_FLEX_ALIGN_CENTER);
+
+        lv_style_init(&style_pressed);
+        lv_style_set_bg_color(&style_pressed, lv_color_hex(0xffffff));
+        lv_style_set_bg_opa(&style_pressed, 100);
+        lv_style_set_radius(&style_pressed, 0);
+
+        style_inited = true;
+    }
+
+    lv_obj_t * lv_obj_0 = lv_obj_create(NULL);
+    lv_obj_set_name_static(lv_obj_0, "trip_#");
+
+    lv_obj_add_style(lv_obj_0, &style_dark, 0);
+    lv_obj_t * lv_obj_1 = lv_obj_create(lv_obj_0);
+    lv_obj_set_align(lv_obj_1, LV_ALIGN_CENTER);
+    lv_obj_set_scrollbar_mode(lv_obj_1, LV_SCROLLBAR_MODE_OFF);
+    lv_obj_add_style(lv_obj_1, &style_cont, 0);
+    lv_obj_t * trip_back = settings_item_create(lv_obj_1, back);
+    lv_obj_set_name(trip_back, "trip_back");
+    lv_obj_add_style(trip_back, &style_pressed, LV_STATE_PRESSED);
+    lv_obj_t * lv_label_0 = lv_label_create(trip_back);
+    lv_obj_set_flex_grow(lv_label_0, 1);
+    lv_label_set_text(lv_label_0, "Back to Main Screen");
+    
+    lv_obj_t * trip_a_reset = lv_obj_create(lv_obj_1);
+    lv_obj_set_name(trip_a_reset, "trip_a_reset");
+    lv_obj_add_style(trip_a_reset, &style_trip, 0);
+    lv_obj_add_style(trip_a_reset, &style_pressed, LV_STATE_PRESSED);
+    lv_obj_t * lv_label_1 = lv_label_create(trip_a_reset);
+    lv_label_set_text(lv_label_1, "Trip A");
+    
+    lv_obj_t * lv_label_2 = lv_label_create(trip_a_reset);
+    lv_label_bind_text(lv_label_2, &trip_a, NULL);
+    
+    lv_obj_t * trip_b_reset = lv_obj_create(lv_obj_1);
+    lv_obj_set_name(trip_b_reset, "trip_b_reset");
+    lv_obj_add_style(trip_b_reset, &style_trip, 0);
+    lv_obj_add_style(trip_b_reset, &style_pressed, LV_STATE_PRESSED);
+    lv_obj_t * lv_label_3 = lv_label_create(trip_b_reset);
+    lv_label_set_text(lv_label_3, "Trip B");
+    
+    lv_obj_t * lv_label_4 = lv_label_create(trip_b_reset);
+    lv_label_bind_text(lv_label_4, &trip_b, NULL);
+    
+    lv_obj_t * lv_obj_2 = lv_obj_create(lv_obj_1);
+    lv_obj_set_flag(lv_obj_2, LV_OBJ_FLAG_CLICKABLE, false);
+    lv_obj_add_style(lv_obj_2, &style_trip, 0);
+    lv_obj_t * lv_label_5 = lv_label_create(lv_obj_2);
+    lv_label_set_text(lv_label_5, "Total");
+    
+    lv_obj_t * lv_label_6 = lv_label_create(lv_obj_2);
+    lv_label_bind_text(lv_label_6, &trip_total, NULL);
+
+    LV_TRACE_OBJ_CREATE("finished");
+
+    return lv_obj_0;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
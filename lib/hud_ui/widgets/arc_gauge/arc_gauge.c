@@ -0,0 +1,369 @@
+/**
+ * @file arc_gauge.c
+ *
+ * Like an lv_arc in normal mode, without knob and input, but a value change
+ * invalidates only the ring between the old and the new angle. The ring is
+ * cut in ARC_GAUGE_SEGMENT_STEP degree segments whose bounding boxes are
+ * computed once per layout; a change invalidates the segments it covers,
+ * the ones it covers partly get the exact box of their covered part.
+ * lv_arc invalidates one box around the whole change, which gets as wide as
+ * the ring once the change crosses a quadrant, and the whole widget for
+ * changes over 180 degrees.
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "arc_gauge_private_gen.h"
+#include "arc_gauge.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+#define MY_CLASS (&arc_gauge_class)
+
+/*Room for anti-aliasing and rounding around a segment*/
+#define SEGMENT_MARGIN 2
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+static void arc_gauge_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj);
+static void arc_gauge_event(const lv_obj_class_t * class_p, lv_event_t * e);
+static void draw_main(lv_event_t * e);
+static void value_observer_cb(lv_observer_t * observer, lv_subject_t * subject);
+static void get_center(lv_obj_t * obj, lv_point_t * center, int32_t * arc_r);
+static void get_indic_ring(lv_obj_t * obj, int32_t * r_out, int32_t * r_in);
+static int32_t get_sweep(const arc_gauge_t * gauge);
+static int32_t value_to_angle(const arc_gauge_t * gauge, int32_t value);
+static void sector_area(int32_t r_out, int32_t r_in, int32_t start, int32_t end, arc_gauge_segment_t * seg);
+static void segments_update(lv_obj_t * obj);
+static void invalidate_delta(lv_obj_t * obj, int32_t from, int32_t to);
+static void value_update(lv_obj_t * obj, int32_t old_angle);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+const lv_obj_class_t arc_gauge_class = {
+    .base_class = &lv_obj_class,
+    .constructor_cb = arc_gauge_constructor,
+    .event_cb = arc_gauge_event,
+    .width_def = LV_DPI_DEF * 2,
+    .height_def = LV_DPI_DEF * 2,
+    .instance_size = sizeof(arc_gauge_t),
+    .name = "arc_gauge",
+};
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+lv_obj_t * arc_gauge_create(lv_obj_t * parent)
+{
+    LV_LOG_INFO("begin");
+    lv_obj_t * obj = lv_obj_class_create_obj(MY_CLASS, parent);
+    lv_obj_class_init_obj(obj);
+    return obj;
+}
+
+void arc_gauge_set_min_value(lv_obj_t * obj, int32_t min_value)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    arc_gauge_t * gauge = (arc_gauge_t *)obj;
+    if(gauge->min_value == min_value) return;
+
+    int32_t old_angle = value_to_angle(gauge, gauge->value);
+    gauge->min_value = min_value;
+    if(gauge->max_value < min_value) gauge->max_value = min_value;
+    value_update(obj, old_angle);
+}
+
+void arc_gauge_set_max_value(lv_obj_t * obj, int32_t max_value)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    arc_gauge_t * gauge = (arc_gauge_t *)obj;
+    if(gauge->max_value == max_value) return;
+
+    int32_t old_angle = value_to_angle(gauge, gauge->value);
+    gauge->max_value = max_value;
+    if(gauge->min_value > max_value) gauge->min_value = max_value;
+    value_update(obj, old_angle);
+}
+
+void arc_gauge_set_value(lv_obj_t * obj, int32_t value)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    arc_gauge_t * gauge = (arc_gauge_t *)obj;
+    if(gauge->value == value) return;
+
+    int32_t old_angle = value_to_angle(gauge, gauge->value);
+    gauge->value = value;
+    value_update(obj, old_angle);
+}
+
+lv_observer_t * arc_gauge_bind_value(lv_obj_t * obj, lv_subject_t * subject)
+{
+    LV_ASSERT_NULL(subject);
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    if(subject->type != LV_SUBJECT_TYPE_INT) {
+        LV_LOG_WARN("Incompatible subject type: %d", subject->type);
+        return NULL;
+    }
+    return lv_subject_add_observer_obj(subject, value_observer_cb, obj, NULL);
+}
+
+void arc_gauge_set_bg_start_angle(lv_obj_t * obj, int32_t angle)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    arc_gauge_t * gauge = (arc_gauge_t *)obj;
+    gauge->bg_start_angle = (int16_t)(((angle % 360) + 360) % 360);
+    segments_update(obj);
+    lv_obj_invalidate(obj);
+}
+
+void arc_gauge_set_bg_end_angle(lv_obj_t * obj, int32_t angle)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    arc_gauge_t * gauge = (arc_gauge_t *)obj;
+    gauge->bg_end_angle = (int16_t)(((angle % 360) + 360) % 360);
+    segments_update(obj);
+    lv_obj_invalidate(obj);
+}
+
+int32_t arc_gauge_get_value(lv_obj_t * obj)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    arc_gauge_t * gauge = (arc_gauge_t *)obj;
+    return LV_CLAMP(gauge->min_value, gauge->value, gauge->max_value);
+}
+
+uint32_t arc_gauge_take_invalidated(lv_obj_t * obj)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    arc_gauge_t * gauge = (arc_gauge_t *)obj;
+    uint32_t px = gauge->invalidated;
+    gauge->invalidated = 0;
+    return px;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void arc_gauge_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
+{
+    LV_UNUSED(class_p);
+    arc_gauge_t * gauge = (arc_gauge_t *)obj;
+    gauge->min_value = 0;
+    gauge->max_value = 100;
+    gauge->value = 0;
+    gauge->bg_start_angle = 135;
+    gauge->bg_end_angle = 45;
+    gauge->invalidated = 0;
+    gauge->segment_cnt = 0;
+    lv_obj_remove_flag(obj, LV_OBJ_FLAG_CLICKABLE);
+    lv_obj_remove_flag(obj, LV_OBJ_FLAG_SCROLLABLE);
+}
+
+static void arc_gauge_event(const lv_obj_class_t * class_p, lv_event_t * e)
+{
+    LV_UNUSED(class_p);
+
+    lv_result_t res = lv_obj_event_base(MY_CLASS, e);
+    if(res != LV_RESULT_OK) return;
+
+    lv_event_code_t code = lv_event_get_code(e);
+    lv_obj_t * obj = lv_event_get_current_target(e);
+
+    if(code == LV_EVENT_SIZE_CHANGED || code == LV_EVENT_STYLE_CHANGED) {
+        segments_update(obj);
+    }
+    else if(code == LV_EVENT_DRAW_MAIN) {
+        draw_main(e);
+    }
+}
+
+static void draw_main(lv_event_t * e)
+{
+    lv_obj_t * obj = lv_event_get_current_target(e);
+    arc_gauge_t * gauge = (arc_gauge_t *)obj;
+    lv_layer_t * layer = lv_event_get_layer(e);
+
+    lv_point_t center;
+    int32_t arc_r;
+    get_center(obj, &center, &arc_r);
+
+    int32_t end = gauge->bg_start_angle + get_sweep(gauge);
+    if(end > 360) end -= 360;
+
+    lv_draw_arc_dsc_t arc_dsc;
+    lv_draw_arc_dsc_init(&arc_dsc);
+    lv_obj_init_draw_arc_dsc(obj, LV_PART_MAIN, &arc_dsc);
+    arc_dsc.center = center;
+    arc_dsc.radius = arc_r;
+    arc_dsc.start_angle = gauge->bg_start_angle;
+    arc_dsc.end_angle = end;
+    lv_draw_arc(layer, &arc_dsc);
+
+    int32_t angle = value_to_angle(gauge, gauge->value);
+    if(angle == 0) return;
+
+    int32_t r_out, r_in;
+    get_indic_ring(obj, &r_out, &r_in);
+    end = gauge->bg_start_angle + angle;
+    if(end > 360) end -= 360;
+
+    lv_draw_arc_dsc_init(&arc_dsc);
+    lv_obj_init_draw_arc_dsc(obj, LV_PART_INDICATOR, &arc_dsc);
+    arc_dsc.center = center;
+    arc_dsc.radius = r_out;
+    arc_dsc.start_angle = gauge->bg_start_angle;
+    arc_dsc.end_angle = end;
+    lv_draw_arc(layer, &arc_dsc);
+}
+
+static void value_observer_cb(lv_observer_t * observer, lv_subject_t * subject)
+{
+    arc_gauge_set_value(lv_observer_get_target_obj(observer), lv_subject_get_int(subject));
+}
+
+/*Same geometry as lv_arc: the largest circle in the content area, at its top left*/
+static void get_center(lv_obj_t * obj, lv_point_t * center, int32_t * arc_r)
+{
+    int32_t left = lv_obj_get_style_pad_left(obj, LV_PART_MAIN);
+    int32_t right = lv_obj_get_style_pad_right(obj, LV_PART_MAIN);
+    int32_t top = lv_obj_get_style_pad_top(obj, LV_PART_MAIN);
+    int32_t bottom = lv_obj_get_style_pad_bottom(obj, LV_PART_MAIN);
+
+    int32_t r = LV_MIN(lv_obj_get_width(obj) - left - right, lv_obj_get_height(obj) - top - bottom) / 2;
+    center->x = obj->coords.x1 + r + left;
+    center->y = obj->coords.y1 + r + top;
+    *arc_r = r;
+}
+
+static void get_indic_ring(lv_obj_t * obj, int32_t * r_out, int32_t * r_in)
+{
+    lv_point_t center;
+    int32_t arc_r;
+    get_center(obj, &center, &arc_r);
+
+    int32_t left = lv_obj_get_style_pad_left(obj, LV_PART_INDICATOR);
+    int32_t right = lv_obj_get_style_pad_right(obj, LV_PART_INDICATOR);
+    int32_t top = lv_obj_get_style_pad_top(obj, LV_PART_INDICATOR);
+    int32_t bottom = lv_obj_get_style_pad_bottom(obj, LV_PART_INDICATOR);
+
+    *r_out = arc_r - LV_MAX(LV_MAX(left, right), LV_MAX(top, bottom));
+    *r_in = LV_MAX(*r_out - lv_obj_get_style_arc_width(obj, LV_PART_INDICATOR), 0);
+}
+
+/*Degrees from the start to the end angle, clockwise*/
+static int32_t get_sweep(const arc_gauge_t * gauge)
+{
+    int32_t sweep = gauge->bg_end_angle - gauge->bg_start_angle;
+    if(sweep <= 0) sweep += 360;
+    return sweep;
+}
+
+/*Degrees of indicator from the start angle*/
+static int32_t value_to_angle(const arc_gauge_t * gauge, int32_t value)
+{
+    if(gauge->max_value <= gauge->min_value) return 0;
+    return lv_map(value, gauge->min_value, gauge->max_value, 0, get_sweep(gauge));
+}
+
+/*Bounding box of the ring between two absolute angles, `start` <= `end`*/
+static void sector_area(int32_t r_out, int32_t r_in, int32_t start, int32_t end, arc_gauge_segment_t * seg)
+{
+    int32_t x1 = INT16_MAX, y1 = INT16_MAX, x2 = INT16_MIN, y2 = INT16_MIN;
+    int32_t angles[2 + 4];
+    int32_t radii[2] = {r_out, r_in};
+    uint32_t angle_cnt = 0;
+
+    angles[angle_cnt++] = start;
+    angles[angle_cnt++] = end;
+    /*The ring bulges out at every multiple of 90 degrees crossed*/
+    for(int32_t a = (start / 90 + 1) * 90; a < end && angle_cnt < 6; a += 90) {
+        angles[angle_cnt++] = a;
+    }
+
+    for(uint32_t i = 0; i < angle_cnt; i++) {
+        int32_t s = lv_trigo_sin((int16_t)angles[i]);
+        int32_t c = lv_trigo_cos((int16_t)angles[i]);
+        for(uint32_t j = 0; j < 2; j++) {
+            int32_t x = (c * radii[j]) >> LV_TRIGO_SHIFT;
+            int32_t y = (s * radii[j]) >> LV_TRIGO_SHIFT;
+            x1 = LV_MIN(x1, x);
+            y1 = LV_MIN(y1, y);
+            x2 = LV_MAX(x2, x);
+            y2 = LV_MAX(y2, y);
+        }
+    }
+
+    seg->x1 = (int16_t)(x1 - SEGMENT_MARGIN);
+    seg->y1 = (int16_t)(y1 - SEGMENT_MARGIN);
+    seg->x2 = (int16_t)(x2 + SEGMENT_MARGIN);
+    seg->y2 = (int16_t)(y2 + SEGMENT_MARGIN);
+}
+
+static void segments_update(lv_obj_t * obj)
+{
+    arc_gauge_t * gauge = (arc_gauge_t *)obj;
+    int32_t r_out, r_in;
+    get_indic_ring(obj, &r_out, &r_in);
+
+    int32_t sweep = get_sweep(gauge);
+    gauge->segment_cnt = (uint16_t)((sweep + ARC_GAUGE_SEGMENT_STEP - 1) / ARC_GAUGE_SEGMENT_STEP);
+    for(uint32_t i = 0; i < gauge->segment_cnt; i++) {
+        int32_t start = gauge->bg_start_angle + i * ARC_GAUGE_SEGMENT_STEP;
+        int32_t end = LV_MIN(start + ARC_GAUGE_SEGMENT_STEP, gauge->bg_start_angle + sweep);
+        sector_area(r_out, r_in, start, end, &gauge->segments[i]);
+    }
+}
+
+/*Invalidate the indicator between two angles from the start, in either order*/
+static void invalidate_delta(lv_obj_t * obj, int32_t from, int32_t to)
+{
+    arc_gauge_t * gauge = (arc_gauge_t *)obj;
+    if(from == to || gauge->segment_cnt == 0) return;
+    if(from > to) {
+        int32_t tmp = from;
+        from = to;
+        to = tmp;
+    }
+
+    lv_point_t center;
+    int32_t arc_r;
+    get_center(obj, &center, &arc_r);
+    int32_t r_out = 0, r_in = 0;
+
+    for(int32_t i = from / ARC_GAUGE_SEGMENT_STEP; i < gauge->segment_cnt; i++) {
+        int32_t seg_start = i * ARC_GAUGE_SEGMENT_STEP;
+        int32_t seg_end = seg_start + ARC_GAUGE_SEGMENT_STEP;
+        if(seg_start >= to) break;
+
+        arc_gauge_segment_t seg = gauge->segments[i];
+        if(from > seg_start || to < seg_end) {
+            if(r_out == 0) get_indic_ring(obj, &r_out, &r_in);
+            sector_area(r_out, r_in, gauge->bg_start_angle + LV_MAX(from, seg_start),
+                        gauge->bg_start_angle + LV_MIN(to, seg_end), &seg);
+        }
+
+        lv_area_t area;
+        area.x1 = center.x + seg.x1;
+        area.y1 = center.y + seg.y1;
+        area.x2 = center.x + seg.x2;
+        area.y2 = center.y + seg.y2;
+        gauge->invalidated += lv_area_get_size(&area);
+        lv_obj_invalidate_area(obj, &area);
+    }
+}
+
+static void value_update(lv_obj_t * obj, int32_t old_angle)
+{
+    arc_gauge_t * gauge = (arc_gauge_t *)obj;
+    invalidate_delta(obj, old_angle, value_to_angle(gauge, gauge->value));
+}
@@ -0,0 +1,45 @@
+/**
+ * @file arc_gauge.h
+ */
+
+#ifndef ARC_GAUGE_H
+#define ARC_GAUGE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "arc_gauge_gen.h"
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * @param obj       pointer to an arc gauge
+ * @return          the value shown, clamped to the range
+ */
+int32_t arc_gauge_get_value(lv_obj_t * obj);
+
+/**
+ * Get and reset the pixels invalidated by value changes, to compare with a
+ * full redraw of the widget
+ * @param obj       pointer to an arc gauge
+ * @return          invalidated pixels since the last call
+ */
+uint32_t arc_gauge_take_invalidated(lv_obj_t * obj);
+
+#if LV_USE_XML
+void * arc_gauge_xml_create(lv_xml_parser_state_t * state, const char ** attrs);
+void arc_gauge_xml_apply(lv_xml_parser_state_t * state, const char ** attrs);
+#endif
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*ARC_GAUGE_H*/
@@ -0,0 +1,56 @@
+/**
+ * @file arc_gauge_gen.h
+ */
+
+#ifndef ARC_GAUGE_GEN_H
+#define ARC_GAUGE_GEN_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#ifdef LV_LVGL_H_INCLUDE_SIMPLE
+    #include "lvgl.h"
+#else
+    #include "lvgl/lvgl.h"
+#endif
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+lv_obj_t * arc_gauge_create(lv_obj_t * parent);
+
+void arc_gauge_set_min_value(lv_obj_t * obj, int32_t min_value);
+
+void arc_gauge_set_max_value(lv_obj_t * obj, int32_t max_value);
+
+void arc_gauge_set_value(lv_obj_t * obj, int32_t value);
+
+lv_observer_t * arc_gauge_bind_value(lv_obj_t * obj, lv_subject_t * subject);
+
+void arc_gauge_set_bg_start_angle(lv_obj_t * obj, int32_t angle);
+
+void arc_gauge_set_bg_end_angle(lv_obj_t * obj, int32_t angle);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*ARC_GAUGE_GEN_H*/
@@ -0,0 +1,61 @@
+/**
+ * @file arc_gauge_private_gen.h
+ */
+
+#ifndef ARC_GAUGE_PRIVATE_GEN_H
+#define ARC_GAUGE_PRIVATE_GEN_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "arc_gauge_gen.h"
+
+#ifdef LV_LVGL_H_INCLUDE_SIMPLE
+    #include "lvgl_private.h"
+#else
+    #include "lvgl/lvgl_private.h"
+#endif
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/*Degrees of ring per entry of the segment table*/
+#define ARC_GAUGE_SEGMENT_STEP 6
+
+#define ARC_GAUGE_SEGMENT_MAX (360 / ARC_GAUGE_SEGMENT_STEP)
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/*Bounding box of a segment of the indicator ring, relative to the center*/
+typedef struct {
+    int16_t x1;
+    int16_t y1;
+    int16_t x2;
+    int16_t y2;
+} arc_gauge_segment_t;
+
+typedef struct {
+    lv_obj_t obj;
+    int32_t min_value;
+    int32_t max_value;
+    int32_t value;
+    int16_t bg_start_angle;
+    int16_t bg_end_angle;
+    uint32_t invalidated;   /*Pixels invalidated by value changes*/
+    uint16_t segment_cnt;
+    arc_gauge_segment_t segments[ARC_GAUGE_SEGMENT_MAX];
+} arc_gauge_t;
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*ARC_GAUGE_PRIVATE_GEN_H*/
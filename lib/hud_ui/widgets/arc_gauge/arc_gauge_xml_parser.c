@@ -0,0 +1,65 @@
+/**
+ * @file arc_gauge_xml_parser.c
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "arc_gauge.h"
+
+#if LV_USE_XML
+
+#ifdef LV_LVGL_H_INCLUDE_SIMPLE
+    #include "lvgl_private.h"
+#else
+    #include "lvgl/lvgl_private.h"
+#endif
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void * arc_gauge_xml_create(lv_xml_parser_state_t * state, const char ** attrs)
+{
+    LV_UNUSED(attrs);
+    return arc_gauge_create(lv_xml_state_get_parent(state));
+}
+
+void arc_gauge_xml_apply(lv_xml_parser_state_t * state, const char ** attrs)
+{
+    void * item = lv_xml_state_get_item(state);
+
+    lv_xml_obj_apply(state, attrs); /*Apply the common properties, e.g. width, height, styles flags etc*/
+
+    for(int i = 0; attrs[i]; i += 2) {
+        const char * name = attrs[i];
+        const char * value = attrs[i + 1];
+
+        if(lv_streq("min_value", name)) {
+            arc_gauge_set_min_value(item, lv_xml_atoi(value));
+        }
+        else if(lv_streq("max_value", name)) {
+            arc_gauge_set_max_value(item, lv_xml_atoi(value));
+        }
+        else if(lv_streq("value", name)) {
+            arc_gauge_set_value(item, lv_xml_atoi(value));
+        }
+        else if(lv_streq("bind_value", name)) {
+            lv_subject_t * subject = lv_xml_get_subject(&state->scope, value);
+            if(subject == NULL) {
+                LV_LOG_WARN("Subject \"%s\" doesn't exist in arc_gauge bind_value", value);
+                continue;
+            }
+            arc_gauge_bind_value(item, subject);
+        }
+        else if(lv_streq("bg_start_angle", name)) {
+            arc_gauge_set_bg_start_angle(item, lv_xml_atoi(value));
+        }
+        else if(lv_streq("bg_end_angle", name)) {
+            arc_gauge_set_bg_end_angle(item, lv_xml_atoi(value));
+        }
+    }
+}
+
+#endif /*LV_USE_XML*/
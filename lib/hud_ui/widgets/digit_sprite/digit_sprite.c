@@ -0,0 +1,298 @@
+/**
+ * @file digit_sprite.c
+ *
+ * Like a label showing an integer, but the digits are blitted from RGB565
+ * sprites built on first use: the glyph's coverage blended once with the
+ * text color over black. Drawing a digit is then a plain image copy instead
+ * of decoding and blending a large 4 bpp glyph on every change. Only valid
+ * on an opaque black background, as the dashboard's `style_dark`.
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "digit_sprite_private_gen.h"
+#include "digit_sprite.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+#define MY_CLASS (&digit_sprite_class)
+
+#define DIGIT_SPRITE_TEXT_MAX 12
+
+/* Font and color pairs with their own sprites, e.g. normal and `style_stale` */
+#define DIGIT_SPRITE_SETS 4
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef struct {
+    const lv_font_t * font;
+    lv_color_t color;
+    lv_draw_buf_t * sprites[10];
+    lv_font_glyph_dsc_t glyphs[10];
+    bool failed[10];
+} sprite_set_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+static void digit_sprite_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj);
+static void digit_sprite_event(const lv_obj_class_t * class_p, lv_event_t * e);
+static void draw_main(lv_event_t * e);
+static void value_observer_cb(lv_observer_t * observer, lv_subject_t * subject);
+static lv_draw_buf_t * sprite_get(const lv_font_t * font, lv_color_t color, uint32_t digit,
+                                  lv_font_glyph_dsc_t * g);
+static sprite_set_t * set_get(const lv_font_t * font, lv_color_t color);
+static void cache_clear(void);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+const lv_obj_class_t digit_sprite_class = {
+    .base_class = &lv_obj_class,
+    .constructor_cb = digit_sprite_constructor,
+    .event_cb = digit_sprite_event,
+    .width_def = LV_SIZE_CONTENT,
+    .height_def = LV_SIZE_CONTENT,
+    .instance_size = sizeof(digit_sprite_t),
+    .name = "digit_sprite",
+};
+
+/* Sprites are never freed while drawing, draw tasks queued earlier in the frame may point to them */
+static sprite_set_t sets[DIGIT_SPRITE_SETS];
+static size_t cache_bytes;
+static size_t cache_limit = SIZE_MAX;
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+lv_obj_t * digit_sprite_create(lv_obj_t * parent)
+{
+    LV_LOG_INFO("begin");
+    lv_obj_t * obj = lv_obj_class_create_obj(MY_CLASS, parent);
+    lv_obj_class_init_obj(obj);
+    return obj;
+}
+
+void digit_sprite_set_value(lv_obj_t * obj, int32_t value)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    digit_sprite_t * ds = (digit_sprite_t *)obj;
+    if(ds->value == value) return;
+
+    lv_obj_invalidate(obj);
+    ds->value = value;
+    lv_obj_refresh_self_size(obj);
+    lv_obj_invalidate(obj);
+}
+
+lv_observer_t * digit_sprite_bind_value(lv_obj_t * obj, lv_subject_t * subject)
+{
+    LV_ASSERT_NULL(subject);
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    if(subject->type != LV_SUBJECT_TYPE_INT) {
+        LV_LOG_WARN("Incompatible subject type: %d", subject->type);
+        return NULL;
+    }
+    return lv_subject_add_observer_obj(subject, value_observer_cb, obj, NULL);
+}
+
+void digit_sprite_set_cache_limit(size_t bytes)
+{
+    cache_limit = bytes;
+    if(cache_bytes > cache_limit) cache_clear();
+}
+
+size_t digit_sprite_get_cache_size(void)
+{
+    return cache_bytes;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void digit_sprite_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
+{
+    LV_UNUSED(class_p);
+    digit_sprite_t * ds = (digit_sprite_t *)obj;
+    ds->value = 0;
+    lv_obj_remove_flag(obj, LV_OBJ_FLAG_CLICKABLE);
+    lv_obj_remove_flag(obj, LV_OBJ_FLAG_SCROLLABLE);
+}
+
+static void digit_sprite_event(const lv_obj_class_t * class_p, lv_event_t * e)
+{
+    LV_UNUSED(class_p);
+
+    lv_result_t res = lv_obj_event_base(MY_CLASS, e);
+    if(res != LV_RESULT_OK) return;
+
+    lv_event_code_t code = lv_event_get_code(e);
+    lv_obj_t * obj = lv_event_get_current_target(e);
+
+    if(code == LV_EVENT_GET_SELF_SIZE) {
+        digit_sprite_t * ds = (digit_sprite_t *)obj;
+        const lv_font_t * font = lv_obj_get_style_text_font(obj, LV_PART_MAIN);
+        char text[DIGIT_SPRITE_TEXT_MAX];
+        lv_snprintf(text, sizeof(text), "%" LV_PRId32, ds->value);
+
+        lv_point_t size;
+        lv_text_get_size(&size, text, font, lv_obj_get_style_text_letter_space(obj, LV_PART_MAIN), 0,
+                         LV_COORD_MAX, LV_TEXT_FLAG_NONE);
+        lv_point_t * p = lv_event_get_param(e);
+        p->x = LV_MAX(p->x, size.x);
+        p->y = LV_MAX(p->y, size.y);
+    }
+    else if(code == LV_EVENT_STYLE_CHANGED) {
+        lv_obj_refresh_self_size(obj);
+    }
+    else if(code == LV_EVENT_DRAW_MAIN) {
+        draw_main(e);
+    }
+}
+
+static void draw_main(lv_event_t * e)
+{
+    lv_obj_t * obj = lv_event_get_current_target(e);
+    digit_sprite_t * ds = (digit_sprite_t *)obj;
+    lv_layer_t * layer = lv_event_get_layer(e);
+
+    lv_draw_label_dsc_t label_dsc;
+    lv_draw_label_dsc_init(&label_dsc);
+    lv_obj_init_draw_label_dsc(obj, LV_PART_MAIN, &label_dsc);
+    if(label_dsc.opa <= LV_OPA_MIN) return;
+
+    char text[DIGIT_SPRITE_TEXT_MAX];
+    lv_snprintf(text, sizeof(text), "%" LV_PRId32, ds->value);
+
+    lv_area_t coords;
+    lv_obj_get_content_coords(obj, &coords);
+
+    const lv_font_t * font = label_dsc.font;
+    int32_t top = coords.y1 + lv_font_get_line_height(font) - font->base_line;
+
+    /* Build or look up all the sprites first, fall back to text for the whole number */
+    lv_draw_buf_t * sprites[DIGIT_SPRITE_TEXT_MAX];
+    lv_font_glyph_dsc_t glyphs[DIGIT_SPRITE_TEXT_MAX];
+    uint32_t n = 0;
+    for(; text[n]; n++) {
+        if(text[n] < '0' || text[n] > '9') break;
+        sprites[n] = sprite_get(font, label_dsc.color, text[n] - '0', &glyphs[n]);
+        if(sprites[n] == NULL) break;
+    }
+
+    if(text[n] != '\0') {
+        label_dsc.text = text;
+        label_dsc.text_local = 1;
+        lv_draw_label(layer, &label_dsc, &coords);
+        return;
+    }
+
+    lv_draw_image_dsc_t img_dsc;
+    lv_draw_image_dsc_init(&img_dsc);
+    img_dsc.opa = label_dsc.opa;
+
+    int32_t x = coords.x1;
+    for(uint32_t i = 0; i < n; i++) {
+        lv_font_glyph_dsc_t * g = &glyphs[i];
+        if(g->box_w && g->box_h) {
+            lv_area_t area;
+            area.x1 = x + g->ofs_x;
+            area.y1 = top - g->box_h - g->ofs_y;
+            area.x2 = area.x1 + g->box_w - 1;
+            area.y2 = area.y1 + g->box_h - 1;
+            img_dsc.src = sprites[i];
+            lv_draw_image(layer, &img_dsc, &area);
+        }
+        x += g->adv_w + label_dsc.letter_space;
+    }
+}
+
+static void value_observer_cb(lv_observer_t * observer, lv_subject_t * subject)
+{
+    digit_sprite_set_value(lv_observer_get_target_obj(observer), lv_subject_get_int(subject));
+}
+
+static void cache_clear(void)
+{
+    for(uint32_t s = 0; s < DIGIT_SPRITE_SETS; s++) {
+        for(uint32_t i = 0; i < 10; i++) {
+            if(sets[s].sprites[i]) lv_draw_buf_destroy(sets[s].sprites[i]);
+        }
+    }
+    lv_memzero(sets, sizeof(sets));
+    cache_bytes = 0;
+}
+
+/* The sprites of a font and color, NULL when all sets are taken by others */
+static sprite_set_t * set_get(const lv_font_t * font, lv_color_t color)
+{
+    for(uint32_t s = 0; s < DIGIT_SPRITE_SETS; s++) {
+        if(sets[s].font == NULL) {
+            sets[s].font = font;
+            sets[s].color = color;
+            return &sets[s];
+        }
+        if(sets[s].font == font && lv_color_eq(sets[s].color, color)) return &sets[s];
+    }
+    return NULL;
+}
+
+/* Coverage of the glyph blended with `color` over black, built once per digit */
+static lv_draw_buf_t * sprite_get(const lv_font_t * font, lv_color_t color, uint32_t digit,
+                                  lv_font_glyph_dsc_t * g)
+{
+    sprite_set_t * set = set_get(font, color);
+    if(set == NULL) return NULL;
+
+    if(set->sprites[digit]) {
+        *g = set->glyphs[digit];
+        return set->sprites[digit];
+    }
+    if(set->failed[digit]) return NULL;
+
+    if(!lv_font_get_glyph_dsc(font, g, '0' + digit, 0) || g->box_w == 0 || g->box_h == 0) {
+        set->failed[digit] = true;
+        return NULL;
+    }
+
+    uint32_t stride = lv_draw_buf_width_to_stride(g->box_w, LV_COLOR_FORMAT_RGB565);
+    size_t need = (size_t)stride * g->box_h;
+    if(cache_bytes + need > cache_limit) {
+        set->failed[digit] = true;
+        return NULL;
+    }
+
+    lv_draw_buf_t * mask = lv_draw_buf_create(g->box_w, g->box_h, LV_COLOR_FORMAT_A8, LV_STRIDE_AUTO);
+    lv_draw_buf_t * sprite = lv_draw_buf_create(g->box_w, g->box_h, LV_COLOR_FORMAT_RGB565, LV_STRIDE_AUTO);
+    g->req_raw_bitmap = 0;
+    if(mask == NULL || sprite == NULL || lv_font_get_glyph_bitmap(g, mask) == NULL) {
+        if(mask) lv_draw_buf_destroy(mask);
+        if(sprite) lv_draw_buf_destroy(sprite);
+        set->failed[digit] = true;
+        return NULL;
+    }
+
+    for(int32_t y = 0; y < g->box_h; y++) {
+        const uint8_t * src = mask->data + y * mask->header.stride;
+        uint16_t * dst = (uint16_t *)(sprite->data + y * sprite->header.stride);
+        for(int32_t x = 0; x < g->box_w; x++) {
+            dst[x] = lv_color_to_u16(lv_color_mix(color, lv_color_black(), src[x]));
+        }
+    }
+    lv_draw_buf_destroy(mask);
+
+    set->sprites[digit] = sprite;
+    set->glyphs[digit] = *g;
+    cache_bytes += need;
+    return sprite;
+}
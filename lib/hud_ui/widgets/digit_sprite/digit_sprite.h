@@ -0,0 +1,43 @@
+/**
+ * @file digit_sprite.h
+ */
+
+#ifndef DIGIT_SPRITE_H
+#define DIGIT_SPRITE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "digit_sprite_gen.h"
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Limit the memory the digit sprites may take, 0 to always draw text.
+ * Frees all sprites when over the new limit, so never call it while a frame is being drawn.
+ * @param bytes     sprite cache budget, shared by all digit sprite widgets
+ */
+void digit_sprite_set_cache_limit(size_t bytes);
+
+/**
+ * @return          bytes taken by the sprites built so far
+ */
+size_t digit_sprite_get_cache_size(void);
+
+#if LV_USE_XML
+void * digit_sprite_xml_create(lv_xml_parser_state_t * state, const char ** attrs);
+void digit_sprite_xml_apply(lv_xml_parser_state_t * state, const char ** attrs);
+#endif
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*DIGIT_SPRITE_H*/
@@ -0,0 +1,48 @@
+/**
+ * @file digit_sprite_gen.h
+ */
+
+#ifndef DIGIT_SPRITE_GEN_H
+#define DIGIT_SPRITE_GEN_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#ifdef LV_LVGL_H_INCLUDE_SIMPLE
+    #include "lvgl.h"
+#else
+    #include "lvgl/lvgl.h"
+#endif
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+lv_obj_t * digit_sprite_create(lv_obj_t * parent);
+
+void digit_sprite_set_value(lv_obj_t * obj, int32_t value);
+
+lv_observer_t * digit_sprite_bind_value(lv_obj_t * obj, lv_subject_t * subject);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*DIGIT_SPRITE_GEN_H*/
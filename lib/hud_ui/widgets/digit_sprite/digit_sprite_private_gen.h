@@ -0,0 +1,37 @@
+/**
+ * @file digit_sprite_private_gen.h
+ */
+
+#ifndef DIGIT_SPRITE_PRIVATE_GEN_H
+#define DIGIT_SPRITE_PRIVATE_GEN_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "digit_sprite_gen.h"
+
+#ifdef LV_LVGL_H_INCLUDE_SIMPLE
+    #include "lvgl_private.h"
+#else
+    #include "lvgl/lvgl_private.h"
+#endif
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef struct {
+    lv_obj_t obj;
+    int32_t value;
+} digit_sprite_t;
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*DIGIT_SPRITE_PRIVATE_GEN_H*/
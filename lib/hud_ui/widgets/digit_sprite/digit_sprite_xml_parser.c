@@ -0,0 +1,53 @@
+/**
+ * @file digit_sprite_xml_parser.c
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "digit_sprite.h"
+
+#if LV_USE_XML
+
+#ifdef LV_LVGL_H_INCLUDE_SIMPLE
+    #include "lvgl_private.h"
+#else
+    #include "lvgl/lvgl_private.h"
+#endif
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void * digit_sprite_xml_create(lv_xml_parser_state_t * state, const char ** attrs)
+{
+    LV_UNUSED(attrs);
+    return digit_sprite_create(lv_xml_state_get_parent(state));
+}
+
+void digit_sprite_xml_apply(lv_xml_parser_state_t * state, const char ** attrs)
+{
+    void * item = lv_xml_state_get_item(state);
+
+    lv_xml_obj_apply(state, attrs); /*Apply the common properties, e.g. width, height, styles flags etc*/
+
+    for(int i = 0; attrs[i]; i += 2) {
+        const char * name = attrs[i];
+        const char * value = attrs[i + 1];
+
+        if(lv_streq("value", name)) {
+            digit_sprite_set_value(item, lv_xml_atoi(value));
+        }
+        else if(lv_streq("bind_value", name)) {
+            lv_subject_t * subject = lv_xml_get_subject(&state->scope, value);
+            if(subject == NULL) {
+                LV_LOG_WARN("Subject \"%s\" doesn't exist in digit_sprite bind_value", value);
+                continue;
+            }
+            digit_sprite_bind_value(item, subject);
+        }
+    }
+}
+
+#endif /*LV_USE_XML*/
@@ -31,14 +31,56 @@
 */
 
 #include <Arduino.h>
+#include <esp_heap_caps.h>
 #include "main.h"
 #include <Preferences.h>
 #include "hud_ui.h"
+#include "fonts/glyph_cache.h"
 #include <NimBLEDevice.h>
 #include <Timber.h>
+#include "estimator.hpp"
+#include "derived.hpp"
+#include "fuel_filter.hpp"
+#include "trip.hpp"
+#include "store.hpp"
+#include "obd.hpp"
+#include "idle_policy.hpp"
+#include "power_mode.hpp"
+#include "draw_buffer.hpp"
+#include "metrics.hpp"
+#include "round_span.hpp"
+#include "pixel_transform.hpp"
+#ifdef RENDER_L8
+#include "l8_palette.hpp"
+#endif
+#ifndef NO_FRAME_DIFF
+#include "row_diff.hpp"
+#endif
+#if !defined(NO_RING_SPANS) || !defined(NO_GLYPH_UNIT) || !defined(NO_FRAME_PACING)
+#include "lvgl_private.h"
+#endif
+#ifndef NO_FRAME_PACING
+#include "frame_pacer.hpp"
+#include "esp_timer.h"
+#ifdef LCD_TE
+#include "driver/gpio.h"
+#endif
+#endif
+#ifndef NO_RING_SPANS
+#include "ring_unit.hpp"
+#endif
+#ifndef NO_GLYPH_UNIT
+#include "glyph_unit.hpp"
+#endif
 
+#if LV_USE_OS != LV_OS_NONE
+/* LVGL's own recursive lock, lv_timer_handler takes it as well */
+#define LVGL_LOCK() (lv_lock(), pdTRUE)
+#define LVGL_UNLOCK() lv_unlock()
+#else
 #define LVGL_LOCK() xSemaphoreTakeRecursive(lvgl_mutex, portMAX_DELAY)
 #define LVGL_UNLOCK() xSemaphoreGiveRecursive(lvgl_mutex)
+#endif
 
 // Locking LVGL calls to prevent concurrent access
 // This is important because LVGL is not thread-safe
@@ -58,31 +100,189 @@
 const uint8_t CMD_ATZ[] = {0x41, 0x54, 0x5A, 0x0D};               // Reset (ATZ)
 const uint8_t CMD_ATE0[] = {0x41, 0x54, 0x45, 0x30, 0x0D};        // Echo off (ATE0)
 const uint8_t CMD_ATSP6[] = {0x41, 0x54, 0x53, 0x50, 0x36, 0x0D}; // Set protocol to CAN 11/500 (ATSP6)
+const uint8_t CMD_ATLP[] = {0x41, 0x54, 0x4C, 0x50, 0x0D};        // Low power mode (ATLP)
+const uint8_t CMD_ATRV[] = {0x41, 0x54, 0x52, 0x56, 0x0D};        // Read battery voltage (ATRV)
+const uint8_t CMD_WAKE[] = {0x0D};                                // Wakes the adapter from ATLP, which drops it
 
-const uint8_t CMD_SPEED[] = {0x30, 0x31, 0x30, 0x44, 0x0D}; // Vehicle speed (010D)
-const uint8_t CMD_RPM[] = {0x30, 0x31, 0x30, 0x43, 0x0D};   // Engine RPM (010C)
-const uint8_t CMD_FUEL[] = {0x30, 0x31, 0x32, 0x46, 0x0D};  // Fuel Capacity (012F)
-const uint8_t CMD_TEMP[] = {0x30, 0x31, 0x30, 0x35, 0x0D};  // Coolant Temperature (0105)
+/* The trailing 1 is the number of answers to wait for, the prompt follows the first one */
+const uint8_t CMD_SPEED[] = {0x30, 0x31, 0x30, 0x44, 0x31, 0x0D}; // Vehicle speed (010D1)
+const uint8_t CMD_RPM[] = {0x30, 0x31, 0x30, 0x43, 0x31, 0x0D};   // Engine RPM (010C1)
+const uint8_t CMD_FUEL[] = {0x30, 0x31, 0x32, 0x46, 0x31, 0x0D};  // Fuel Capacity (012F1)
+const uint8_t CMD_TEMP[] = {0x30, 0x31, 0x30, 0x35, 0x31, 0x0D};  // Coolant Temperature (01051)
+const uint8_t CMD_MAF[] = {0x30, 0x31, 0x31, 0x30, 0x31, 0x0D};   // Mass Air Flow (01101)
 
 Preferences prefs;
 HWCDC USBSerial;
 
 /* ---------- LVGL DISPLAY ---------- */
-uint8_t lv_buffer[2][LV_BUFFER_SIZE];
+/*
+ * LV_BUFFER_SIZE is in pixels and only the smallest strip a board accepts,
+ * the buffers themselves are sized at boot (see drawBufferPlan). Build with
+ * -D DRAW_BUF_LINES=n to force a strip height, -D DRAW_BUF_NO_PSRAM to keep
+ * them in internal RAM, and compare the frame times in the log.
+ *
+ * -D RENDER_L8 has LVGL render luminance only, expanded to the HUD color at
+ * flush time through a palette into two small buffers of L8_EXPAND_LINES rows.
+ */
+#ifdef RENDER_L8
+#ifdef SW_ROTATION
+#error "RENDER_L8 expands rows as they are, build it without SW_ROTATION"
+#endif
+#ifndef L8_COLOR
+#define L8_COLOR 0xFFFF // RGB565 of full luminance
+#endif
+const uint8_t DRAW_BUF_BPP = 1;    // L8
+const uint32_t L8_EXPAND_LINES = 16; // rows expanded per transfer, even for the rounder
+static uint16_t *expand_buf[2]; // one expanded while the other is sent
+static uint16_t l8Lut[256];
+#else
+const uint8_t DRAW_BUF_BPP = 2;               // RGB565
+#endif
+const uint8_t PANEL_BPP = 2;                  // RGB565 on the bus
+const size_t DRAW_BUF_RESERVE = 96 * 1024;    // internal RAM left for BLE, LVGL objects and task stacks
+const size_t DIGIT_SPRITE_CACHE = 256 * 1024; // pre-blended speed digits, PSRAM boards only
+static uint8_t *lv_buffer[2];
+static DrawBufferPlan drawBuf;
+#ifdef SW_ROTATION
+static uint8_t *rotated_buf;
+#endif
+/* HUD mirroring in the flush on panels without a mirror bit, -D SW_FLIP forces it everywhere */
+#if !defined(DISPLAY_HW_FLIP) && !defined(SW_FLIP)
+#define SW_FLIP
+#endif
+#ifdef SW_FLIP
+static uint8_t swFlip; // XFORM_FLIP_X/Y, settings.hud as of the last frame
+#endif
+
+/* Render time per frame, flushes it took */
+struct FrameStats
+{
+  int64_t start;
+  uint32_t frames;
+  uint32_t flushes;
+  uint64_t total; // us
+  uint32_t max;   // us
+};
+static FrameStats frameStats;
+/* The overlay's text changed, and the frame drawing it is left out of perfMetrics */
+static bool perfOverlayDirty;
+static bool perfOverlayFrame;
+
+/* Transfers as seen from LVGL, rendering overlaps them unless it stalls */
+struct FlushStats
+{
+  int64_t started; // 0 when no transfer is outstanding
+  uint32_t transfers;
+  uint32_t stalls;   // transfers LVGL had to wait for
+  uint64_t inFlight; // us from start to handing the buffer back
+  uint64_t stalled;  // us spent waiting
+  uint64_t bytes;    // rendered
+  uint64_t sent;     // put on the bus
+  uint64_t diffTime; // us spent hashing rows
+  uint64_t xformTime; // us spent rotating and mirroring
+  uint64_t expandTime; // us spent expanding L8 through the palette
+};
+static FlushStats flushStats;
+
+/* Windows actually sent for a strip, one per row pair at most */
+static SpanRun spanRuns[SCREEN_HEIGHT / 2];
+#ifdef ROUND_DISPLAY
+static CircleSpans<SCREEN_WIDTH, SCREEN_HEIGHT> circle;
+#endif
+#ifndef NO_FRAME_DIFF
+/* Build with -D NO_FRAME_DIFF to always send whole strips */
+static RowDiff<SCREEN_WIDTH, SCREEN_HEIGHT> rowDiff;
+static SpanRun diffRuns[SCREEN_HEIGHT / 2];
+#endif
+
+static void reportFrames()
+{
+  FrameStats &f = frameStats;
+  uint32_t frames = f.frames;
+  if (f.frames)
+  {
+    Timber.i("Frames: %u, avg %.1f ms, max %.1f ms, %.1f flushes/frame (%u lines, %s)", f.frames,
+             f.total / 1000.0f / f.frames, f.max / 1000.0f, (float)f.flushes / f.frames,
+             drawBuf.lines, drawBuf.memory == DRAW_BUF_PSRAM ? "PSRAM" : "internal");
+  }
+  f.frames = 0;
+  f.flushes = 0;
+  f.total = 0;
+  f.max = 0;
+
+  FlushStats &t = flushStats;
+  if (t.transfers)
+  {
+    /* inFlight is an upper bound when the transfer was already done */
+    Timber.i("Flush: %u transfers, %u stalled (%.1f ms), overlap %.0f %%", t.transfers, t.stalls,
+             t.stalled / 1000.0f, t.inFlight ? 100.0f * (t.inFlight - t.stalled) / t.inFlight : 0);
+  }
+  if (frames)
+  {
+    Timber.i("Flush: %.1f KB/frame sent, %.1f KB/frame rendered", t.sent / 1024.0f / frames,
+             t.bytes / 1024.0f / frames);
+  }
+#ifndef NO_FRAME_DIFF
+  uint32_t seen, kept;
+  rowDiff.takeStats(seen, kept);
+  Timber.i("Row diff: %s, %.0f %% of pixels unchanged, %.1f ms hashing",
+           rowDiff.active() ? "on" : "paused", seen ? 100.0f * (seen - kept) / seen : 0,
+           t.diffTime / 1000.0f);
+  t.diffTime = 0;
+#endif
+#ifdef RENDER_L8
+  Timber.i("Palette: %.1f ms expanding L8", t.expandTime / 1000.0f);
+  t.expandTime = 0;
+#elif defined(SW_ROTATION) || defined(SW_FLIP)
+  if (t.xformTime)
+    Timber.i("Transform: %.1f ms rotating and mirroring", t.xformTime / 1000.0f);
+  t.xformTime = 0;
+#endif
+  t.transfers = 0;
+  t.stalls = 0;
+  t.inFlight = 0;
+  t.stalled = 0;
+  t.bytes = 0;
+  t.sent = 0;
+}
+
 lv_obj_t *boot_screen;
 lv_obj_t *dashboard_screen;
 lv_obj_t *settings_screen;
+lv_obj_t *trip_screen;
+#if LV_USE_OS == LV_OS_NONE
 SemaphoreHandle_t lvgl_mutex;
-
-bool should_restart = false;
-
-static uint32_t lastFast = 0;   // rpm
-static uint32_t lastMedium = 0; // speed
-static uint32_t lastSlow = 0;   // fuel, temp
+#endif
+static lv_indev_t *touch_indev;
+static lv_timer_t *frame_timer;
+static bool touch_pressed = false;
+static bool power_sleep = false; // engine off, display dimmed and frozen
+
+/* Boards with a touch interrupt read the touch on demand instead of every 33 ms */
+#if defined(TOUCH_IRQ)
+#define TOUCH_WAKE_PIN TOUCH_IRQ
+#elif defined(TP_INT)
+#define TOUCH_WAKE_PIN TP_INT
+#endif
 
 const uint32_t FAST_INTERVAL = 100;    // 0.1 seconds
+#ifndef FRAME_RATE
+#define FRAME_RATE 60 // fps, boards with bigger frames set less in pins.h
+#endif
+const uint32_t FRAME_INTERVAL = 1000 / FRAME_RATE; // gauge updates, once per frame
 const uint32_t MEDIUM_INTERVAL = 1000; // 1 second
 const uint32_t SLOW_INTERVAL = 10000;  // 10 seconds
+const uint32_t OBD_TIMEOUT = 1000;     // give up on an unanswered request
+const uint8_t STALE_PERIODS = 3;       // a value is stale after missing this many polls
+
+const uint32_t ENGINE_OFF_DELAY = 60000;  // RPM and speed at 0 (or no charging) this long means parked
+const float CHARGE_VOLTS = 13.0f;         // below this the alternator is not charging
+const uint32_t HEARTBEAT_INTERVAL = 5000; // engine off: poll RPM and voltage this often
+const uint8_t POWER_DIM_BRIGHTNESS = 10;  // engine off backlight
+
+const uint32_t TRIP_SAVE_INTERVAL = 5 * 60 * 1000; // trip totals: at most one NVS write every 5 minutes
+const uint32_t SETTINGS_SAVE_DELAY = 3000;         // settings: on slider release or 3 s after a change
+const uint32_t STORE_POLL_INTERVAL = 1000;         // how often the store task checks for due writes
 
 /* OBD UUIDs (16-bit, vendor specific) */
 static NimBLEUUID OBD_SERVICE_UUID("FFF0");
@@ -93,6 +293,122 @@ static NimBLEClient *client = nullptr;
 static NimBLERemoteCharacteristic *obdChar = nullptr;
 static NimBLEScan *scan = nullptr;
 
+/* Polled PIDs, one request in flight at a time. target is the stale subject */
+static ObdPid obdPids[] = {
+    {0x0C, CMD_RPM, sizeof(CMD_RPM), FAST_INTERVAL, &rpm_stale, true},
+    {0x0D, CMD_SPEED, sizeof(CMD_SPEED), MEDIUM_INTERVAL, &speed_stale, false},
+    {0x10, CMD_MAF, sizeof(CMD_MAF), MEDIUM_INTERVAL, nullptr, false},
+    {0x2F, CMD_FUEL, sizeof(CMD_FUEL), MEDIUM_INTERVAL, &fuel_stale, false},
+    {0x05, CMD_TEMP, sizeof(CMD_TEMP), SLOW_INTERVAL, &temp_stale, false},
+    {OBD_PID_VOLTAGE, CMD_ATRV, sizeof(CMD_ATRV), SLOW_INTERVAL, nullptr, true},
+};
+static ObdScheduler<sizeof(obdPids) / sizeof(obdPids[0])> obdScheduler(obdPids, OBD_TIMEOUT, STALE_PERIODS);
+static AdapterSleep<sizeof(obdPids) / sizeof(obdPids[0])> adapterSleep(obdScheduler, HEARTBEAT_INTERVAL, OBD_TIMEOUT);
+
+/* Counters behind the overlay and the serial "perf" command */
+static PerfMetrics<sizeof(obdPids) / sizeof(obdPids[0])> perfMetrics;
+
+/* RPM tracker, published to engine_rpm at frame rate */
+static SignalEstimator rpmEstimator(2 * FAST_INTERVAL, 0, 8000); // a poll late RPM still glides
+
+/* Values computed from the decoded PIDs, never polled themselves */
+static DerivedNode derivedNodes[] = {
+    {SIG_BIT(SIG_RPM) | SIG_BIT(SIG_SPEED), derived_gear, &gear},
+    {SIG_BIT(SIG_MAF) | SIG_BIT(SIG_SPEED), derived_economy, &fuel_economy},
+    {SIG_BIT(SIG_SPEED), derived_acceleration, &acceleration},
+};
+static DerivedEngine<sizeof(derivedNodes) / sizeof(derivedNodes[0])> derived(derivedNodes);
+
+/* Fuel level: median of the last 15 samples followed by a slow EMA */
+static FuelFilter<15> fuelFilter(0.05f);
+
+/* Trip A/B and lifetime totals */
+static TripComputer trips(AFR_PETROL, PETROL_DENSITY);
+
+/* Persisted settings, mirrored from the settings_* subjects */
+static struct
+{
+  int32_t brightness = 128;
+  int32_t hud = 0;
+  int32_t restart = 0;
+  int32_t tank = 50; // litres
+} settings;
+
+/* Hardware changes requested by the settings, applied once per frame */
+#define HW_BRIGHTNESS (1 << 0)
+#define HW_FLIP (1 << 1)
+static uint8_t hwPending = 0;
+
+/* ---------- PERSISTENCE ---------- */
+/* Everything saved to NVS goes through the store, written by storeTask */
+static CoalescedStore<Preferences> store(prefs);
+static SemaphoreHandle_t store_mutex;  // guards the store's shadow copies, held briefly
+static SemaphoreHandle_t commit_mutex; // serialises NVS commits
+static TaskHandle_t storeTaskHandle = nullptr;
+
+static int8_t tripSlot = -1;
+static int8_t brightnessSlot = -1;
+static int8_t hudSlot = -1;
+static int8_t restartSlot = -1;
+static int8_t tankSlot = -1;
+
+/* Snapshot a changed value, the write happens later */
+static void storeTouch(int8_t slot)
+{
+  xSemaphoreTake(store_mutex, portMAX_DELAY);
+  store.touch(slot, millis());
+  xSemaphoreGive(store_mutex);
+}
+
+/* Write whatever is due (or everything dirty when forced) */
+static void storeCommit(bool force)
+{
+  CoalescedStore<Preferences>::Stage stage;
+
+  xSemaphoreTake(commit_mutex, portMAX_DELAY);
+  xSemaphoreTake(store_mutex, portMAX_DELAY);
+  bool due = store.collect(millis(), force, stage);
+  xSemaphoreGive(store_mutex);
+
+  if (due)
+  {
+    store.commit(stage);
+  }
+  xSemaphoreGive(commit_mutex);
+}
+
+/* Trips saved as floats under the old key, written under the new one; the old key is left alone */
+static void loadFloatTrips()
+{
+  TripTotalsFloat old[TRIP_COUNT];
+  if (prefs.getBytesLength("trips") != sizeof(old) ||
+      prefs.getBytes("trips", old, sizeof(old)) != sizeof(old))
+    return;
+  trips.restore(old);
+  trips.consumeChanged();
+  storeTouch(tripSlot);
+}
+
+/* Ask the store task to write all pending values now */
+static void storeRequestFlush()
+{
+  if (storeTaskHandle)
+    xTaskNotifyGive(storeTaskHandle);
+}
+
+static void perfSerial();
+
+/* Background writer, keeps flash writes out of the UI and BLE paths */
+static void storeTask(void *param)
+{
+  for (;;)
+  {
+    bool force = ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(STORE_POLL_INTERVAL)) > 0;
+    storeCommit(force);
+    perfSerial(); // serial commands ride on this poll, the UI task sleeps on
+  }
+}
+
 /* ---------- HEX UTILS ---------- */
 static uint8_t hexToByte(uint8_t hi, uint8_t lo)
 {
@@ -139,66 +455,179 @@ String formatHexString(
   return out;
 }
 
-/* ---------- SIMPLE PARSER ---------- */
-void parseObd(const uint8_t *data, size_t len)
+/* Push a changed derived value to its subject */
+static void publishDerived(const DerivedNode &node)
 {
-  if (len < 8)
-    return;
+  lv_subject_set_int((lv_subject_t *)node.target, node.value);
+}
+
+/* Format one trip line into its subject, only notifying on a visible change */
+static void publishTrip(Trip id, lv_subject_t *subject)
+{
+  const TripTotals &t = trips.get(id);
+  char buf[48];
+  if (id == TRIP_TOTAL)
+    snprintf(buf, sizeof(buf), "%.0f km  %.0f L", t.distance, t.fuel);
+  else
+    snprintf(buf, sizeof(buf), "%.1f km  %.1f L  %.1f L/100km", t.distance, t.fuel, trips.economy(id));
 
-  if (data[4] == 'E' && data[5] == 'R' && data[6] == 'R' && data[7] == 'O')
+  if (strcmp(buf, lv_subject_get_string(subject)) != 0)
   {
-    LVGL_EXEC(lv_subject_set_int(&can_error, 1));
-    return;
+    lv_subject_copy_string(subject, buf);
   }
-  // Must start with ASCII "41"
-  if (data[0] != '4' || data[1] != '1')
+}
+
+static void publishTrips()
+{
+  if (!trips.consumeChanged())
     return;
 
-  uint8_t pid = hexToByte(data[3], data[4]);
+  storeTouch(tripSlot);
+  publishTrip(TRIP_A, &trip_a);
+  publishTrip(TRIP_B, &trip_b);
+  publishTrip(TRIP_TOTAL, &trip_total);
+}
 
-  switch (pid)
-  {
-  case 0x0D: // Speed
-  {
-    uint8_t A = hexToByte(data[6], data[7]);
-    Timber.i("Speed: %u km/h\n", A);
-    LVGL_EXEC(lv_subject_set_int(&speed, (int)A));
-    break;
-  }
+/* ---------- TASKS ---------- */
+/*
+ * The OBD task (core 0, next to the BLE stack) owns the adapter: connecting,
+ * init, polling and decoding. The UI task (core 1) owns LVGL and everything
+ * fed by samples. They only talk through queues, so a slow connect or a
+ * stalled adapter never holds up a frame.
+ */
+#if CONFIG_FREERTOS_UNICORE
+#define OBD_CORE 0
+#define UI_CORE 0
+#else
+#define OBD_CORE 0
+#define UI_CORE 1
+#endif
 
-  case 0x0C: // RPM
-  {
-    uint8_t A = hexToByte(data[6], data[7]);
-    uint8_t B = hexToByte(data[9], data[10]);
-    float rpm = ((A << 8) | B) / 4.0f;
-    Timber.i("RPM: %.0f\n", rpm);
-    LVGL_EXEC(lv_subject_set_int(&engine_rpm, (int)rpm));
-    break;
-  }
+const uint32_t UI_MIN_WAIT = 1;      // shortest UI sleep in ms
+const uint32_t UI_MAX_WAIT = 1000;   // UI sleep when no LVGL timer is pending
+const uint32_t TOUCH_POLL = 20;      // touch polling while pressed, the release has no interrupt
+const uint32_t OBD_MAX_WAIT = 100;   // upper bound on the OBD task sleep, for stale checks
+const uint32_t OBD_SETTLE = 500;     // after connecting, before ATZ
+const uint32_t OBD_INIT_WAIT = 1500; // per init command if the prompt never shows
 
-  case 0x2F: // Fuel
+/* Events for the OBD task, sent with xTaskNotify */
+#define OBD_EVT_FOUND (1 << 0)
+#define OBD_EVT_DISCONNECTED (1 << 1)
+#define OBD_EVT_RX (1 << 2)
+
+/* Raw notification from the adapter, BLE task -> OBD task */
+struct ObdResponse
+{
+  uint32_t t;
+  uint8_t len;
+  uint8_t data[64];
+};
+
+enum UiMsgType : uint8_t
+{
+  UI_SAMPLE,    // id = PID, value = decoded value
+  UI_STALE,     // target = stale subject, value = 0/1
+  UI_CAN_ERROR, // value = 0/1
+  UI_CON_ERROR, // value = 0/1
+  UI_POWER,     // value = PowerState
+};
+
+/* OBD task -> UI task */
+struct UiMsg
+{
+  UiMsgType type;
+  uint8_t id;
+  float value;
+  uint32_t t;
+  void *target;
+};
+
+/* Busy time between reports, in us */
+struct TaskLoad
+{
+  TaskHandle_t handle;
+  const char *name;
+  uint64_t busy;
+};
+
+static QueueHandle_t rxQueue;
+static QueueHandle_t uiQueue;
+static TaskLoad obdLoad = {nullptr, "obd", 0};
+static TaskLoad uiLoad = {nullptr, "ui", 0};
+static uint32_t uiDropped = 0;
+
+/* UI task sleep policy and duty cycle */
+static IdlePolicy uiIdle(UI_MIN_WAIT, UI_MAX_WAIT, TOUCH_POLL);
+
+static void uiSend(UiMsgType type, uint8_t id, float value, uint32_t t, void *target = nullptr)
+{
+  UiMsg msg = {type, id, value, t, target};
+  if (xQueueSend(uiQueue, &msg, 0) != pdTRUE)
   {
-    uint8_t A = hexToByte(data[6], data[7]);
-    float fuel = (A * 100.0f) / 255.0f;
-    Timber.i("Fuel: %.1f %%\n", fuel);
-    int litres = fuel * 50 / 100; // Assuming 50L tank
-    LVGL_EXEC(lv_subject_set_int(&fuel_capacity, litres));
-    break;
+    uiDropped++;
+    return;
   }
-  case 0x05: // Coolant temp
+  if (uiLoad.handle)
+    xTaskNotify(uiLoad.handle, IDLE_EVT_SAMPLE, eSetBits);
+}
+
+/* ---------- BOOT ---------- */
+const uint32_t BOOT_MAX_WAIT = 1500; // longest the logo stays up without data
+
+static lv_timer_t *boot_timer = nullptr;
+static bool screen_loading = false; // ignore navigation until the fade is done, see SCREENS
+
+/* Log a boot phase with the time since reset */
+static void bootMark(const char *phase)
+{
+  Timber.i("Boot +%u ms: %s", millis(), phase);
+}
+
+static void bootMarkOnce(bool &done, const char *phase)
+{
+  if (done)
+    return;
+  done = true;
+  bootMark(phase);
+}
+
+/* Leave the boot screen for the dashboard, once. Call with LVGL locked */
+static void bootHandover(const char *reason)
+{
+  if (boot_timer)
   {
-    uint8_t A = hexToByte(data[6], data[7]);
-    float temp = A - 40.0f;
-    Timber.i("Coolant: %.1f C\n", temp);
-    LVGL_EXEC(lv_subject_set_int(&coolant_temp, (int)temp));
-    break;
+    lv_timer_delete(boot_timer);
+    boot_timer = nullptr;
   }
-  }
-  LVGL_EXEC(lv_subject_set_int(&can_error, 0));
+  if (!boot_screen || lv_screen_active() != boot_screen)
+    return;
+
+  bootMark(reason);
+  screen_loading = true; // cleared by the dashboard's LV_EVENT_SCREEN_LOADED, like screenShow()
+  lv_screen_load_anim(dashboard_screen, LV_SCREEN_LOAD_ANIM_FADE_IN, 500, 0, false);
+}
+
+static void boot_timeout_cb(lv_timer_t *timer)
+{
+  boot_timer = nullptr; // single shot, deletes itself
+  bootHandover("no data yet, showing dashboard");
+}
+
+/* Time to the first frame and the first dashboard frame */
+static void on_refr_ready(lv_event_t *e)
+{
+  static bool first = false;
+  static bool dashboard = false;
+  bootMarkOnce(first, "first frame");
+  if (lv_screen_active() == dashboard_screen)
+    bootMarkOnce(dashboard, "first dashboard frame");
 }
 
 void deep_sleep_restart()
 {
+  /* Don't lose anything changed since the last save */
+  storeCommit(true);
+
   /* Here we use deep sleep so we can detect the wakeup source to skip boot logo during startup */
   esp_sleep_enable_timer_wakeup(1000);
   esp_deep_sleep_start();
@@ -214,26 +643,11 @@ class ClientCallbacks : public NimBLEClientCallbacks
   void onDisconnect(NimBLEClient *pClient, int reason) override
   {
     Timber.v("Disconnected");
-    LVGL_EXEC(lv_subject_set_int(&con_error, 1));
     obdChar = nullptr;
 
-    if (should_restart)
-    {
-      /* Restart on disconnect if enabled */
-      deep_sleep_restart();
-    }
-
-    if (client)
-    {
-      NimBLEDevice::deleteClient(client);
-      client = nullptr;
-    }
-
-    if (scan)
-    {
-      scan->clearResults();
-      scan->start(0, false);
-    }
+    /* Cleanup and rescanning happen in the OBD task */
+    if (obdLoad.handle)
+      xTaskNotify(obdLoad.handle, OBD_EVT_DISCONNECTED, eSetBits);
   }
 } clientCallbacks;
 
@@ -244,7 +658,13 @@ void notifyCB(NimBLERemoteCharacteristic *pRemoteCharacteristic, uint8_t *data,
   if (isNotify)
   {
     Timber.v(formatHexString(data, len, false));
-    parseObd(data, len);
+
+    ObdResponse rx;
+    rx.t = millis();
+    rx.len = len < sizeof(rx.data) ? len : sizeof(rx.data);
+    memcpy(rx.data, data, rx.len);
+    if (xQueueSend(rxQueue, &rx, 0) == pdTRUE && obdLoad.handle)
+      xTaskNotify(obdLoad.handle, OBD_EVT_RX, eSetBits);
   }
 }
 
@@ -257,8 +677,12 @@ class ScanCB : public NimBLEScanCallbacks
         dev->isAdvertisingService(OBD_SERVICE_UUID))
     {
       Timber.v("OBD Adapter found");
+      static bool found = false;
+      bootMarkOnce(found, "adapter found");
       obdDevice = dev;
       NimBLEDevice::getScan()->stop();
+      if (obdLoad.handle)
+        xTaskNotify(obdLoad.handle, OBD_EVT_FOUND, eSetBits);
     }
   }
 };
@@ -295,113 +719,1317 @@ bool connectObd()
   }
 
   Timber.v("Connected to OBD");
-  LVGL_EXEC(lv_subject_set_int(&con_error, 0));
   return true;
 }
 
+/* Drop the client and go back to scanning */
+static void disconnectObd()
+{
+  obdChar = nullptr;
+  obdDevice = nullptr;
+
+  if (client)
+  {
+    NimBLEDevice::deleteClient(client);
+    client = nullptr;
+  }
+
+  if (scan)
+  {
+    scan->clearResults();
+    scan->start(0, false);
+  }
+}
+
 /* ---------- WRITE ---------- */
+static ObdAssembler<128> obdRx; // notifications of the response in progress
+
 void obdWrite(const uint8_t *cmd, size_t len)
 {
+  obdRx.clear(); // whatever came without a prompt is not this command's answer
   if (obdChar && obdChar->canWrite())
     obdChar->writeValue(cmd, len, false);
 }
 
-/* ---------- LVGL DISPLAY & TOUCH DRIVER ---------- */
-/*Convert rotation number to lvgl rotation type*/
-lv_display_rotation_t get_rotation(uint8_t rotation)
-{
-  if (rotation > 3)
-    return LV_DISPLAY_ROTATION_0;
-  return (lv_display_rotation_t)rotation;
-}
-
-/* Display flushing */
-void my_disp_flush(lv_display_t *display, const lv_area_t *area, unsigned char *data)
+/* ---------- PARSER ---------- */
+/**
+ * Decode a mode 01 answer ("41 PP AA BB")
+ *
+ * @param value  Decoded value, the raw byte for the fuel level
+ * @return       True if the PID is known and the answer long enough
+ */
+static bool decodeObd(uint8_t pid, const uint8_t *data, size_t len, float &value)
 {
+  switch (pid)
+  {
+  case 0x0D: // Speed
+  {
+    if (len < 8)
+      return false;
+    uint8_t A = hexToByte(data[6], data[7]);
+    Timber.i("Speed: %u km/h\n", A);
+    value = A;
+    return true;
+  }
 
-  uint32_t w = lv_area_get_width(area);
-  uint32_t h = lv_area_get_height(area);
+  case 0x0C: // RPM
+  {
+    if (len < 11)
+      return false;
+    uint8_t A = hexToByte(data[6], data[7]);
+    uint8_t B = hexToByte(data[9], data[10]);
+    value = ((A << 8) | B) / 4.0f;
+    Timber.i("RPM: %.0f\n", value);
+    return true;
+  }
 
-#ifdef SW_ROTATION
-  lv_display_rotation_t rotation = lv_display_get_rotation(display);
-  lv_area_t rotated_area;
-  if (rotation != LV_DISPLAY_ROTATION_0)
-  {
-    lv_color_format_t cf = lv_display_get_color_format(display);
-    /*Calculate the position of the rotated area*/
-    rotated_area = *area;
-    lv_display_rotate_area(display, &rotated_area);
-    /*Calculate the source stride (bytes in a line) from the width of the area*/
-    uint32_t src_stride = lv_draw_buf_width_to_stride(lv_area_get_width(area), cf);
-    /*Calculate the stride of the destination (rotated) area too*/
-    uint32_t dest_stride = lv_draw_buf_width_to_stride(lv_area_get_width(&rotated_area), cf);
-    /*Have a buffer to store the rotated area and perform the rotation*/
-    static uint8_t rotated_buf[LV_BUFFER_SIZE];
-    lv_draw_sw_rotate(data, rotated_buf, w, h, src_stride, dest_stride, rotation, cf);
-    /*Use the rotated area and rotated buffer from now on*/
-    area = &rotated_area;
-    data = rotated_buf;
+  case 0x2F: // Fuel
+  {
+    if (len < 8)
+      return false;
+    value = hexToByte(data[6], data[7]);
+    return true;
   }
-#endif
 
-  if (tft.getStartCount() == 0)
+  case 0x10: // MAF
   {
-    tft.endWrite();
+    if (len < 11)
+      return false;
+    uint8_t A = hexToByte(data[6], data[7]);
+    uint8_t B = hexToByte(data[9], data[10]);
+    value = ((A << 8) | B) / 100.0f;
+    Timber.i("MAF: %.2f g/s\n", value);
+    return true;
   }
 
-  tft.pushImageDMA(area->x1, area->y1, area->x2 - area->x1 + 1, area->y2 - area->y1 + 1, (uint16_t *)data);
-  lv_display_flush_ready(display); /* tell lvgl that flushing is done */
+  case 0x05: // Coolant temp
+  {
+    if (len < 8)
+      return false;
+    value = hexToByte(data[6], data[7]) - 40.0f;
+    Timber.i("Coolant: %.1f C\n", value);
+    return true;
+  }
+  }
+  return false;
 }
 
-/* Rounder event callback to align area to 2x2 pixels */
-void rounder_event_cb(lv_event_t *e)
+/* ---------- OBD TASK ---------- */
+enum LinkState : uint8_t
 {
-  lv_area_t *area = lv_event_get_invalidated_area(e);
-  uint16_t x1 = area->x1;
-  uint16_t x2 = area->x2;
+  LINK_SCANNING,
+  LINK_INIT,
+  LINK_POLLING,
+};
 
-  uint16_t y1 = area->y1;
-  uint16_t y2 = area->y2;
+/* Sent in order after connecting, each waits for the prompt */
+static const struct
+{
+  const uint8_t *cmd;
+  size_t len;
+} OBD_INIT[] = {
+    {CMD_ATZ, sizeof(CMD_ATZ)},
+    {CMD_ATE0, sizeof(CMD_ATE0)},
+    {CMD_ATSP6, sizeof(CMD_ATSP6)},
+};
 
-  // round the start of coordinate down to the nearest 2M number
-  area->x1 = (x1 >> 1) << 1;
-  area->y1 = (y1 >> 1) << 1;
-  // round the end of coordinate up to the nearest 2N+1 number
-  area->x2 = ((x2 >> 1) << 1) + 1;
-  area->y2 = ((y2 >> 1) << 1) + 1;
-}
+static struct
+{
+  LinkState state = LINK_SCANNING;
+  uint8_t step = 0;      // next OBD_INIT command
+  uint32_t deadline = 0; // when LINK_INIT moves on without a prompt
+  int8_t canError = -1;  // last value sent to the UI
+} obdLink;
 
-/*Read the touchpad*/
-void my_touchpad_read(lv_indev_t *indev_driver, lv_indev_data_t *data)
+/* Engine-off detection, runs on the OBD samples */
+static PowerMode power(ENGINE_OFF_DELAY, CHARGE_VOLTS);
+
+static void setCanError(bool error, uint32_t t)
 {
-  uint16_t touchX, touchY;
-  bool touched = tft.getTouch(&touchX, &touchY);
+  if (obdLink.canError == error)
+    return;
+  obdLink.canError = error;
+  uiSend(UI_CAN_ERROR, 0, error, t);
+}
 
-  if (!touched)
-  {
-    data->state = LV_INDEV_STATE_RELEASED;
-  }
-  else
+/* Tell the UI about stale flags that changed */
+static void checkStale(uint32_t now)
+{
+  for (size_t i = 0; i < obdScheduler.size(); i++)
   {
-    data->state = LV_INDEV_STATE_PRESSED;
-    /*Set the coordinates*/
-    data->point.x = touchX;
-    data->point.y = touchY;
+    ObdPid *p = obdScheduler.get(i);
+    if (obdScheduler.updateStale(*p, now) && p->target)
+    {
+      uiSend(UI_STALE, p->pid, p->stale, now, p->target);
+    }
   }
 }
 
-/*Tick function*/
-static uint32_t my_tick(void)
+/* A whole response, up to and including the prompt, `t` is when the prompt came */
+static void handleResponse(const uint8_t *rx, size_t rxLen, uint32_t t)
 {
-  return millis();
-}
+  if (obdLink.state == LINK_INIT)
+  {
+    /* The prompt means the adapter is ready for the next command */
+    obdLink.deadline = t;
+    return;
+  }
+  if (adapterSleep.onPrompt())
+    return; // the adapter woke up for a heartbeat
 
-// void on_rotation_change(lv_observer_t *observer, lv_subject_t *subject)
-// {
-//   int32_t rotation = lv_subject_get_int(subject);
+  size_t offset = 0;
+  ObdStatus status = obdClassify(rx, rxLen, &offset);
+  const uint8_t *data = rx + offset;
+  size_t len = rxLen - offset;
 
-// #ifdef SW_ROTATION
-//   lv_display_set_rotation(lv_display_get_default(), get_rotation(rotation));
+  uint8_t pid = 0;
+  float value = 0;
+  bool valid = false;
+
+  if (status == OBD_OK)
+  {
+    if (len >= 5)
+    {
+      pid = hexToByte(data[3], data[4]);
+      valid = decodeObd(pid, data, len, value);
+    }
+  }
+  else if (status == OBD_VOLTAGE)
+  {
+    pid = OBD_PID_VOLTAGE;
+    valid = obdParseVoltage(data, len, &value);
+    if (valid)
+      Timber.i("Battery: %.1f V\n", value);
+  }
+  else if (status != OBD_PROMPT && status != OBD_OTHER)
+  {
+    Timber.w("OBD: %s", obdStatusName(status));
+  }
+
+  /* A garbled answer counts as a failure of the PID in flight */
+  ObdPid *answered = obdScheduler.onResponse(valid ? OBD_OK : status, valid ? pid : 0, t);
+  if (answered)
+    perfMetrics.answer(t - answered->lastRequest);
+  obdScheduler.onPrompt();
+
+#ifdef TRACE_SAMPLES
+  if (valid)
+    Timber.i("trace,%u,%02x,%.2f\n", t, pid, value); // replayed by tools/*_bench.cpp
+#endif
+
+  if (valid && pid == OBD_PID_VOLTAGE)
+  {
+    power.voltage(value, t);
+  }
+  else if (valid)
+  {
+    /* Only a real answer proves the bus is fine */
+    uiSend(UI_SAMPLE, pid, value, t);
+    setCanError(false, t);
+
+    if (pid == 0x0C)
+      power.rpm(value, t);
+    else if (pid == 0x0D)
+      power.speed(value, t);
+  }
+  else if (obdBusError(status))
+  {
+    setCanError(true, t);
+  }
+}
+
+/* Engine-off / engine-start transitions */
+static void updatePower(uint32_t now)
+{
+  if (!power.update(now))
+    return;
+
+  if (power.sleeping())
+    Timber.i("Engine off, going to low power");
+  else
+    Timber.i("Engine on, resuming");
+  adapterSleep.setSleeping(power.sleeping());
+  uiSend(UI_POWER, 0, power.state(), now);
+}
+
+/**
+ * Connect, init and poll the adapter
+ *
+ * Sleeps on its notification until BLE has something for it or the next
+ * request, init step or stale check is due.
+ */
+static void obdTask(void *param)
+{
+  uint32_t wait = OBD_MAX_WAIT;
+  uint32_t lastStats = 0;
+  bool connected = false;
+
+  /* BLE comes up here, so the scan runs while setup() builds the UI */
+  NimBLEDevice::init("");
+  NimBLEDevice::setPower(ESP_PWR_LVL_P9);
+
+  scan = NimBLEDevice::getScan();
+  scan->setScanCallbacks(new ScanCB());
+  scan->setActiveScan(true);
+  scan->start(0);
+  bootMark("BLE scanning");
+
+  for (;;)
+  {
+    uint32_t events = 0;
+    xTaskNotifyWait(0, UINT32_MAX, &events, pdMS_TO_TICKS(wait));
+    int64_t start = esp_timer_get_time();
+
+    if (events & OBD_EVT_DISCONNECTED)
+    {
+      obdLink.state = LINK_SCANNING;
+      uiSend(UI_CON_ERROR, 0, 1, millis());
+
+      /* Car is probably off, save the trip now */
+      storeRequestFlush();
+
+      if (settings.restart)
+      {
+        /* Restart on disconnect if enabled */
+        deep_sleep_restart();
+      }
+      disconnectObd();
+    }
+
+    if (obdLink.state == LINK_SCANNING && obdDevice && !client)
+    {
+      if (connectObd())
+      {
+        bootMarkOnce(connected, "adapter connected");
+        obdLink.state = LINK_INIT;
+        obdLink.step = 0;
+        obdLink.deadline = millis() + OBD_SETTLE;
+        obdScheduler.reset();
+
+        /* Start at full rate, the engine-off check sends it back to sleep if needed */
+        if (power.sleeping())
+          uiSend(UI_POWER, 0, POWER_ACTIVE, millis());
+        power.reset(millis());
+        adapterSleep.reset();
+        uiSend(UI_CON_ERROR, 0, 0, millis());
+      }
+      else
+      {
+        disconnectObd();
+      }
+    }
+
+    ObdResponse rx;
+    while (xQueueReceive(rxQueue, &rx, 0) == pdTRUE)
+    {
+      for (size_t i = 0; i < rx.len;)
+      {
+        i += obdRx.add(rx.data + i, rx.len - i);
+        if (obdRx.complete())
+          handleResponse(obdRx.data(), obdRx.length(), rx.t);
+      }
+    }
+
+    uint32_t now = millis();
+    wait = OBD_MAX_WAIT;
+
+    if (obdLink.state == LINK_INIT)
+    {
+      if ((int32_t)(now - obdLink.deadline) >= 0)
+      {
+        if (obdLink.step < sizeof(OBD_INIT) / sizeof(OBD_INIT[0]))
+        {
+          obdWrite(OBD_INIT[obdLink.step].cmd, OBD_INIT[obdLink.step].len);
+          obdLink.step++;
+          obdLink.deadline = now + OBD_INIT_WAIT;
+        }
+        else
+        {
+          obdLink.state = LINK_POLLING;
+        }
+      }
+      wait = obdLink.state == LINK_INIT ? obdLink.deadline - now : 0;
+    }
+
+    if (obdLink.state == LINK_POLLING && obdChar)
+    {
+      updatePower(now);
+
+      /* One request at a time, the next goes out at the prompt after this one's answer, or on a timeout */
+      ObdPid *request;
+      switch (adapterSleep.next(now, &request))
+      {
+      case OBD_WRITE_REQUEST:
+        obdWrite(request->cmd, request->cmdLen);
+        perfMetrics.request(request - obdPids);
+        break;
+      case OBD_WRITE_SLEEP:
+        obdWrite(CMD_ATLP, sizeof(CMD_ATLP));
+        break;
+      case OBD_WRITE_WAKE:
+        obdWrite(CMD_WAKE, sizeof(CMD_WAKE));
+        break;
+      default:
+        break;
+      }
+      wait = adapterSleep.idle(now);
+    }
+
+    checkStale(now);
+    if (wait > OBD_MAX_WAIT)
+      wait = OBD_MAX_WAIT;
+
+    if (now - lastStats >= SLOW_INTERVAL)
+    {
+      lastStats = now;
+      Timber.i("OBD: %u requests, %u timeouts", obdScheduler.requestCount(), obdScheduler.timeoutCount());
+    }
+
+    obdLoad.busy += esp_timer_get_time() - start;
+  }
+}
+
+/* ---------- FRAME PACING ---------- */
+#ifndef NO_FRAME_PACING
+/*
+ * Frames start on a frame clock instead of LVGL's refresh timer: the
+ * panel's tearing effect line where the board header defines LCD_TE, an
+ * esp_timer at FRAME_RATE otherwise. If the TE line has not ticked two
+ * periods after the clock starts, the driver left the output off and the
+ * timer takes over for good. The clock only runs while something is
+ * invalid or animating, so an idle UI still sleeps. Build with
+ * -D NO_FRAME_PACING to leave it to LVGL.
+ */
+static FramePacer framePacer(1000000 / FRAME_RATE);
+static bool frameDirty; // invalidated since the last frame
+static bool frameClockOn;
+static int64_t frameTickAt; // us, last tick of the frame clock
+static portMUX_TYPE frameTickMux = portMUX_INITIALIZER_UNLOCKED;
+static esp_timer_handle_t paceTimer; // the clock, or with TE a one shot check that it ticks
+#ifdef LCD_TE
+static bool frameTe = true;       // the TE line is the clock
+static volatile uint32_t teTicks; // seen on the TE line since boot
+#endif
+
+#ifdef LCD_TE
+static void IRAM_ATTR te_isr()
+{
+  portENTER_CRITICAL_ISR(&frameTickMux);
+  frameTickAt = esp_timer_get_time();
+  teTicks++;
+  portEXIT_CRITICAL_ISR(&frameTickMux);
+  BaseType_t woken = pdFALSE;
+  if (uiLoad.handle)
+    xTaskNotifyFromISR(uiLoad.handle, IDLE_EVT_FRAME, eSetBits, &woken);
+  if (woken)
+    portYIELD_FROM_ISR();
+}
+#endif
+
+static void pace_timer_cb(void *arg)
+{
+#ifdef LCD_TE
+  if (frameTe && teTicks)
+    return; // the check, and the TE line did tick
+#endif
+  portENTER_CRITICAL(&frameTickMux);
+  frameTickAt = esp_timer_get_time();
+  portEXIT_CRITICAL(&frameTickMux);
+  xTaskNotify(uiLoad.handle, IDLE_EVT_FRAME, eSetBits);
+}
+
+static void on_invalidate(lv_event_t *e)
+{
+  frameDirty = true;
+}
+
+/* Run the frame clock only while there is something to draw, call with LVGL locked */
+static void frameClock(bool on)
+{
+  if (on == frameClockOn)
+    return;
+  frameClockOn = on;
+  if (!on)
+    framePacer.restart();
+#ifdef LCD_TE
+  if (frameTe)
+  {
+    if (on)
+    {
+      gpio_intr_enable((gpio_num_t)LCD_TE);
+      if (!teTicks)
+        esp_timer_start_once(paceTimer, 2 * framePacer.framePeriod());
+    }
+    else
+    {
+      gpio_intr_disable((gpio_num_t)LCD_TE);
+      esp_timer_stop(paceTimer);
+    }
+    return;
+  }
+#endif
+  if (on)
+    esp_timer_start_periodic(paceTimer, framePacer.framePeriod());
+  else
+    esp_timer_stop(paceTimer);
+}
+
+/* Take refreshing over from LVGL, once the boot screen is out */
+static void framePacingInit(lv_display_t *display)
+{
+  lv_display_delete_refr_timer(display);
+  lv_display_add_event_cb(display, on_invalidate, LV_EVENT_INVALIDATE_AREA, NULL);
+  esp_timer_create_args_t args = {};
+  args.callback = pace_timer_cb;
+  args.name = "pace";
+  args.skip_unhandled_events = true;
+  esp_timer_create(&args, &paceTimer);
+#ifdef LCD_TE
+  pinMode(LCD_TE, INPUT);
+  attachInterrupt(digitalPinToInterrupt(LCD_TE), te_isr, RISING);
+  gpio_intr_disable((gpio_num_t)LCD_TE);
+  const char *source = "tearing effect line";
+#else
+  const char *source = "timer";
+#endif
+  frameDirty = true; // whatever was loaded after the boot screen
+  Timber.i("Frame pacing: %d fps from the %s", FRAME_RATE, source);
+}
+
+/*
+ * A tick of the frame clock: draw if the slot is due. Animations are
+ * brought to the time of the frame first, so they move by a whole frame's
+ * step every frame instead of by whatever their own timer last saw.
+ */
+static void frameTick()
+{
+#ifdef LCD_TE
+  if (frameTe && !teTicks)
+  {
+    /* The check ran out before the first TE tick */
+    frameTe = false;
+    gpio_intr_disable((gpio_num_t)LCD_TE);
+    esp_timer_start_periodic(paceTimer, framePacer.framePeriod());
+    Timber.w("Frame pacing: no ticks on the tearing effect line, using the timer");
+  }
+#endif
+  portENTER_CRITICAL(&frameTickMux);
+  int64_t tick = frameTickAt;
+  portEXIT_CRITICAL(&frameTickMux);
+  if (!framePacer.due(tick, esp_timer_get_time()))
+    return;
+  lv_anim_refr_now();
+  lv_display_refr_timer(NULL);
+  frameDirty = false; // LVGL refuses invalidation while rendering
+  framePacer.done(esp_timer_get_time());
+}
+
+static void reportPacing()
+{
+  FramePacer &p = framePacer;
+  if (p.frames() || p.skipped())
+  {
+    Timber.i("Pacing: %u frames at %d fps, %u slots skipped, %u over budget, frame avg %.1f ms, "
+             "max %.1f ms, start late avg %.1f ms, max %.1f ms",
+             p.frames(), FRAME_RATE, p.skipped(), p.overruns(), p.frameAvg() / 1000.0f,
+             p.frameWorst() / 1000.0f, p.lateAvg() / 1000.0f, p.lateWorst() / 1000.0f);
+  }
+  p.resetStats();
+}
+#endif
+
+/* ---------- UI TASK ---------- */
+/* Feed a decoded sample into the subjects, filters and trip computer */
+static void applySample(uint8_t pid, float value, uint32_t t)
+{
+  switch (pid)
+  {
+  case 0x0D: // Speed
+    lv_subject_set_int(&speed, (int)value);
+    derived.set(SIG_SPEED, value, t);
+    trips.addSpeed(value, t);
+    break;
+
+  case 0x0C: // RPM
+    rpmEstimator.addSample(value, t);
+    derived.set(SIG_RPM, value, t);
+    lv_timer_resume(frame_timer);
+    break;
+
+  case 0x2F: // Fuel
+  {
+    float fuel = fuelFilter.add((uint8_t)value);
+    Timber.i("Fuel: %.1f %% (raw %.1f %%)\n", fuel, (value * 100.0f) / 255.0f);
+    lv_subject_set_int(&fuel_capacity, (int)(fuel * settings.tank / 100));
+    trips.addLevel(fuel * settings.tank / 100, t);
+    break;
+  }
+
+  case 0x10: // MAF
+    derived.set(SIG_MAF, value, t);
+    trips.addMaf(value, t);
+    break;
+
+  case 0x05: // Coolant temp
+    lv_subject_set_int(&coolant_temp, (int)value);
+    break;
+  }
+}
+
+/* Engine off: dim and stop refreshing, the subjects keep updating underneath */
+static void applyPower(bool sleep)
+{
+  if (sleep == power_sleep)
+    return;
+  power_sleep = sleep;
+
+  lv_display_t *display = lv_display_get_default();
+  if (sleep)
+  {
+    tft.setBrightness(POWER_DIM_BRIGHTNESS);
+    lv_display_enable_invalidation(display, false);
+  }
+  else
+  {
+    lv_display_enable_invalidation(display, true);
+    lv_obj_invalidate(lv_screen_active());
+    tft.setBrightness((uint8_t)settings.brightness);
+  }
+}
+
+/* Apply everything the OBD task sent since the last frame, call with LVGL locked */
+static void drainUiQueue()
+{
+  UiMsg msg;
+  bool samples = false;
+
+  while (xQueueReceive(uiQueue, &msg, 0) == pdTRUE)
+  {
+    switch (msg.type)
+    {
+    case UI_SAMPLE:
+      applySample(msg.id, msg.value, msg.t);
+      samples = true;
+      break;
+    case UI_STALE:
+      lv_subject_set_int((lv_subject_t *)msg.target, (int)msg.value);
+      break;
+    case UI_CAN_ERROR:
+      lv_subject_set_int(&can_error, (int)msg.value);
+      break;
+    case UI_CON_ERROR:
+      lv_subject_set_int(&con_error, (int)msg.value);
+      break;
+    case UI_POWER:
+      applyPower(msg.value == POWER_SLEEP);
+      if (msg.value == POWER_SLEEP)
+      {
+        /* Power may be cut any time after the engine stops, save the trip now */
+        publishTrips();
+        storeRequestFlush();
+      }
+      break;
+    }
+  }
+
+  if (samples)
+  {
+    derived.update(publishDerived);
+    publishTrips();
+    bootHandover("first data, showing dashboard");
+  }
+}
+
+static size_t heapFree()
+{
+  return heap_caps_get_free_size(MALLOC_CAP_8BIT);
+}
+
+/* Log free stack and CPU share of a task since the last report */
+static void reportTask(TaskLoad &load, uint64_t elapsed)
+{
+  if (!load.handle)
+    return;
+  Timber.i("Task %s: %u bytes stack free, %.1f %% busy", load.name,
+           uxTaskGetStackHighWaterMark(load.handle), load.busy * 100.0f / elapsed);
+  load.busy = 0;
+}
+
+#if CONFIG_FREERTOS_GENERATE_RUN_TIME_STATS
+/* Run time of each core's idle task at the last report, busy is the rest */
+static uint32_t coreIdle[portNUM_PROCESSORS];
+static uint32_t coreClock;
+
+/* Log the CPU share of every core since the last report, draw threads included */
+static void reportCores()
+{
+  uint32_t now = portGET_RUN_TIME_COUNTER_VALUE();
+  uint32_t elapsed = now - coreClock;
+  coreClock = now;
+  char line[48];
+  int len = 0;
+  for (int core = 0; core < portNUM_PROCESSORS; core++)
+  {
+    TaskStatus_t status;
+    vTaskGetInfo(xTaskGetIdleTaskHandleForCPU(core), &status, pdFALSE, eRunning);
+    uint32_t idle = status.ulRunTimeCounter - coreIdle[core];
+    coreIdle[core] = status.ulRunTimeCounter;
+    float busy = elapsed && idle < elapsed ? 100.0f - idle * 100.0f / elapsed : 0;
+    len += snprintf(line + len, sizeof(line) - len, "%s%.1f %%", core ? ", " : "", busy);
+  }
+  Timber.i("Cores busy: %s", line);
+}
+#endif
+
+/**
+ * Render loop
+ *
+ * Sleeps on its notification until a sample is queued, the panel is touched,
+ * the frame clock ticks or the next LVGL timer is due, then applies the
+ * samples, runs lv_timer_handler and draws a frame if one is due. Never
+ * waits on BLE or the adapter.
+ */
+static void uiTask(void *param)
+{
+  uint32_t wait = 0;
+  int64_t lastReport = esp_timer_get_time();
+
+  for (;;)
+  {
+    uint32_t events = 0;
+    xTaskNotifyWait(0, UINT32_MAX, &events, pdMS_TO_TICKS(wait));
+
+    int64_t start = esp_timer_get_time();
+    uiIdle.wake(start, events);
+
+    LVGL_LOCK();
+    drainUiQueue();
+#ifdef TOUCH_WAKE_PIN
+    if ((events & IDLE_EVT_TOUCH) || touch_pressed)
+    {
+      lv_indev_read(touch_indev);
+    }
+#endif
+    uint32_t timerIdle = lv_timer_handler();
+#ifndef NO_FRAME_PACING
+    if ((events & IDLE_EVT_FRAME) && frameClockOn)
+      frameTick();
+    frameClock(frameDirty || lv_anim_count_running());
+#endif
+    LVGL_UNLOCK();
+
+    int64_t end = esp_timer_get_time();
+    uiLoad.busy += end - start;
+
+    if (end - lastReport >= SLOW_INTERVAL * 1000LL)
+    {
+      uint64_t elapsed = end - lastReport;
+      lastReport = end;
+      reportTask(uiLoad, elapsed);
+      reportTask(obdLoad, elapsed);
+#if CONFIG_FREERTOS_GENERATE_RUN_TIME_STATS
+      reportCores();
+#endif
+      Timber.i("Task store: %u bytes stack free, %u UI messages dropped",
+               uxTaskGetStackHighWaterMark(storeTaskHandle), uiDropped);
+      Timber.i("UI duty %.1f %%, wakeups: %u sample, %u touch, %u frame, %u timer",
+               uiIdle.dutyCycle() * 100, uiIdle.sampleWakeups(), uiIdle.touchWakeups(),
+               uiIdle.frameWakeups(), uiIdle.timerWakeups());
+      Timber.i("RPM estimator: %u samples, mae %.1f, max %.1f", rpmEstimator.sampleCount(),
+               rpmEstimator.meanAbsError(), rpmEstimator.maxAbsError());
+      reportFrames();
+#ifndef NO_FRAME_PACING
+      reportPacing();
+#endif
+      Timber.i("Heap: %u bytes free, %u min, %u in digit sprites", heapFree(),
+               heap_caps_get_minimum_free_size(MALLOC_CAP_8BIT), digit_sprite_get_cache_size());
+      uint32_t glyphHits, glyphMisses;
+      glyph_cache_take_stats(&glyphHits, &glyphMisses);
+      Timber.i("Glyph cache: %u bytes, %u hits, %u decoded", glyph_cache_get_size(), glyphHits,
+               glyphMisses);
+      static const char *const arcs[] = {"rpm_arc", "fuel_arc"};
+      uint32_t arcPx = 0, spanArcs = 0;
+      LVGL_LOCK();
+      if (dashboard_screen)
+      {
+        for (const char *name : arcs)
+        {
+          lv_obj_t *arc = lv_obj_find_by_name(dashboard_screen, name);
+          if (arc)
+            arcPx += arc_gauge_take_invalidated(arc);
+        }
+      }
+#ifndef NO_RING_SPANS
+      spanArcs = ringArcs;
+      ringArcs = 0;
+#endif
+#ifndef NO_GLYPH_UNIT
+      uint32_t tableLabels = glyphLabels;
+      glyphLabels = 0;
+#endif
+      LVGL_UNLOCK();
+      Timber.i("Arc gauges: %u px invalidated, %u arcs drawn from ring spans", arcPx, spanArcs);
+#ifndef NO_GLYPH_UNIT
+      Timber.i("Glyph unit: %u labels drawn from the color table", tableLabels);
+#endif
+      uiIdle.resetStats(end);
+    }
+
+#ifdef TOUCH_WAKE_PIN
+    bool touching = touch_pressed;
+#else
+    bool touching = false; // the indev timer polls
+#endif
+    wait = uiIdle.sleep(esp_timer_get_time(), timerIdle, touching);
+  }
+}
+
+/* ---------- PERF OVERLAY ---------- */
+/*
+ * While the overlay on lv_layer_top is shown, the counters become a
+ * snapshot once a second for it; otherwise nothing runs until the "perf"
+ * serial command takes one over the time since the last. It prints it as
+ * one line of key=value pairs. The overlay is small, opaque and only
+ * changes with the snapshot; the frame that draws the new text is left out
+ * of the numbers. "overlay" on the serial port toggles it, -D PERF_OVERLAY
+ * shows it at boot. The store task reads the commands on its poll.
+ */
+const uint32_t PERF_INTERVAL = MEDIUM_INTERVAL;
+const size_t PERF_PIDS = sizeof(obdPids) / sizeof(obdPids[0]);
+
+static PerfSnapshot<PERF_PIDS> perfSnapshot;
+static int64_t perfTaken;
+static lv_obj_t *perfLabel; // nullptr while hidden
+static lv_timer_t *perfTimer; // only while the overlay is shown
+
+static void perfPids(uint8_t (&pids)[PERF_PIDS])
+{
+  for (size_t i = 0; i < PERF_PIDS; i++)
+    pids[i] = obdPids[i].pid;
+}
+
+static void perfOverlayUpdate()
+{
+  char text[192];
+  uint8_t pids[PERF_PIDS];
+  perfPids(pids);
+  perfFormatOverlay(text, sizeof(text), perfSnapshot, pids);
+  lv_label_set_text(perfLabel, text);
+  perfOverlayDirty = true;
+}
+
+/* The counters since the last call into perfSnapshot, call with LVGL locked */
+static void perfTake()
+{
+  int64_t now = esp_timer_get_time();
+  perfMetrics.snapshot(now - perfTaken, perfSnapshot);
+  perfTaken = now;
+  size_t freeBytes = heapFree();
+  perfSnapshot.heapFree = freeBytes;
+  perfSnapshot.heapUsed = heap_caps_get_total_size(MALLOC_CAP_8BIT) - freeBytes;
+}
+
+static void perf_timer_cb(lv_timer_t *timer)
+{
+  perfTake();
+  perfOverlayUpdate();
+}
+
+/* Call with LVGL locked */
+static void perfOverlayShow(bool show)
+{
+  if (show == (perfLabel != nullptr))
+    return;
+  if (show)
+  {
+    perfTake();
+    perfLabel = lv_label_create(lv_layer_top());
+    lv_obj_set_style_bg_color(perfLabel, lv_color_black(), 0);
+    lv_obj_set_style_bg_opa(perfLabel, LV_OPA_COVER, 0);
+    lv_obj_set_style_text_color(perfLabel, lv_color_white(), 0);
+    lv_obj_set_style_pad_all(perfLabel, 4, 0);
+    lv_obj_align(perfLabel, LV_ALIGN_CENTER, 0, 0); // clear of the edge of round panels
+    perfOverlayUpdate();
+    perfTimer = lv_timer_create(perf_timer_cb, PERF_INTERVAL, NULL);
+  }
+  else
+  {
+    lv_timer_delete(perfTimer);
+    perfTimer = nullptr;
+    lv_obj_delete(perfLabel);
+    perfLabel = nullptr;
+    perfOverlayDirty = true;
+  }
+}
+
+/* Store task */
+static void perfCommand(const char *cmd)
+{
+  if (strcmp(cmd, "perf") == 0)
+  {
+    char line[384];
+    uint8_t pids[PERF_PIDS];
+    perfPids(pids);
+    LVGL_LOCK();
+    if (!perfLabel)
+      perfTake(); // else the overlay's, taken on its own second
+    perfFormatLine(line, sizeof(line), perfSnapshot, pids);
+    LVGL_UNLOCK();
+    USBSerial.printf("perf %s\n", line);
+  }
+  else if (strcmp(cmd, "overlay") == 0)
+  {
+    LVGL_LOCK();
+    perfOverlayShow(!perfLabel);
+    LVGL_UNLOCK();
+  }
+  else
+  {
+    USBSerial.printf("unknown command \"%s\", try perf or overlay\n", cmd);
+  }
+}
+
+/* Commands end with a newline, a line too long is cut. Store task */
+static void perfSerial()
+{
+  static char line[16];
+  static size_t len = 0;
+  if (!uiLoad.handle)
+    return; // setup() is still building the UI, without the lock
+  while (USBSerial.available() > 0)
+  {
+    int c = USBSerial.read();
+    if (c == '\r' || c == '\n')
+    {
+      line[len] = 0;
+      if (len)
+        perfCommand(line);
+      len = 0;
+    }
+    else if (len < sizeof(line) - 1)
+    {
+      line[len++] = (char)c;
+    }
+  }
+}
+
+static void perfInit()
+{
+  perfTaken = esp_timer_get_time();
+#ifdef PERF_OVERLAY
+  perfOverlayShow(true);
+#endif
+}
+
+/* ---------- LVGL DISPLAY & TOUCH DRIVER ---------- */
+/*Convert rotation number to lvgl rotation type*/
+lv_display_rotation_t get_rotation(uint8_t rotation)
+{
+  if (rotation > 3)
+    return LV_DISPLAY_ROTATION_0;
+  return (lv_display_rotation_t)rotation;
+}
+
+/* Send packed runs, one window each */
+static void pushRuns(const SpanRun *runs, uint16_t count, uint16_t *data)
+{
+#ifdef DISPLAY_PUSH_RUNS
+  tft.pushRunsDMA(runs, count, data);
+#else
+  /* each transfer waits for the one before, only the last is left in flight */
+  for (uint16_t i = 0; i < count; i++)
+  {
+    tft.pushImageDMA(runs[i].x, runs[i].y, runs[i].w, runs[i].h, data);
+    data += runs[i].w * runs[i].h;
+  }
+#endif
+}
+
+/* Put an RGB565 area on the panel, trimmed to the circle and to what changed */
+static void flushPanel(const lv_area_t *area, uint16_t *px)
+{
+  if (tft.getStartCount() == 0)
+  {
+    tft.startWrite(); // keep the bus transaction open, DMA runs past this call
+  }
+
+#if defined(ROUND_DISPLAY) || !defined(NO_FRAME_DIFF)
+  const SpanRun *runs = spanRuns;
+#ifdef ROUND_DISPLAY
+  /* Only the row spans inside the circle go on the bus */
+  uint16_t count = circle.shape(area->x1, area->y1, area->x2, area->y2, px, spanRuns,
+                                SCREEN_HEIGHT / 2);
+#else
+  spanRuns[0] = {(int16_t)area->x1, (int16_t)area->y1, (uint16_t)lv_area_get_width(area),
+                 (uint16_t)lv_area_get_height(area)};
+  uint16_t count = 1;
+#endif
+#ifndef NO_FRAME_DIFF
+  /* Drop the row segments the panel already shows */
+  int64_t hashed = esp_timer_get_time();
+  count = rowDiff.filter(spanRuns, count, px, diffRuns);
+  runs = diffRuns;
+  flushStats.diffTime += esp_timer_get_time() - hashed;
+#endif
+  if (!count)
+    return; // nothing to send, nothing in flight
+  /* Returns as soon as the transfer is started, flush_wait_cb waits for it */
+  flushStats.sent += spanPixels(runs, count) * PANEL_BPP;
+  if (!flushStats.started)
+    flushStats.started = esp_timer_get_time();
+  pushRuns(runs, count, px);
+#else
+  flushStats.sent += lv_area_get_size(area) * PANEL_BPP;
+  if (!flushStats.started)
+    flushStats.started = esp_timer_get_time();
+  tft.pushImageDMA(area->x1, area->y1, area->x2 - area->x1 + 1, area->y2 - area->y1 + 1, px);
+#endif
+}
+
+#ifdef RENDER_L8
+/*
+ * Expand an L8 area through the palette, L8_EXPAND_LINES rows at a time,
+ * mirrored by the XFORM_FLIP_* bits in `flip`. Each chunk is expanded into
+ * the buffer the transfer in flight does not use, then waits for that
+ * transfer; the last is left in flight.
+ */
+static void flushL8(const lv_area_t *area, const uint8_t *data, uint8_t flip)
+{
+  int32_t w = lv_area_get_width(area);
+  int32_t h = lv_area_get_height(area);
+  lv_area_t panel = *area;
+  xformArea(panel.x1, panel.y1, panel.x2, panel.y2, SCREEN_WIDTH, SCREEN_HEIGHT, flip);
+  static uint8_t next = 0; // across calls, the last chunk may still be in flight
+  for (int32_t y = 0; y < h; y += L8_EXPAND_LINES)
+  {
+    int32_t rows = h - y < (int32_t)L8_EXPAND_LINES ? h - y : L8_EXPAND_LINES;
+    uint16_t *buf = expand_buf[next];
+    next ^= 1;
+    int64_t started = esp_timer_get_time();
+    for (int32_t r = 0; r < rows; r++)
+    {
+      int32_t src = (flip & XFORM_FLIP_Y) ? h - 1 - y - r : y + r;
+      l8Expand(data + src * w, buf + r * w, w, l8Lut, flip & XFORM_FLIP_X);
+    }
+    flushStats.expandTime += esp_timer_get_time() - started;
+    tft.waitDMA(); // frees the other buffer for the next chunk
+    lv_area_t chunk = {panel.x1, panel.y1 + y, panel.x2, panel.y1 + y + rows - 1};
+    flushPanel(&chunk, buf);
+  }
+}
+#endif
+
+/* Display flushing */
+void my_disp_flush(lv_display_t *display, const lv_area_t *area, unsigned char *data)
+{
+  int64_t enter = esp_timer_get_time();
+  uint64_t sent = flushStats.sent;
+  flushStats.bytes += lv_area_get_size(area) * DRAW_BUF_BPP;
+  frameStats.flushes++;
+
+#ifdef RENDER_L8
+  /* Mirrored while expanding */
+#ifdef SW_FLIP
+  flushL8(area, data, swFlip);
+#else
+  flushL8(area, data, 0);
+#endif
+#else
+#if defined(SW_ROTATION) || defined(SW_FLIP)
+  uint8_t xform = 0;
+#ifdef SW_ROTATION
+  xform = xformRotation(lv_display_get_rotation(display));
+#endif
+#ifdef SW_FLIP
+  xform ^= swFlip; // mirrors the rotated area, as the panel would
+#endif
+  lv_area_t panel_area;
+  if (xform)
+  {
+    int64_t started = esp_timer_get_time();
+    uint32_t w = lv_area_get_width(area);
+    uint32_t h = lv_area_get_height(area);
+    panel_area = *area;
+    xformArea(panel_area.x1, panel_area.y1, panel_area.x2, panel_area.y2,
+              lv_display_get_horizontal_resolution(display), lv_display_get_vertical_resolution(display),
+              xform);
+    /* Mirrors work in place, a swap goes to the buffer allocated next to the draw buffers */
+#ifdef SW_ROTATION
+    uint8_t *out = (xform & XFORM_SWAP_XY) ? rotated_buf : data;
+#else
+    uint8_t *out = data;
+#endif
+    xformPixels((const uint16_t *)data, (uint16_t *)out, w, h, xform);
+    area = &panel_area;
+    data = out;
+    flushStats.xformTime += esp_timer_get_time() - started;
+  }
+#endif
+  flushPanel(area, (uint16_t *)data);
+#endif
+  if (!perfOverlayFrame)
+    perfMetrics.flush(esp_timer_get_time() - enter, (flushStats.sent - sent) / PANEL_BPP);
+}
+
+/*
+ * LVGL needs the buffer back: block until its transfer is done. Returning
+ * counts as lv_display_flush_ready(). Only waits when rendering the other
+ * buffer was quicker than the transfer, the stall time says by how much.
+ */
+static void flush_wait_cb(lv_display_t *display)
+{
+  int64_t enter = esp_timer_get_time();
+  bool busy = tft.dmaBusy();
+  tft.waitDMA();
+  int64_t done = esp_timer_get_time();
+  if (!perfOverlayFrame)
+    perfMetrics.flush(done - enter, 0);
+
+  FlushStats &f = flushStats;
+  if (!f.started)
+    return; // nothing was in flight
+  f.transfers++;
+  f.inFlight += done - f.started;
+  f.started = 0;
+  if (busy)
+  {
+    f.stalls++;
+    f.stalled += done - enter;
+  }
+}
+
+static void on_render_start(lv_event_t *e)
+{
+  frameStats.start = esp_timer_get_time();
+  perfOverlayFrame = perfOverlayDirty;
+  perfOverlayDirty = false;
+}
+
+static void on_render_ready(lv_event_t *e)
+{
+  uint32_t took = esp_timer_get_time() - frameStats.start;
+  frameStats.frames++;
+  frameStats.total += took;
+  if (took > frameStats.max)
+    frameStats.max = took;
+  if (!perfOverlayFrame)
+    perfMetrics.frame(took);
+}
+
+static uint8_t *drawBufAlloc(size_t bytes, DrawBufferMemory memory)
+{
+  uint32_t caps = memory == DRAW_BUF_PSRAM ? MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT
+                                           : MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL;
+  return (uint8_t *)heap_caps_malloc(bytes, caps);
+}
+
+static void drawBufFree()
+{
+  heap_caps_free(lv_buffer[0]);
+  heap_caps_free(lv_buffer[1]);
+  lv_buffer[0] = lv_buffer[1] = nullptr;
+#ifdef SW_ROTATION
+  heap_caps_free(rotated_buf);
+  rotated_buf = nullptr;
+#endif
+}
+
+/* Plan the buffers against what is free now, `psram` 0 for internal RAM only */
+static DrawBufferPlan drawBufPlan(size_t psram)
+{
+  const uint32_t caps = MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL;
+  DrawBufferPlan plan =
+      drawBufferPlan(SCREEN_WIDTH, SCREEN_HEIGHT, DRAW_BUF_BPP, LV_BUFFER_SIZE / SCREEN_WIDTH, psram,
+                     heap_caps_get_free_size(caps), heap_caps_get_largest_free_block(caps),
+                     DRAW_BUF_RESERVE);
+#ifdef DRAW_BUF_LINES
+  plan.lines = DRAW_BUF_LINES;
+  plan.bytes = (size_t)SCREEN_WIDTH * DRAW_BUF_BPP * DRAW_BUF_LINES;
+#endif
+  return plan;
+}
+
+/* Allocate the draw buffers as planned, halving the strip until they fit */
+static bool drawBufInit()
+{
+#ifdef RENDER_L8
+  /* Read by the DMA, so internal RAM wherever the strips go */
+  for (uint16_t *&buf : expand_buf)
+    buf = (uint16_t *)drawBufAlloc((size_t)SCREEN_WIDTH * PANEL_BPP * L8_EXPAND_LINES,
+                                   DRAW_BUF_INTERNAL);
+  if (!expand_buf[0] || !expand_buf[1])
+  {
+    Timber.e("Draw buffers: out of memory");
+    return false;
+  }
+  l8PaletteRamp(l8Lut, L8_COLOR, true); // RGB565_SWAPPED like the other boards' buffers
+#endif
+  size_t psram = 0;
+#ifndef DRAW_BUF_NO_PSRAM
+  if (psramFound())
+    psram = heap_caps_get_free_size(MALLOC_CAP_SPIRAM);
+#endif
+  drawBuf = drawBufPlan(psram);
+
+  for (;;)
+  {
+    lv_buffer[0] = drawBufAlloc(drawBuf.bytes, drawBuf.memory);
+    lv_buffer[1] = drawBufAlloc(drawBuf.bytes, drawBuf.memory);
+#ifdef SW_ROTATION
+    rotated_buf = drawBufAlloc(drawBuf.bytes, drawBuf.memory);
+    if (lv_buffer[0] && lv_buffer[1] && rotated_buf)
+#else
+    if (lv_buffer[0] && lv_buffer[1])
+#endif
+    {
+      break;
+    }
+    drawBufFree();
+
+    if (drawBuf.memory == DRAW_BUF_PSRAM)
+    {
+      drawBuf = drawBufPlan(0); // PSRAM too fragmented, strips sized for internal RAM
+      continue;
+    }
+    if (drawBuf.lines <= 2)
+    {
+      Timber.e("Draw buffers: out of memory");
+      return false;
+    }
+    drawBuf.lines /= 2;
+    drawBuf.bytes = (size_t)SCREEN_WIDTH * DRAW_BUF_BPP * drawBuf.lines;
+  }
+
+  Timber.i("Draw buffers: 2 x %u bytes (%u lines) in %s, %u flushes per full frame", drawBuf.bytes,
+           drawBuf.lines, drawBuf.memory == DRAW_BUF_PSRAM ? "PSRAM" : "internal RAM",
+           (SCREEN_HEIGHT + drawBuf.lines - 1) / drawBuf.lines);
+#ifdef RENDER_L8
+  Timber.i("Draw buffers: L8, expanded %u lines at a time into 2 buffers", L8_EXPAND_LINES);
+#endif
+  return true;
+}
+
+/* Rounder event callback to align area to 2x2 pixels (and trim it to round panels) */
+void rounder_event_cb(lv_event_t *e)
+{
+  lv_area_t *area = lv_event_get_invalidated_area(e);
+  uint16_t x1 = area->x1;
+  uint16_t x2 = area->x2;
+
+  uint16_t y1 = area->y1;
+  uint16_t y2 = area->y2;
+
+  // round the start of coordinate down to the nearest 2M number
+  area->x1 = (x1 >> 1) << 1;
+  area->y1 = (y1 >> 1) << 1;
+  // round the end of coordinate up to the nearest 2N+1 number
+  area->x2 = ((x2 >> 1) << 1) + 1;
+  area->y2 = ((y2 >> 1) << 1) + 1;
+
+#ifdef ROUND_DISPLAY
+  // don't render what is outside the circle, keeps the 2x2 alignment
+  circle.clip(area->x1, area->y1, area->x2, area->y2);
+#endif
+}
+
+/*Read the touchpad*/
+void my_touchpad_read(lv_indev_t *indev_driver, lv_indev_data_t *data)
+{
+  uint16_t touchX, touchY;
+  bool touched = tft.getTouch(&touchX, &touchY);
+
+  touch_pressed = touched;
+
+  if (!touched)
+  {
+    data->state = LV_INDEV_STATE_RELEASED;
+  }
+  else
+  {
+    data->state = LV_INDEV_STATE_PRESSED;
+#ifdef SW_FLIP
+    /* The panel shows the frame mirrored, touches land mirrored too */
+    if (swFlip & XFORM_FLIP_X)
+      touchX = SCREEN_WIDTH - 1 - touchX;
+    if (swFlip & XFORM_FLIP_Y)
+      touchY = SCREEN_HEIGHT - 1 - touchY;
+#endif
+    /*Set the coordinates*/
+    data->point.x = touchX;
+    data->point.y = touchY;
+  }
+}
+
+#ifdef TOUCH_WAKE_PIN
+static void IRAM_ATTR touch_isr()
+{
+  BaseType_t woken = pdFALSE;
+  if (uiLoad.handle)
+    xTaskNotifyFromISR(uiLoad.handle, IDLE_EVT_TOUCH, eSetBits, &woken);
+  if (woken)
+    portYIELD_FROM_ISR();
+}
+#endif
+
+/*
+ * Once per frame: apply pending hardware settings, publish the interpolated RPM.
+ * Pauses itself once there is nothing left to do so the UI task can sleep,
+ * resumed by an RPM sample or a settings change.
+ */
+void frame_cb(lv_timer_t *timer)
+{
+  if (hwPending)
+  {
+    tft.waitDMA(); // panel commands share the bus with the last flush
+  }
+  if (hwPending & HW_BRIGHTNESS)
+  {
+    tft.setBrightness(power_sleep ? POWER_DIM_BRIGHTNESS : (uint8_t)settings.brightness);
+  }
+  if (hwPending & HW_FLIP)
+  {
+#ifdef SW_FLIP
+    swFlip = settings.hud & (XFORM_FLIP_X | XFORM_FLIP_Y);
+#else
+    tft.setFlipMode(settings.hud);
+#endif
+#ifndef NO_FRAME_DIFF
+    rowDiff.reset(); // the panel memory is read out mirrored now
+#endif
+    lv_obj_invalidate(lv_screen_active());
+  }
+  hwPending = 0;
+
+  if (!rpmEstimator.valid())
+  {
+    lv_timer_pause(timer);
+    return;
+  }
+
+  int32_t rpm = (int32_t)(rpmEstimator.estimate(millis()) + 0.5f);
+  if (rpm != lv_subject_get_int(&engine_rpm))
+  {
+    lv_subject_set_int(&engine_rpm, rpm);
+  }
+  else
+  {
+    /* Estimate has settled until the next sample */
+    lv_timer_pause(timer);
+  }
+}
+
+/*Tick function*/
+static uint32_t my_tick(void)
+{
+  return millis();
+}
+
+// void on_rotation_change(lv_observer_t *observer, lv_subject_t *subject)
+// {
+//   int32_t rotation = lv_subject_get_int(subject);
+
+// #ifdef SW_ROTATION
+//   lv_display_set_rotation(lv_display_get_default(), get_rotation(rotation));
 // #else
 //   tft.setRotation(rotation);
 //   // screen rotation has changed, invalidate to redraw
@@ -414,24 +2042,53 @@ static uint32_t my_tick(void)
 
 void on_brightness_change(lv_observer_t *observer, lv_subject_t *subject)
 {
-  int32_t brightness = lv_subject_get_int(subject);
-  tft.setBrightness((uint8_t)brightness);
-  prefs.putInt("brightness", brightness);
+  settings.brightness = lv_subject_get_int(subject);
+  hwPending |= HW_BRIGHTNESS;
+  lv_timer_resume(frame_timer);
+  storeTouch(brightnessSlot);
 }
 
 void on_hud_change(lv_observer_t *observer, lv_subject_t *subject)
 {
-  int32_t hud = lv_subject_get_int(subject);
-  prefs.putInt("hud", hud);
-  tft.setFlipMode(hud);
-  lv_obj_invalidate(lv_screen_active());
+  settings.hud = lv_subject_get_int(subject);
+  hwPending |= HW_FLIP;
+  lv_timer_resume(frame_timer);
+  storeTouch(hudSlot);
 }
 
 void on_restart_change(lv_observer_t *observer, lv_subject_t *subject)
 {
-  int32_t restart = lv_subject_get_int(subject);
-  prefs.putInt("restart", restart);
-  should_restart = restart;
+  settings.restart = lv_subject_get_int(subject);
+  storeTouch(restartSlot);
+}
+
+void on_tank_change(lv_observer_t *observer, lv_subject_t *subject)
+{
+  settings.tank = lv_subject_get_int(subject);
+  storeTouch(tankSlot);
+
+  lv_obj_t *fuel_arc = lv_obj_find_by_name(dashboard_screen, "fuel_arc");
+  if (fuel_arc)
+  {
+    arc_gauge_set_max_value(fuel_arc, settings.tank);
+  }
+  if (fuelFilter.valid())
+  {
+    lv_subject_set_int(&fuel_capacity, (int)(fuelFilter.value() * settings.tank / 100));
+  }
+}
+
+/* Save slider values as soon as they are let go */
+void on_slider_released(lv_event_t *e)
+{
+  storeRequestFlush();
+}
+
+void on_trip_reset_cb(lv_event_t *e)
+{
+  Trip id = (Trip)(uintptr_t)lv_event_get_user_data(e);
+  trips.reset(id);
+  publishTrips();
 }
 
 void on_restart_cb(lv_event_t *e)
@@ -439,6 +2096,239 @@ void on_restart_cb(lv_event_t *e)
   deep_sleep_restart();
 }
 
+/* ---------- SCREENS ---------- */
+/*
+ * Only the dashboard stays resident. The other screens are built when they
+ * are navigated to and deleted once they have been left, their wiring is
+ * redone on every build. What each build costs is logged against the heap
+ * (LVGL allocates from it, LV_USE_STDLIB_MALLOC=LV_STDLIB_CLIB).
+ */
+enum ScreenId : uint8_t
+{
+  SCREEN_BOOT,
+  SCREEN_DASHBOARD,
+  SCREEN_SETTINGS,
+  SCREEN_TRIP,
+  SCREEN_COUNT
+};
+
+struct ScreenDef
+{
+  const char *name;
+  lv_obj_t **obj;
+  lv_obj_t *(*create)();
+  void (*wire)(lv_obj_t *screen);
+  bool resident;
+  size_t cost;     // heap taken by the last build, bytes
+  size_t peak;     // largest build so far
+  lv_obj_t *dying; // left, deletion pending
+};
+
+#ifdef FONT_BENCH
+/* Build with -D FONT_BENCH to log what a digit costs to decode, raw and as the font draws it */
+static void fontBench()
+{
+  struct
+  {
+    const char *name;
+    const lv_font_t *font;
+  } fonts[] = {{"roboto_regular_24", roboto_regular_24},
+               {"roboto_bold_40", roboto_bold_40},
+               {"roboto_bold_150", roboto_bold_150}};
+  const uint32_t rounds = 20;
+  lv_draw_buf_t *buf = lv_draw_buf_create(160, 160, LV_COLOR_FORMAT_A8, LV_STRIDE_AUTO);
+  if (!buf)
+    return;
+
+  for (auto &f : fonts)
+  {
+    int64_t time[2];
+    uint32_t glyphs = 0;
+    for (uint8_t cached = 0; cached < 2; cached++)
+    {
+      int64_t start = esp_timer_get_time();
+      for (uint32_t r = 0; r < rounds; r++)
+      {
+        for (const char *c = "0123456789"; *c; c++)
+        {
+          lv_font_glyph_dsc_t g;
+          if (!lv_font_get_glyph_dsc(f.font, &g, *c, 0) ||
+              !lv_draw_buf_reshape(buf, LV_COLOR_FORMAT_A8, g.box_w, g.box_h, LV_STRIDE_AUTO))
+            continue;
+          if (cached)
+            lv_font_get_glyph_bitmap(&g, buf);
+          else
+            lv_font_get_bitmap_fmt_txt(&g, buf);
+          glyphs += !cached;
+        }
+      }
+      time[cached] = esp_timer_get_time() - start;
+    }
+    if (glyphs)
+    {
+      Timber.i("Font %s: %.1f us/glyph decoded, %.1f us as drawn", f.name,
+               (float)time[0] / glyphs, (float)time[1] / glyphs);
+    }
+  }
+  lv_draw_buf_destroy(buf);
+}
+#endif
+
+static void wireDashboard(lv_obj_t *screen);
+static void wireSettings(lv_obj_t *screen);
+static void wireTrip(lv_obj_t *screen);
+
+static ScreenDef screens[SCREEN_COUNT] = {
+    {"boot", &boot_screen, boot_create, nullptr, false},
+    {"dashboard", &dashboard_screen, dashboard_create, wireDashboard, true},
+    {"settings", &settings_screen, settings_create, wireSettings, false},
+    {"trip", &trip_screen, trip_create, wireTrip, false},
+};
+
+static void on_screen_loaded(lv_event_t *e)
+{
+  screen_loading = false;
+}
+
+/* Runs from lv_timer_handler, never from an event of the screen itself */
+static void screenDelete(void *param)
+{
+  ScreenDef &s = screens[(uintptr_t)param];
+  if (!s.dying)
+    return;
+
+  size_t before = heapFree();
+  lv_obj_delete(s.dying);
+  s.dying = nullptr;
+  Timber.i("Screen %s deleted: %u bytes freed, %u bytes heap free", s.name, heapFree() - before,
+           heapFree());
+}
+
+static void on_screen_unloaded(lv_event_t *e)
+{
+  uintptr_t id = (uintptr_t)lv_event_get_user_data(e);
+  ScreenDef &s = screens[id];
+  if (!*s.obj)
+    return;
+
+  s.dying = *s.obj;
+  *s.obj = nullptr;
+  lv_async_call(screenDelete, (void *)id);
+}
+
+/* The screen, built and wired if it does not exist */
+static lv_obj_t *screenGet(ScreenId id)
+{
+  ScreenDef &s = screens[id];
+  if (*s.obj)
+    return *s.obj;
+
+  size_t before = heapFree();
+  lv_obj_t *screen = s.create();
+  if (s.wire)
+    s.wire(screen);
+  lv_obj_add_event_cb(screen, on_screen_loaded, LV_EVENT_SCREEN_LOADED, NULL);
+  if (!s.resident)
+    lv_obj_add_event_cb(screen, on_screen_unloaded, LV_EVENT_SCREEN_UNLOADED, (void *)(uintptr_t)id);
+  *s.obj = screen;
+
+  size_t after = heapFree();
+  s.cost = before > after ? before - after : 0;
+  if (s.cost > s.peak)
+    s.peak = s.cost;
+  Timber.i("Screen %s built: %u bytes (peak %u), %u bytes heap free (min %u)", s.name, s.cost,
+           s.peak, after, heap_caps_get_minimum_free_size(MALLOC_CAP_8BIT));
+  return screen;
+}
+
+static void screenShow(ScreenId id)
+{
+  if (screen_loading)
+    return;
+  lv_obj_t *screen = screenGet(id);
+  if (screen == lv_screen_active())
+    return;
+  screen_loading = true;
+  lv_screen_load_anim(screen, LV_SCREEN_LOAD_ANIM_FADE_IN, 500, 0, false);
+}
+
+static void on_nav_cb(lv_event_t *e)
+{
+  screenShow((ScreenId)(uintptr_t)lv_event_get_user_data(e));
+}
+
+static void navOn(lv_obj_t *obj, lv_event_code_t code, ScreenId to)
+{
+  if (obj)
+  {
+    lv_obj_add_event_cb(obj, on_nav_cb, code, (void *)(uintptr_t)to);
+  }
+}
+
+/* Log what every screen costs, the high-water of LVGL's share of the heap */
+static void reportScreens()
+{
+  for (const ScreenDef &s : screens)
+  {
+    if (s.peak)
+    {
+      Timber.i("Screen %s: %s, %u bytes (peak %u)", s.name, *s.obj ? "built" : "deleted", s.cost,
+               s.peak);
+    }
+  }
+}
+
+static void wireDashboard(lv_obj_t *screen)
+{
+  lv_obj_t *fuel_arc = lv_obj_find_by_name(screen, "fuel_arc");
+  if (fuel_arc)
+  {
+    arc_gauge_set_max_value(fuel_arc, settings.tank);
+  }
+
+  navOn(screen, LV_EVENT_LONG_PRESSED, SCREEN_SETTINGS);
+  navOn(screen, LV_EVENT_SHORT_CLICKED, SCREEN_TRIP);
+}
+
+static void wireSettings(lv_obj_t *screen)
+{
+  navOn(lv_obj_find_by_name(screen, "settings_back"), LV_EVENT_CLICKED, SCREEN_DASHBOARD);
+  navOn(screen, LV_EVENT_LONG_PRESSED, SCREEN_DASHBOARD);
+
+  static const char *const sliders[] = {"brightness_slider", "tank_slider"};
+  for (const char *name : sliders)
+  {
+    lv_obj_t *slider = lv_obj_find_by_name(screen, name);
+    if (slider)
+    {
+      lv_obj_add_event_cb(slider, on_slider_released, LV_EVENT_RELEASED, NULL);
+    }
+  }
+
+  lv_obj_t *settings_restart = lv_obj_find_by_name(screen, "settings_restart");
+  if (settings_restart)
+  {
+    lv_obj_add_event_cb(settings_restart, on_restart_cb, LV_EVENT_CLICKED, NULL);
+  }
+}
+
+static void wireTrip(lv_obj_t *screen)
+{
+  navOn(lv_obj_find_by_name(screen, "trip_back"), LV_EVENT_CLICKED, SCREEN_DASHBOARD);
+
+  lv_obj_t *trip_a_reset = lv_obj_find_by_name(screen, "trip_a_reset");
+  if (trip_a_reset)
+  {
+    lv_obj_add_event_cb(trip_a_reset, on_trip_reset_cb, LV_EVENT_LONG_PRESSED, (void *)TRIP_A);
+  }
+
+  lv_obj_t *trip_b_reset = lv_obj_find_by_name(screen, "trip_b_reset");
+  if (trip_b_reset)
+  {
+    lv_obj_add_event_cb(trip_b_reset, on_trip_reset_cb, LV_EVENT_LONG_PRESSED, (void *)TRIP_B);
+  }
+}
+
 #if LV_USE_LOG != 0
 /**
  * Function to print lvgl logs when enabled
@@ -490,48 +2380,112 @@ void setup()
     break;
   }
 
+  bootMark("setup");
+
 #ifdef ELECROW_C3
   elecrow_c3_init();
 #endif
 
   prefs.begin("my-app");
 
+  store_mutex = xSemaphoreCreateMutex();
+  commit_mutex = xSemaphoreCreateMutex();
+
+  rxQueue = xQueueCreate(8, sizeof(ObdResponse));
+  uiQueue = xQueueCreate(32, sizeof(UiMsg));
+
+  tripSlot = store.add("trip_totals", trips.data(), TripComputer::size(), TRIP_SAVE_INTERVAL);
+  brightnessSlot = store.addInt("brightness", &settings.brightness, SETTINGS_SAVE_DELAY);
+  hudSlot = store.addInt("hud", &settings.hud, SETTINGS_SAVE_DELAY);
+  restartSlot = store.addInt("restart", &settings.restart, SETTINGS_SAVE_DELAY);
+  tankSlot = store.addInt("tank", &settings.tank, SETTINGS_SAVE_DELAY);
+
+  if (!store.load(tripSlot))
+    loadFloatTrips();
+  store.load(brightnessSlot);
+  store.load(hudSlot);
+  store.load(restartSlot);
+  store.load(tankSlot);
+
+  xTaskCreate(storeTask, "store", 4096, NULL, 1, &storeTaskHandle); // perf lines are formatted on its stack
+
+  /*
+   * Plan the draw buffers against a heap NimBLE has not touched yet,
+   * DRAW_BUF_RESERVE is what is left for it
+   */
+  if (!drawBufInit())
+  {
+    /* Nothing can be drawn without them, try again from a clean heap */
+    delay(1000);
+    esp_restart();
+  }
+
+  /* Start BLE next, scanning and connecting overlap with the display and UI setup below */
+  xTaskCreatePinnedToCore(obdTask, "obd", 6144, NULL, 3, &obdLoad.handle, OBD_CORE);
+
   tft.init();
   tft.initDMA();
   tft.startWrite();
   tft.fillScreen(0x0000);
+  bootMark("display ready");
 
   lv_init();
 
   lv_tick_set_cb(my_tick);
+#ifndef NO_RING_SPANS
+  ringUnitInit();
+  Timber.i("Ring spans: %u bytes of tables for %u px gauges",
+           (unsigned)(sizeof(gaugeIndicator) + sizeof(gaugeTrack)), GAUGE_SIZE);
+#endif
+#ifndef NO_GLYPH_UNIT
+  glyphUnitInit();
+#endif
 
 #if LV_USE_LOG != 0
   lv_log_register_print_cb(lv_log_print);
 #endif
 
   static lv_display_t *lv_display = lv_display_create(SCREEN_WIDTH, SCREEN_HEIGHT);
+#ifdef RENDER_L8
+  lv_display_set_color_format(lv_display, LV_COLOR_FORMAT_L8);
+#else
   lv_display_set_color_format(lv_display, LV_COLOR_FORMAT_RGB565_SWAPPED);
+#endif
   lv_display_set_flush_cb(lv_display, my_disp_flush);
-  lv_display_set_buffers(lv_display, lv_buffer[0], lv_buffer[1], LV_BUFFER_SIZE, LV_DISPLAY_RENDER_MODE_PARTIAL);
+  lv_display_set_flush_wait_cb(lv_display, flush_wait_cb);
+  lv_display_set_buffers(lv_display, lv_buffer[0], lv_buffer[1], drawBuf.bytes,
+                         LV_DISPLAY_RENDER_MODE_PARTIAL);
+  lv_display_add_event_cb(lv_display, on_render_start, LV_EVENT_RENDER_START, NULL);
+  lv_display_add_event_cb(lv_display, on_render_ready, LV_EVENT_RENDER_READY, NULL);
   lv_display_add_event_cb(lv_display, rounder_event_cb, LV_EVENT_INVALIDATE_AREA, NULL);
+  lv_display_add_event_cb(lv_display, on_refr_ready, LV_EVENT_REFR_READY, NULL);
+
+  touch_indev = lv_indev_create();
+  lv_indev_set_type(touch_indev, LV_INDEV_TYPE_POINTER);
+  lv_indev_set_read_cb(touch_indev, my_touchpad_read);
+#ifdef TOUCH_WAKE_PIN
+  /* Read on interrupt (and while pressed) rather than from a 33 ms timer */
+  lv_indev_set_mode(touch_indev, LV_INDEV_MODE_EVENT);
+  pinMode(TOUCH_WAKE_PIN, INPUT_PULLUP);
+  attachInterrupt(digitalPinToInterrupt(TOUCH_WAKE_PIN), touch_isr, FALLING);
+#endif
 
-  static lv_indev_t *lv_input = lv_indev_create();
-  lv_indev_set_type(lv_input, LV_INDEV_TYPE_POINTER);
-  lv_indev_set_read_cb(lv_input, my_touchpad_read);
-
+#if LV_USE_OS == LV_OS_NONE
   /* Create a mutex for LVGL */
   /* This mutex is used to protect the LVGL library from concurrent access */
   lvgl_mutex = xSemaphoreCreateRecursiveMutex();
+#else
+  Timber.i("LVGL: OS layer on, %d software draw units", LV_DRAW_SW_DRAW_UNIT_CNT);
+#endif
 
   int rotation = prefs.getInt("rotation", 0);
-  int brightness = prefs.getInt("brightness", 128);
-  int hud = prefs.getInt("hud", 0);
-  int restart = prefs.getInt("restart", 0);
 
-  should_restart = restart;
-
-  tft.setBrightness((uint8_t)brightness);
-  tft.setFlipMode(hud);
+  tft.setBrightness((uint8_t)settings.brightness);
+#ifdef SW_FLIP
+  swFlip = settings.hud & (XFORM_FLIP_X | XFORM_FLIP_Y);
+#else
+  tft.setFlipMode(settings.hud);
+#endif
   // #ifdef SW_ROTATION
   //   lv_display_set_rotation(lv_display, get_rotation(rotation));
   // #else
@@ -539,109 +2493,63 @@ void setup()
   // #endif
 
   hud_ui_init("");
+  /* Speed digit sprites, ~20 KB each at 150 px, only worth it in PSRAM */
+  digit_sprite_set_cache_limit(psramFound() ? DIGIT_SPRITE_CACHE : 0);
+
+  /* Before the observers, they resume it */
+  frame_timer = lv_timer_create(frame_cb, FRAME_INTERVAL, NULL);
+  perfInit();
 
   // lv_subject_set_int(&settings_rotation, rotation);
-  lv_subject_set_int(&settings_brightness, brightness);
-  lv_subject_set_int(&settings_hud, hud);
-  lv_subject_set_int(&settings_restart, restart);
+  lv_subject_set_int(&settings_brightness, settings.brightness);
+  lv_subject_set_int(&settings_hud, settings.hud);
+  lv_subject_set_int(&settings_restart, settings.restart);
+  lv_subject_set_int(&settings_tank, settings.tank);
+
+  publishTrip(TRIP_A, &trip_a);
+  publishTrip(TRIP_B, &trip_b);
+  publishTrip(TRIP_TOTAL, &trip_total);
 
   // lv_subject_add_observer(&settings_rotation, on_rotation_change, NULL);
   lv_subject_add_observer(&settings_brightness, on_brightness_change, NULL);
   lv_subject_add_observer(&settings_hud, on_hud_change, NULL);
   lv_subject_add_observer(&settings_restart, on_restart_change, NULL);
 
-  boot_screen = boot_create();
-  dashboard_screen = dashboard_create();
-  settings_screen = settings_create();
-
-  lv_obj_t *settings_back = lv_obj_find_by_name(settings_screen, "settings_back");
-  if (settings_back)
-  {
-    lv_obj_add_screen_load_event(settings_back, LV_EVENT_CLICKED, dashboard_screen,
-                                 LV_SCREEN_LOAD_ANIM_FADE_IN, 500, 0);
-  }
-
-  lv_obj_t *settings_restart = lv_obj_find_by_name(settings_screen, "settings_restart");
-  if (settings_restart)
+  if (show_boot)
   {
-    lv_obj_add_event_cb(settings_restart, on_restart_cb, LV_EVENT_CLICKED, NULL);
+    /* Get the logo on screen before building the rest */
+    lv_screen_load(screenGet(SCREEN_BOOT));
+    lv_refr_now(NULL);
   }
 
-  lv_obj_add_screen_load_event(boot_screen, LV_EVENT_SCREEN_LOADED, dashboard_screen,
-                               LV_SCREEN_LOAD_ANIM_FADE_IN, 500, 3000);
-  lv_obj_add_screen_load_event(dashboard_screen, LV_EVENT_LONG_PRESSED, settings_screen,
-                               LV_SCREEN_LOAD_ANIM_FADE_IN, 500, 0);
-  lv_obj_add_screen_load_event(settings_screen, LV_EVENT_LONG_PRESSED, dashboard_screen,
-                               LV_SCREEN_LOAD_ANIM_FADE_IN, 500, 0);
+  screenGet(SCREEN_DASHBOARD);
+  lv_subject_add_observer(&settings_tank, on_tank_change, NULL);
 
   if (show_boot)
   {
-    lv_screen_load(boot_screen);
+    /* Hand over on the first sample, or after BOOT_MAX_WAIT */
+    boot_timer = lv_timer_create(boot_timeout_cb, BOOT_MAX_WAIT, NULL);
+    lv_timer_set_repeat_count(boot_timer, 1);
   }
   else
   {
     lv_screen_load(dashboard_screen);
   }
+  reportScreens();
+#ifdef FONT_BENCH
+  fontBench();
+#endif
+  bootMark("UI built");
 
-  /* BLE Setup */
-  NimBLEDevice::init("");
-  NimBLEDevice::setPower(ESP_PWR_LVL_P9);
+#ifndef NO_FRAME_PACING
+  framePacingInit(lv_display);
+#endif
 
-  scan = NimBLEDevice::getScan();
-  scan->setScanCallbacks(new ScanCB());
-  scan->setActiveScan(true);
-  scan->start(0);
+  xTaskCreatePinnedToCore(uiTask, "ui", 8192, NULL, 2, &uiLoad.handle, UI_CORE);
 }
 
 void loop()
 {
-  LVGL_EXEC(lv_timer_handler()); // Update the UI
-  delay(5);
-
-  if (obdDevice && !client)
-  {
-    if (connectObd())
-    {
-      delay(500);
-      obdWrite(CMD_ATZ, sizeof(CMD_ATZ));
-      delay(300);
-      obdWrite(CMD_ATE0, sizeof(CMD_ATE0));
-      delay(300);
-      obdWrite(CMD_ATSP6, sizeof(CMD_ATSP6));
-    }
-  }
-
-  uint32_t now = millis();
-
-  if (!obdChar)
-    return;
-
-  // Fast-changing values
-  if (now - lastFast >= FAST_INTERVAL)
-  {
-    lastFast = now;
-
-    obdWrite(CMD_RPM, sizeof(CMD_RPM));
-  }
-
-  // medium-changing values
-  if (now - lastMedium >= MEDIUM_INTERVAL)
-  {
-    lastMedium = now;
-
-    delay(100);
-    obdWrite(CMD_SPEED, sizeof(CMD_SPEED));
-  }
-
-  // Slow-changing values
-  if (now - lastSlow >= SLOW_INTERVAL)
-  {
-    lastSlow = now;
-
-    delay(100);
-    obdWrite(CMD_FUEL, sizeof(CMD_FUEL));
-    delay(100);
-    obdWrite(CMD_TEMP, sizeof(CMD_TEMP));
-    delay(100);
-  }
+  /* Everything runs in obdTask and uiTask */
+  vTaskDelete(NULL);
 }
@@ -0,0 +1,153 @@
+/*
+ * Trace replay of the RPM estimator (include/estimator.hpp)
+ *
+ * Feeds RPM samples into SignalEstimator with the parameters the firmware
+ * uses and queries it at 60 fps, as frame_cb does. Prints the estimator's
+ * own error metrics (the value on screen when each sample arrived against
+ * that sample) and the largest step between two frames, next to holding the
+ * last sample as the dashboard did before.
+ *
+ *   g++ -O2 -std=gnu++17 -Iinclude tools/estimator_bench.cpp -o estimator_bench
+ *   ./estimator_bench                 a synthetic drive, also scored against the true signal
+ *   ./estimator_bench capture.log     a trace recorded with -D TRACE_SAMPLES
+ *
+ * A recorded trace is the serial log of a build with -D TRACE_SAMPLES; the
+ * "trace,<ms>,<pid>,<value>" lines of PID 0C are replayed, the rest of the
+ * log is skipped.
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <vector>
+#include "estimator.hpp"
+
+/* src/main.cpp: FAST_INTERVAL and rpmEstimator */
+static const uint32_t POLL = 100;
+static const uint32_t HORIZON = 2 * POLL;
+static const uint32_t FRAME = 16; // ms, 60 fps
+
+struct Sample
+{
+  uint32_t t;
+  float rpm;
+};
+
+/* Idle, pulls through three gears with shifts, lift off and back to idle */
+static float drive(float t)
+{
+  static const float knots[][2] = {{0, 800},     {2000, 800},   {5000, 5200}, {5300, 3100},
+                                   {8000, 5600}, {8300, 3600},  {11500, 5400}, {12500, 2500},
+                                   {14000, 2200}, {16000, 900}, {18000, 800}};
+  const size_t n = sizeof(knots) / sizeof(knots[0]);
+  if (t >= knots[n - 1][0])
+    return knots[n - 1][1];
+  size_t i = 0;
+  while (knots[i + 1][0] <= t)
+    i++;
+  /* Smoothstep between knots, an engine does not change rate instantly */
+  float u = (t - knots[i][0]) / (knots[i + 1][0] - knots[i][0]);
+  u = u * u * (3 - 2 * u);
+  return knots[i][1] + (knots[i + 1][1] - knots[i][1]) * u;
+}
+
+/* Polled every POLL ms plus the other PIDs, with 30-90 ms of BLE and ECU latency */
+static std::vector<Sample> syntheticTrace()
+{
+  std::vector<Sample> trace;
+  uint32_t seed = 7;
+  for (uint32_t sent = 0; sent < 18000;)
+  {
+    seed = seed * 1103515245u + 12345u;
+    uint32_t latency = 30 + (seed >> 8) % 60;
+    float rpm = floorf(drive((float)sent) * 4) / 4; // 0.25 rpm per bit
+    trace.push_back({sent + latency, rpm});
+    sent += POLL + (seed >> 16) % 60;
+  }
+  return trace;
+}
+
+static std::vector<Sample> readTrace(const char *path)
+{
+  std::vector<Sample> trace;
+  FILE *f = fopen(path, "r");
+  if (!f)
+  {
+    perror(path);
+    exit(1);
+  }
+  char line[256];
+  while (fgets(line, sizeof(line), f))
+  {
+    unsigned t, pid;
+    float value;
+    const char *p = line;
+    /* Timber prefixes every line, find the marker anywhere */
+    while (*p && sscanf(p, "trace,%u,%x,%f", &t, &pid, &value) != 3)
+      p++;
+    if (*p && pid == 0x0C)
+      trace.push_back({t, value});
+  }
+  fclose(f);
+  return trace;
+}
+
+int main(int argc, char **argv)
+{
+  bool synthetic = argc < 2;
+  std::vector<Sample> trace = synthetic ? syntheticTrace() : readTrace(argv[1]);
+  if (trace.size() < 2)
+  {
+    fprintf(stderr, "no RPM samples\n");
+    return 1;
+  }
+
+  SignalEstimator est(HORIZON, 0, 8000);
+  size_t next = 0;
+  float held = trace[0].rpm, prevEst = 0, prevHeld = 0;
+  float stepEst = 0, stepHeld = 0;
+  double trueEst = 0, trueHeld = 0;
+  float trueEstMax = 0, trueHeldMax = 0;
+  uint32_t frames = 0;
+
+  for (uint32_t t = trace[0].t; t <= trace.back().t; t += FRAME)
+  {
+    while (next < trace.size() && trace[next].t <= t)
+    {
+      est.addSample(trace[next].rpm, trace[next].t);
+      held = trace[next].rpm;
+      next++;
+    }
+    float e = est.estimate(t);
+    if (frames)
+    {
+      stepEst = fmaxf(stepEst, fabsf(e - prevEst));
+      stepHeld = fmaxf(stepHeld, fabsf(held - prevHeld));
+    }
+    prevEst = e;
+    prevHeld = held;
+    if (synthetic)
+    {
+      float truth = drive((float)t);
+      trueEst += fabsf(e - truth);
+      trueHeld += fabsf(held - truth);
+      trueEstMax = fmaxf(trueEstMax, fabsf(e - truth));
+      trueHeldMax = fmaxf(trueHeldMax, fabsf(held - truth));
+    }
+    frames++;
+  }
+
+  printf("%s: %u samples over %.1f s, horizon %u ms\n", synthetic ? "synthetic drive" : argv[1],
+         (unsigned)trace.size(), (trace.back().t - trace[0].t) / 1000.0f, HORIZON);
+  printf("  at each sample: mae %.1f rpm, max %.1f rpm (%u scored)\n", est.meanAbsError(),
+         est.maxAbsError(), est.sampleCount());
+  printf("  largest step between frames: estimator %.0f rpm, last sample held %.0f rpm\n", stepEst,
+         stepHeld);
+  if (synthetic)
+  {
+    printf("  against the true signal at 60 fps: estimator mae %.1f max %.1f rpm, "
+           "held mae %.1f max %.1f rpm\n",
+           trueEst / frames, trueEstMax, trueHeld / frames, trueHeldMax);
+  }
+  return 0;
+}
@@ -0,0 +1,667 @@
+#!/usr/bin/env python3
+"""
+Subset and compress the dashboard fonts.
+
+The editor exports every <bin> font of lib/hud_ui/globals.xml with its full
+range and without compression. This keeps only the glyphs the screens can
+show: static texts, dropdown options, the literal part of the `bind_text-fmt`
+strings and what their conversions can produce, and the strings the firmware
+formats itself (CODE_TEXT below). The fonts/*_data.c files are rewritten in
+place, in the same lv_font_conv layout.
+
+With --compress the bitmaps of all fonts, or of the ones named, use LVGL's
+RLE format with the line prefilter (LV_USE_FONT_COMPRESSED must be on) and
+draw through the decoded glyph cache of fonts/glyph_cache.c. The report
+shows both sizes and the pixels every glyph decode has to produce.
+
+The glyphs kept are also written to the `range` and `symbols` of every
+<bin> in globals.xml, so the editor exports the subset next time rather than
+the full range. The build runs this before compiling (tools/pio_fonts.py,
+with the fonts to compress from `custom_font_compress` in platformio.ini) and
+fails when a glyph is missing. A glyph missing from an already subset file
+means the font has to be exported again first. Files are only written when
+they change.
+
+    python3 tools/font_subset.py [--compress [FONT ...]] [--dry-run]
+"""
+
+import argparse
+import os
+import re
+import sys
+import xml.etree.ElementTree as ET
+from xml.sax.saxutils import quoteattr
+
+ROOT = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "lib", "hud_ui")
+
+DIGITS = "0123456789"
+
+# Text the firmware sets on string subjects, by subject name
+CODE_TEXT = {
+    # publishTrip() in src/main.cpp: "%.1f km  %.1f L  %.1f L/100km"
+    "trip_a": DIGITS + "-. kmL/",
+    "trip_b": DIGITS + "-. kmL/",
+    "trip_total": DIGITS + "-. kmL",
+}
+
+# Characters a printf conversion can produce
+CONVERSIONS = {
+    "d": DIGITS + "-",
+    "i": DIGITS + "-",
+    "u": DIGITS,
+    "x": DIGITS + "abcdef",
+    "X": DIGITS + "ABCDEF",
+    "f": DIGITS + "-.",
+    "c": "",
+    "s": "",
+}
+
+# Default format of a subject bound with bind_text and no bind_text-fmt
+DEFAULT_FMT = {"int": "%d", "float": "%0.1f", "string": "%s"}
+
+GLYPH_DSC_SIZE = 8  # lv_font_fmt_txt_glyph_dsc_t
+CMAP_SIZE = 20  # lv_font_fmt_txt_cmap_t on a 32 bit target
+
+
+# ---------- TEXT SCAN ----------
+
+
+class Scan:
+    """Collects the characters every font has to provide"""
+
+    def __init__(self, fonts, subjects):
+        self.fonts = fonts
+        self.subjects = subjects
+        self.chars = {name: set() for name in fonts}
+        self.styles = {}
+
+    def add_styles(self, root):
+        styles = root.find("styles")
+        if styles is not None:
+            for style in styles.findall("style"):
+                if style.get("text_font"):
+                    self.styles[style.get("name")] = style.get("text_font")
+
+    def format_chars(self, fmt, subject):
+        out = set()
+        i = 0
+        while i < len(fmt):
+            c = fmt[i]
+            if c != "%":
+                out.add(c)
+                i += 1
+                continue
+            m = re.match(r"%[-+ #0]*\d*(?:\.\d+)?(?:l|ll|h)?([a-zA-Z%])", fmt[i:])
+            if not m:
+                out.add(c)
+                i += 1
+                continue
+            conv = m.group(1)
+            if conv == "%":
+                out.add("%")
+            elif conv == "s":
+                out |= set(self.subjects.get(subject, ("string", ""))[1])
+                out |= set(CODE_TEXT.get(subject, ""))
+            else:
+                out |= set(CONVERSIONS.get(conv, ""))
+            i += len(m.group(0))
+        return out
+
+    def element_text(self, el):
+        out = set()
+        if el.get("text"):
+            out |= set(el.get("text"))
+        if el.get("options"):
+            out |= set(el.get("options").replace("\n", ""))
+        subject = el.get("bind_text")
+        if subject:
+            kind = self.subjects.get(subject, ("int", ""))[0]
+            fmt = el.get("bind_text-fmt") or DEFAULT_FMT.get(kind, "%d")
+            out |= self.format_chars(fmt, subject)
+        if el.tag == "digit_sprite" and (el.get("bind_value") or el.get("value")):
+            out |= set(DIGITS + "-")
+        return out
+
+    def walk(self, el, font, where):
+        own = set()
+        for child in el.findall("style"):
+            name = self.styles.get(child.get("name"))
+            if not name:
+                continue
+            own.add(name)
+            if child.get("selector", "main") in ("main", "default"):
+                font = name
+        if el.get("style_text_font"):
+            font = el.get("style_text_font")
+        own.add(font)
+
+        text = self.element_text(el)
+        if text:
+            for name in own:
+                if name is None:
+                    print(f"warning: no font known for text in {where}", file=sys.stderr)
+                elif name in self.chars:
+                    self.chars[name] |= text
+
+        for child in el:
+            if child.tag != "style":
+                self.walk(child, font, where)
+
+    def scan(self, path):
+        root = ET.parse(path).getroot()
+        self.add_styles(root)
+        view = root.find("view")
+        if view is not None:
+            self.walk(view, None, os.path.relpath(path, ROOT))
+
+
+def load_globals():
+    root = ET.parse(os.path.join(ROOT, "globals.xml")).getroot()
+    fonts = {}
+    for bin in root.iter("bin"):
+        fonts[bin.get("name")] = int(bin.get("bpp", "4"))
+    subjects = {}
+    for node in root.find("subjects"):
+        subjects[node.get("name")] = (node.tag, node.get("value", ""))
+    return root, fonts, subjects
+
+
+def scan_texts():
+    groot, fonts, subjects = load_globals()
+    scan = Scan(fonts, subjects)
+    scan.add_styles(groot)
+
+    paths = []
+    for folder in ("components", "widgets", "screens"):
+        for dirpath, _, files in sorted(os.walk(os.path.join(ROOT, folder))):
+            paths += [os.path.join(dirpath, f) for f in sorted(files) if f.endswith(".xml")]
+    for path in paths:
+        scan.add_styles(ET.parse(path).getroot())
+    for path in paths:
+        scan.scan(path)
+    return fonts, scan.chars
+
+
+# ---------- LVGL RLE ----------
+
+
+class BitWriter:
+    def __init__(self):
+        self.out = bytearray()
+        self.acc = 0
+        self.n = 0
+
+    def put(self, value, bits):
+        self.acc = (self.acc << bits) | value
+        self.n += bits
+        while self.n >= 8:
+            self.n -= 8
+            self.out.append((self.acc >> self.n) & 0xFF)
+        self.acc &= (1 << self.n) - 1
+
+    def bytes(self):
+        if self.n:
+            return bytes(self.out) + bytes([(self.acc << (8 - self.n)) & 0xFF])
+        return bytes(self.out)
+
+
+def rle_encode(values, bpp):
+    """Encode for rle_next() of lv_font_fmt_txt.c, state for state"""
+    bits = BitWriter()
+    single = True
+    prev = 0
+    cnt = 0
+    i = 0
+    n = len(values)
+    while i < n:
+        v = values[i]
+        if single:
+            bits.put(v, bpp)
+            if i and v == prev:
+                single = False
+                cnt = 0
+            prev = v
+            i += 1
+            continue
+
+        cnt += 1
+        if v != prev:
+            bits.put(0, 1)
+            bits.put(v, bpp)
+            prev = v
+            single = True
+            i += 1
+            continue
+
+        bits.put(1, 1)
+        i += 1
+        if cnt < 11:
+            continue
+
+        # 11 repeats spelled out, a counter for the rest
+        run = 0
+        while i + run < n and values[i + run] == prev and run < 62:
+            run += 1
+        bits.put(run + 1, 6)
+        i += run
+        if i < n:
+            prev = values[i]
+            bits.put(prev, bpp)
+            i += 1
+        single = True
+    return bits.bytes()
+
+
+def rle_decode(data, count, bpp):
+    """Straight port of rle_next(), to check the encoder"""
+
+    def get(pos, length):
+        word = int.from_bytes(data[pos >> 3:(pos >> 3) + 2].ljust(2, b"\0"), "big")
+        return (word >> (16 - (pos & 7) - length)) & ((1 << length) - 1)
+
+    out = []
+    state = "single"
+    rdp = 0
+    prev = 0
+    cnt = 0
+    for _ in range(count):
+        if state == "single":
+            ret = get(rdp, bpp)
+            if rdp != 0 and prev == ret:
+                cnt = 0
+                state = "repeat"
+            prev = ret
+            rdp += bpp
+        elif state == "repeat":
+            v = get(rdp, 1)
+            cnt += 1
+            rdp += 1
+            if v == 1:
+                ret = prev
+                if cnt == 11:
+                    cnt = get(rdp, 6)
+                    rdp += 6
+                    if cnt != 0:
+                        state = "counter"
+                    else:
+                        ret = get(rdp, bpp)
+                        prev = ret
+                        rdp += bpp
+                        state = "single"
+            else:
+                ret = get(rdp, bpp)
+                prev = ret
+                rdp += bpp
+                state = "single"
+        else:
+            ret = prev
+            cnt -= 1
+            if cnt == 0:
+                ret = get(rdp, bpp)
+                prev = ret
+                rdp += bpp
+                state = "single"
+        out.append(ret)
+    return out
+
+
+def prefilter(values, w, h):
+    out = list(values[:w])
+    for y in range(1, h):
+        out += [values[y * w + x] ^ values[(y - 1) * w + x] for x in range(w)]
+    return out
+
+
+def unfilter(values, w, h):
+    out = list(values[:w])
+    for y in range(1, h):
+        out += [values[y * w + x] ^ out[(y - 1) * w + x] for x in range(w)]
+    return out
+
+
+def compress(values, w, h, bpp):
+    data = rle_encode(prefilter(values, w, h), bpp)
+    if unfilter(rle_decode(data, w * h, bpp), w, h) != values:
+        raise RuntimeError("RLE round trip failed")
+    return data
+
+
+def pack(values, bpp):
+    bits = BitWriter()
+    for v in values:
+        bits.put(v, bpp)
+    return bits.bytes()
+
+
+def unpack(data, count, bpp):
+    mask = (1 << bpp) - 1
+    out = []
+    for i in range(count):
+        pos = i * bpp
+        out.append((data[pos >> 3] >> (8 - (pos & 7) - bpp)) & mask)
+    return out
+
+
+# ---------- FONT FILE ----------
+
+GLYPH_RE = re.compile(
+    r"\{\.bitmap_index = (\d+), \.adv_w = (\d+), \.box_w = (\d+), \.box_h = (\d+), "
+    r"\.ofs_x = (-?\d+), \.ofs_y = (-?\d+)\}"
+)
+CMAP_RE = re.compile(
+    r"\.range_start = (\d+), \.range_length = (\d+), \.glyph_id_start = (\d+),\s*"
+    r"\.unicode_list = (\w+), \.glyph_id_ofs_list = NULL, \.list_length = (\d+), "
+    r"\.type = LV_FONT_FMT_TXT_CMAP_(\w+)"
+)
+
+
+def section(text, start, end):
+    a = text.index(start)
+    b = text.index(end, a)
+    return a, b
+
+
+def int_array(text, name):
+    m = re.search(r"\b" + name + r"\[\] =\s*\{(.*?)\};", text, re.S)
+    body = re.sub(r"/\*.*?\*/", "", m.group(1), flags=re.S)
+    return [int(v, 0) for v in re.findall(r"-?0x[0-9a-fA-F]+|-?\d+", body)]
+
+
+class Glyph:
+    def __init__(self, code, adv_w, w, h, ofs_x, ofs_y, values):
+        self.code = code
+        self.adv_w = adv_w
+        self.w = w
+        self.h = h
+        self.ofs_x = ofs_x
+        self.ofs_y = ofs_y
+        self.values = values
+
+
+class FontFile:
+    def __init__(self, path, bpp):
+        self.path = path
+        self.bpp = bpp
+        with open(path, encoding="utf-8") as f:
+            self.text = f.read()
+
+        self.format = int(re.search(r"\.bitmap_format = (\d+)", self.text).group(1))
+        if self.format not in (0, 1):
+            raise RuntimeError(f"{path}: bitmap format {self.format} not supported")
+
+        bitmap = bytes(int_array(self.text, "glyph_bitmap"))
+        dscs = [tuple(int(v) for v in m.groups()) for m in GLYPH_RE.finditer(self.text)]
+
+        codes = {}
+        for start, length, gid, ulist, count, kind in (m.groups() for m in CMAP_RE.finditer(self.text)):
+            start, length, gid, count = int(start), int(length), int(gid), int(count)
+            if kind == "FORMAT0_TINY":
+                offsets = range(length)
+            elif kind == "SPARSE_TINY":
+                offsets = int_array(self.text, ulist)
+            else:
+                raise RuntimeError(f"{path}: cmap type {kind} not supported")
+            for i, ofs in enumerate(offsets):
+                codes[gid + i] = start + ofs
+
+        # Compressed glyphs end where the next one starts
+        starts = sorted({d[0] for d in dscs[1:] if d[2] * d[3]}) + [len(bitmap)]
+        self.glyphs = {}
+        for gid, (index, adv_w, w, h, ofs_x, ofs_y) in enumerate(dscs):
+            if gid == 0:
+                continue
+            values = []
+            if w * h:
+                if self.format == 0:
+                    values = unpack(bitmap[index:], w * h, bpp)
+                else:
+                    end = starts[starts.index(index) + 1]
+                    values = unfilter(rle_decode(bitmap[index:end], w * h, bpp), w, h)
+            self.glyphs[codes[gid]] = Glyph(codes[gid], adv_w, w, h, ofs_x, ofs_y, values)
+
+        self.kern = []
+        if "kern_pair_glyph_ids" in self.text:
+            ids = int_array(self.text, "kern_pair_glyph_ids")
+            vals = int_array(self.text, "kern_pair_values")
+            for i, v in enumerate(vals):
+                self.kern.append((codes[ids[2 * i]], codes[ids[2 * i + 1]], v))
+        m = re.search(r"\.kern_scale = (\d+)", self.text)
+        self.kern_scale = int(m.group(1))
+
+    def flash_size(self):
+        """Bytes of const data, as the file stands"""
+        bitmap = len(int_array(self.text, "glyph_bitmap"))
+        glyphs = len(GLYPH_RE.findall(self.text))
+        cmaps = CMAP_RE.findall(self.text)
+        lists = sum(2 * int(c[4]) for c in cmaps)
+        m = re.search(r"\.pair_cnt = (\d+)", self.text)
+        kern = 3 * int(m.group(1)) if m else 0
+        return bitmap, bitmap + glyphs * GLYPH_DSC_SIZE + len(cmaps) * CMAP_SIZE + lists + kern
+
+    def write(self, codes, compressed, note):
+        codes = sorted(codes)
+        gids = {code: i + 1 for i, code in enumerate(codes)}
+        text = self.text
+
+        # Bitmaps and descriptors
+        lines = []
+        dscs = ["    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */"]
+        index = 0
+        for code in codes:
+            g = self.glyphs[code]
+            char = chr(code).replace("\\", "\\\\").replace('"', '\\"')
+            lines.append(f'    /* U+{code:04X} "{char}" */')
+            data = b""
+            if g.values:
+                data = compress(g.values, g.w, g.h, self.bpp) if compressed else pack(g.values, self.bpp)
+            for i in range(0, len(data), 8):
+                lines.append("    " + ", ".join(hex(b) for b in data[i:i + 8]) + ",")
+            lines.append("")
+            dscs.append(
+                f"    {{.bitmap_index = {index}, .adv_w = {g.adv_w}, .box_w = {g.w}, .box_h = {g.h}, "
+                f".ofs_x = {g.ofs_x}, .ofs_y = {g.ofs_y}}}"
+            )
+            index += len(data)
+        while lines and lines[-1] == "":
+            lines.pop()
+        if lines[-1].endswith(","):
+            lines[-1] = lines[-1][:-1]
+
+        a = text.index("glyph_bitmap[] = {") + len("glyph_bitmap[] = {")
+        b = text.index("};", a)
+        text = text[:a] + "\n" + "\n".join(lines) + "\n" + text[b:]
+
+        a = text.index("glyph_dsc[] = {") + len("glyph_dsc[] = {")
+        b = text.index("};", a)
+        text = text[:a] + "\n" + ",\n".join(dscs) + "\n" + text[b:]
+
+        # Character mapping: long runs are FORMAT0, the gaps between them one sparse list each
+        runs = []
+        for code in codes:
+            if runs and runs[-1][-1] == code - 1:
+                runs[-1].append(code)
+            else:
+                runs.append([code])
+        cmaps = []
+        for run in runs:
+            if len(run) >= 4 or not cmaps or cmaps[-1][0] == "FORMAT0_TINY":
+                kind = "FORMAT0_TINY" if len(run) >= 4 else "SPARSE_TINY"
+                cmaps.append((kind, list(run)))
+            else:
+                cmaps[-1][1].extend(run)
+        for i, (kind, run) in enumerate(cmaps):
+            if kind == "SPARSE_TINY" and run[-1] - run[0] + 1 == len(run):
+                cmaps[i] = ("FORMAT0_TINY", run)
+
+        lists = []
+        entries = []
+        for i, (kind, run) in enumerate(cmaps):
+            ulist = "NULL"
+            count = 0
+            if kind == "SPARSE_TINY":
+                ulist = f"unicode_list_{i}"
+                count = len(run)
+                offsets = [hex(c - run[0]) for c in run]
+                body = ",\n".join("    " + ", ".join(offsets[j:j + 8]) for j in range(0, len(offsets), 8))
+                lists.append(f"static const uint16_t {ulist}[] = {{\n{body}\n}};\n")
+            entries.append(
+                "    {\n"
+                f"        .range_start = {run[0]}, .range_length = {run[-1] - run[0] + 1}, "
+                f".glyph_id_start = {gids[run[0]]},\n"
+                f"        .unicode_list = {ulist}, .glyph_id_ofs_list = NULL, .list_length = {count}, "
+                f".type = LV_FONT_FMT_TXT_CMAP_{kind}\n"
+                "    }"
+            )
+        a, b = section(text, " *  CHARACTER MAPPING\n *--------------------*/\n", "/*-----------------\n *    KERNING")
+        a += len(" *  CHARACTER MAPPING\n *--------------------*/\n")
+        text = (
+            text[:a] + "\n" + "\n".join(lists) + "\n\n"
+            "/*Collect the unicode lists and glyph_id offsets*/\n"
+            "static const lv_font_fmt_txt_cmap_t cmaps[] =\n{\n" + ",\n".join(entries) + "\n};\n\n" + text[b:]
+        )
+        text = re.sub(r"\.cmap_num = \d+", f".cmap_num = {len(cmaps)}", text)
+
+        # Kerning between the glyphs left
+        pairs = [(gids[l], gids[r], v) for l, r, v in self.kern if l in gids and r in gids]
+        a, b = section(text, "/*-----------------\n *    KERNING", "/*--------------------\n *  ALL CUSTOM DATA")
+        a = text.index("*/\n", a) + 3
+        kern = "\n\n"
+        if pairs:
+            ids = ",\n".join(f"    {l}, {r}" for l, r, _ in pairs)
+            vals = [str(v) for _, _, v in pairs]
+            vals = ",\n".join("    " + ", ".join(vals[j:j + 8]) for j in range(0, len(vals), 8))
+            kern += (
+                "/*Pair left and right glyphs for kerning*/\n"
+                f"static const uint8_t kern_pair_glyph_ids[] =\n{{\n{ids}\n}};\n\n"
+                "/* Kerning between the respective left and right glyphs\n"
+                " * 4.4 format which needs to scaled with `kern_scale`*/\n"
+                f"static const int8_t kern_pair_values[] =\n{{\n{vals}\n}};\n\n"
+                "/*Collect the kern pair's data in one place*/\n"
+                "static const lv_font_fmt_txt_kern_pair_t kern_pairs =\n{\n"
+                "    .glyph_ids = kern_pair_glyph_ids,\n"
+                "    .values = kern_pair_values,\n"
+                f"    .pair_cnt = {len(pairs)},\n"
+                "    .glyph_ids_size = 0\n};\n\n"
+            )
+        text = text[:a] + kern + text[b:]
+        if pairs:
+            text = re.sub(r"\.kern_dsc = \w+,", ".kern_dsc = &kern_pairs,", text)
+            text = re.sub(r"\.kern_scale = \d+", f".kern_scale = {self.kern_scale}", text)
+        else:
+            text = re.sub(r"\.kern_dsc = &?\w+,", ".kern_dsc = NULL,", text)
+            text = re.sub(r"\.kern_scale = \d+", ".kern_scale = 0", text)
+
+        # Format and bitmap getter
+        text = re.sub(r"\.bitmap_format = \d+", f".bitmap_format = {1 if compressed else 0}", text)
+        getter = "glyph_cache_get_bitmap" if compressed else "lv_font_get_bitmap_fmt_txt"
+        text = re.sub(r"\.get_glyph_bitmap = \w+,", f".get_glyph_bitmap = {getter},", text)
+        text = re.sub(r'\n#include "glyph_cache.h"\n', "\n", text)
+        if compressed:
+            text = text.replace('#include "lvgl/lvgl.h"\n#endif\n', '#include "lvgl/lvgl.h"\n#endif\n#include "glyph_cache.h"\n', 1)
+
+        text = re.sub(r" \* Subset: .*\n", "", text)
+        text = text.replace(" * Opts:", f" * Subset: {note}\n * Opts:", 1) if " * Opts:" in text else text
+
+        self.text = text
+
+
+# ---------- GLOBALS ----------
+
+
+def bin_ranges(chars):
+    """`range` and `symbols` of a <bin> exporting exactly these characters"""
+    codes = sorted(ord(c) for c in chars)
+    runs = []
+    for code in codes:
+        if runs and runs[-1][1] == code - 1:
+            runs[-1][1] = code
+        else:
+            runs.append([code, code])
+    ranges = [f"0x{a:02X}-0x{b:02X}" for a, b in runs if b - a >= 3]
+    symbols = "".join(chr(c) for a, b in runs if b - a < 3 for c in range(a, b + 1))
+    return ",".join(ranges), symbols
+
+
+def update_globals(chars):
+    """Set the export range of every <bin> font to its subset, the new text or None if unchanged"""
+    path = os.path.join(ROOT, "globals.xml")
+    with open(path, encoding="utf-8") as f:
+        text = f.read()
+
+    def repl(m):
+        tag = m.group(0)
+        name = re.search(r'\bname="([^"]*)"', tag).group(1)
+        if name not in chars:
+            return tag
+        ranges, symbols = bin_ranges(chars[name])
+        for attr, value in (("range", ranges), ("symbols", symbols)):
+            tag = re.sub(r'\b' + attr + r'=("[^"]*"|\'[^\']*\')', f"{attr}={quoteattr(value)}", tag)
+        return tag
+
+    new = re.sub(r"<bin\b.*?/>", repl, text, flags=re.S)
+    if new == text:
+        return None
+    with open(path, "w", encoding="utf-8") as f:
+        f.write(new)
+    return new
+
+
+# ---------- MAIN ----------
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+    parser.add_argument(
+        "--compress", nargs="*", metavar="FONT", help="RLE compressed bitmaps drawn through the glyph cache, all fonts or the ones named"
+    )
+    parser.add_argument("--dry-run", action="store_true", help="print the report, write nothing")
+    args = parser.parse_args()
+
+    fonts, chars = scan_texts()
+    print(f"{'font':<20}{'glyphs':>12}{'flash':>22}{'plain':>9}{'rle':>8}{'px/glyph':>10}{'rle bits/px':>13}")
+
+    failed = False
+    total_before = total_after = 0
+    for name, bpp in fonts.items():
+        path = os.path.join(ROOT, "fonts", f"{name}_data.c")
+        font = FontFile(path, bpp)
+        original = font.text
+        need = {ord(c) for c in chars[name]}
+        missing = sorted(need - set(font.glyphs))
+        if missing:
+            print(f"{name}: missing {' '.join(f'U+{c:04X}' for c in missing)}, export the font again", file=sys.stderr)
+            failed = True
+            continue
+
+        glyphs = [font.glyphs[c] for c in need if font.glyphs[c].values]
+        pixels = sum(g.w * g.h for g in glyphs)
+        plain = sum(len(pack(g.values, bpp)) for g in glyphs)
+        rle = sum(len(compress(g.values, g.w, g.h, bpp)) for g in glyphs)
+
+        _, before = font.flash_size()
+        count = len(font.glyphs)
+        text = "".join(chr(c) for c in sorted(need)).replace("*/", "* /").replace('"', '\\"')
+        compressed = args.compress is not None and (not args.compress or name in args.compress)
+        note = f'tools/font_subset.py{" --compress" if compressed else ""} "{text}"'
+        font.write(need, compressed, note)
+        _, after = font.flash_size()
+        total_before += before
+        total_after += after
+
+        print(
+            f"{name:<20}{count:>5} -> {len(need):<4}{before:>10} -> {after:<8}{plain:>9}{rle:>8}"
+            f"{pixels // max(len(glyphs), 1):>10}{8 * rle / max(pixels, 1):>13.2f}"
+        )
+        if not args.dry_run and font.text != original:
+            with open(path, "w", encoding="utf-8") as f:
+                f.write(font.text)
+
+    if total_before:
+        print(f"{'total':<32}{total_before:>10} -> {total_after:<8}({total_before - total_after} bytes saved)")
+    if not failed and not args.dry_run and update_globals(chars):
+        print("globals.xml: export ranges set to the subsets")
+    return 1 if failed else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,285 @@
+/*
+ * Host benchmark of the glyph draw unit (include/glyph_blit.hpp)
+ *
+ * Draws a frame of antialiased text in the way LVGL's software renderer
+ * blends a mask (read every pixel, mix) and with glyphBlit, checks the two
+ * frames are the same to the bit in both byte orders, and times them. Some
+ * of the text lies over a gray bar and a ring, so the mixing path is
+ * checked too. Every mask value over every background is checked as well.
+ *
+ *   g++ -O2 -std=gnu++17 -Iinclude tools/glyph_bench.cpp -o glyph_bench
+ *
+ * Built with -DGLYPH_BENCH_LVGL and linked with LVGL, the golden frames are
+ * drawn by LVGL's software renderer instead, each glyph an A8 image recolored
+ * as LVGL draws a label's letters, and the mix is also checked against
+ * lv_color_16_16_mix over every background, for 16 colors;
+ * tools/lvgl_benches.sh builds LVGL for the host and runs it that way.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "glyph_blit.hpp"
+#ifdef GLYPH_BENCH_LVGL
+#include "lvgl/lvgl.h"
+#endif
+
+static const int32_t SIZE = 466;
+static const int32_t GLYPH_W = 24;
+static const int32_t GLYPH_H = 40;
+
+static double now()
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/* What lv_draw_sw_blend does for a color over an A8 mask at full opacity */
+static void blendGeneric(uint16_t *dst, int32_t dstStride, const uint8_t *mask, int32_t maskStride,
+                         int32_t w, int32_t h, uint16_t color, bool swapped)
+{
+  for (int32_t y = 0; y < h; y++, dst += dstStride, mask += maskStride)
+  {
+    for (int32_t x = 0; x < w; x++)
+    {
+      if (swapped)
+        dst[x] = glyphSwap(glyphMix(color, glyphSwap(dst[x]), mask[x]));
+      else
+        dst[x] = glyphMix(color, dst[x], mask[x]);
+    }
+  }
+}
+
+/* A soft edged seven segment digit, enough like a glyph for the mask statistics */
+static void makeGlyph(uint8_t *mask, int digit)
+{
+  static const uint8_t segs[10] = {0x3F, 0x06, 0x5B, 0x4F, 0x66, 0x6D, 0x7D, 0x07, 0x7F, 0x6F};
+  /* a b c d e f g as x1 y1 x2 y2 in quarter pixels */
+  static const int32_t boxes[7][4] = {{16, 8, 80, 24},   {72, 16, 88, 76},  {72, 84, 88, 144},
+                                      {16, 136, 80, 152}, {8, 84, 24, 144},  {8, 16, 24, 76},
+                                      {16, 72, 80, 88}};
+  for (int32_t y = 0; y < GLYPH_H; y++)
+  {
+    for (int32_t x = 0; x < GLYPH_W; x++)
+    {
+      int32_t cover = 0;
+      for (int32_t s = 0; s < 7; s++)
+      {
+        if (!(segs[digit] >> s & 1))
+          continue;
+        /* 4x4 samples per pixel */
+        for (int32_t sy = 0; sy < 4; sy++)
+          for (int32_t sx = 0; sx < 4; sx++)
+          {
+            int32_t px = x * 4 + sx, py = y * 4 + sy;
+            cover += px >= boxes[s][0] && px < boxes[s][2] && py >= boxes[s][1] && py < boxes[s][3];
+          }
+      }
+      cover = cover * 255 / 16;
+      mask[y * GLYPH_W + x] = (uint8_t)(cover > 255 ? 255 : cover);
+    }
+  }
+}
+
+/* Black with a gray bar and a ring, the places text does not lie on black */
+static void background(uint16_t *frame, bool swapped)
+{
+  memset(frame, 0, SIZE * SIZE * 2);
+  uint16_t gray = swapped ? glyphSwap(0x4208) : 0x4208;
+  uint16_t red = swapped ? glyphSwap(0xF800) : 0xF800;
+  for (int32_t y = 300; y < 330; y++)
+    for (int32_t x = 0; x < SIZE; x++)
+      frame[y * SIZE + x] = gray;
+  for (int32_t y = 0; y < SIZE; y++)
+  {
+    for (int32_t x = 0; x < SIZE; x++)
+    {
+      int32_t dx = x - SIZE / 2, dy = y - SIZE / 2, d = dx * dx + dy * dy;
+      if (d > 200 * 200 && d < 230 * 230)
+        frame[y * SIZE + x] = red;
+    }
+  }
+}
+
+/* Rows of digits across the frame, each pass of `blit` one glyph */
+template <typename Blit>
+static void drawText(uint16_t *frame, uint8_t *const glyphs[10], Blit blit)
+{
+  int n = 0;
+  for (int32_t y = 10; y + GLYPH_H < SIZE; y += GLYPH_H + 6)
+    for (int32_t x = 10; x + GLYPH_W < SIZE; x += GLYPH_W + 2)
+      blit(frame + y * SIZE + x, glyphs[n++ % 10]);
+}
+
+#ifdef GLYPH_BENCH_LVGL
+/* The golden frame as LVGL's software renderer draws the text into a canvas */
+static void drawLvgl(uint16_t *frame, uint8_t *const glyphs[10], bool swapped)
+{
+  lv_color_format_t cf = swapped ? LV_COLOR_FORMAT_RGB565_SWAPPED : LV_COLOR_FORMAT_RGB565;
+  lv_obj_t *canvas = lv_canvas_create(lv_screen_active());
+  lv_draw_buf_t *draw_buf = lv_draw_buf_create(SIZE, SIZE, cf, LV_STRIDE_AUTO);
+  lv_canvas_set_draw_buf(canvas, draw_buf);
+  background(frame, swapped);
+  for (int32_t y = 0; y < SIZE; y++)
+    memcpy(lv_draw_buf_goto_xy(draw_buf, 0, y), frame + y * SIZE, SIZE * 2);
+
+  lv_image_dsc_t images[10];
+  for (int d = 0; d < 10; d++)
+  {
+    memset(&images[d], 0, sizeof(images[d]));
+    images[d].header.magic = LV_IMAGE_HEADER_MAGIC;
+    images[d].header.cf = LV_COLOR_FORMAT_A8;
+    images[d].header.w = GLYPH_W;
+    images[d].header.h = GLYPH_H;
+    images[d].header.stride = GLYPH_W;
+    images[d].data_size = GLYPH_W * GLYPH_H;
+    images[d].data = glyphs[d];
+  }
+  lv_layer_t layer;
+  lv_canvas_init_layer(canvas, &layer);
+  drawText(frame, glyphs, [&](uint16_t *dst, const uint8_t *mask) {
+    int32_t at = (int32_t)(dst - frame);
+    lv_draw_image_dsc_t dsc;
+    lv_draw_image_dsc_init(&dsc);
+    for (int d = 0; d < 10; d++)
+      if (glyphs[d] == mask)
+        dsc.src = &images[d];
+    dsc.recolor = lv_color_white();
+    dsc.recolor_opa = LV_OPA_COVER;
+    lv_area_t coords = {at % SIZE, at / SIZE, at % SIZE + GLYPH_W - 1, at / SIZE + GLYPH_H - 1};
+    lv_draw_image(&layer, &dsc, &coords);
+  });
+  lv_canvas_finish_layer(canvas, &layer);
+
+  for (int32_t y = 0; y < SIZE; y++)
+    memcpy(frame + y * SIZE, lv_draw_buf_goto_xy(draw_buf, 0, y), SIZE * 2);
+  lv_obj_delete(canvas);
+  lv_draw_buf_destroy(draw_buf);
+}
+#endif
+
+static uint32_t fnv(const uint16_t *frame)
+{
+  uint32_t h = 2166136261u;
+  const uint8_t *b = (const uint8_t *)frame;
+  for (int32_t i = 0; i < SIZE * SIZE * 2; i++)
+    h = (h ^ b[i]) * 16777619u;
+  return h;
+}
+
+int main()
+{
+  int failed = 0;
+
+  /* Every mask value over every background, one pixel at a time */
+  static const uint16_t colors[] = {0xFFFF, 0x07E0, 0xFD20, 0x1234};
+  uint16_t lut[256];
+  for (uint16_t color : colors)
+  {
+    for (int swapped = 0; swapped < 2; swapped++)
+    {
+      uint16_t c = swapped ? glyphSwap(color) : color;
+      glyphTable(lut, color, swapped);
+      for (uint32_t bg = 0; bg < 65536; bg++)
+      {
+        for (uint32_t a = 0; a < 256; a++)
+        {
+          uint16_t want = (uint16_t)bg, got = (uint16_t)bg;
+          uint8_t m = (uint8_t)a;
+          blendGeneric(&want, 1, &m, 1, 1, 1, color, swapped);
+          glyphBlit(&got, 1, &m, 1, 1, 1, lut, c, swapped);
+          if (want != got)
+          {
+            if (failed++ < 5)
+              printf("FAIL color %04x%s bg %04x mask %u: %04x, LVGL %04x\n", color,
+                     swapped ? " swapped" : "", bg, a, got, want);
+          }
+        }
+      }
+    }
+  }
+
+#ifdef GLYPH_BENCH_LVGL
+  for (uint32_t fg = 0; fg < 65536; fg += 4099)
+    for (uint32_t bg = 0; bg < 65536; bg++)
+      for (uint32_t a = 0; a < 256; a++)
+        if (glyphMix((uint16_t)fg, (uint16_t)bg, (uint8_t)a) !=
+            lv_color_16_16_mix((uint16_t)fg, (uint16_t)bg, (uint8_t)a))
+          failed++;
+#endif
+
+#ifdef GLYPH_BENCH_LVGL
+  lv_init();
+  lv_display_create(SIZE, SIZE);
+#endif
+
+  uint8_t *glyphs[10];
+  for (int d = 0; d < 10; d++)
+  {
+    glyphs[d] = (uint8_t *)malloc(GLYPH_W * GLYPH_H);
+    makeGlyph(glyphs[d], d);
+  }
+  uint16_t *golden = (uint16_t *)malloc(SIZE * SIZE * 2);
+  uint16_t *frame = (uint16_t *)malloc(SIZE * SIZE * 2);
+  const int reps = 100;
+
+  for (int swapped = 0; swapped < 2; swapped++)
+  {
+    uint16_t color = swapped ? glyphSwap(0xFFFF) : 0xFFFF;
+    glyphTable(lut, 0xFFFF, swapped);
+
+    /* The golden frame, as the software renderer draws it */
+#ifdef GLYPH_BENCH_LVGL
+    drawLvgl(golden, glyphs, swapped);
+    background(frame, swapped);
+    drawText(frame, glyphs, [&](uint16_t *dst, const uint8_t *mask) {
+      blendGeneric(dst, SIZE, mask, GLYPH_W, GLYPH_W, GLYPH_H, 0xFFFF, swapped);
+    });
+    if (memcmp(golden, frame, SIZE * SIZE * 2) != 0)
+    {
+      printf("FAIL %s: the generic blend below is not LVGL's\n", swapped ? "RGB565 swapped" : "RGB565");
+      failed++;
+    }
+#else
+    background(golden, swapped);
+    drawText(golden, glyphs, [&](uint16_t *dst, const uint8_t *mask) {
+      blendGeneric(dst, SIZE, mask, GLYPH_W, GLYPH_W, GLYPH_H, 0xFFFF, swapped);
+    });
+#endif
+    background(frame, swapped);
+    drawText(frame, glyphs, [&](uint16_t *dst, const uint8_t *mask) {
+      glyphBlit(dst, SIZE, mask, GLYPH_W, GLYPH_W, GLYPH_H, lut, color, swapped);
+    });
+    bool same = memcmp(golden, frame, SIZE * SIZE * 2) == 0;
+    failed += !same;
+
+    double generic = 0, table = 0;
+    for (int i = 0; i < reps; i++)
+    {
+      background(frame, swapped);
+      double t0 = now();
+      drawText(frame, glyphs, [&](uint16_t *dst, const uint8_t *mask) {
+        blendGeneric(dst, SIZE, mask, GLYPH_W, GLYPH_W, GLYPH_H, 0xFFFF, swapped);
+      });
+      generic += now() - t0;
+      background(frame, swapped);
+      t0 = now();
+      drawText(frame, glyphs, [&](uint16_t *dst, const uint8_t *mask) {
+        glyphBlit(dst, SIZE, mask, GLYPH_W, GLYPH_W, GLYPH_H, lut, color, swapped);
+      });
+      table += now() - t0;
+    }
+    printf("%s: frame %s the golden one (%08x), generic blend %.1f us, table %.1f us, %.1fx\n",
+           swapped ? "RGB565 swapped" : "RGB565        ", same ? "matches" : "DIFFERS from", fnv(golden),
+           generic / reps * 1e6, table / reps * 1e6, generic / table);
+  }
+
+  printf("%s\n", failed ? "glyph blit differs from the software blend" : "glyph blit is pixel exact");
+  for (int d = 0; d < 10; d++)
+    free(glyphs[d]);
+  free(golden);
+  free(frame);
+  return failed != 0;
+}
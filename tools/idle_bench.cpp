@@ -0,0 +1,224 @@
+/*
+ * Host check of the UI task's sleep/wake policy (include/idle_policy.hpp)
+ *
+ * Runs the UI task loop of src/main.cpp against a virtual clock: the task
+ * sleeps for what IdlePolicy::sleep() returns, unless a notification comes
+ * first, and is awake for a fixed time per kind of work. Checks the waits
+ * sleep() picks, that every wakeup is counted under its cause and that the
+ * duty cycle matches the busy time the simulation put in, then prints the
+ * duty cycle and wakeups of a few typical minutes:
+ *
+ *   parked      nothing changes, no LVGL timer pending
+ *   driving     RPM every 100 ms, the rest every second, frames while the needle moves
+ *   touched     a long press on the settings screen, polled while the finger is down
+ *
+ *   g++ -O2 -std=gnu++17 -Iinclude tools/idle_bench.cpp -o idle_bench && ./idle_bench
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <algorithm>
+#include <vector>
+#include "idle_policy.hpp"
+
+/* src/main.cpp */
+static const uint32_t UI_MIN_WAIT = 1;
+static const uint32_t UI_MAX_WAIT = 1000;
+static const uint32_t TOUCH_POLL = 20;
+static const uint32_t NO_TIMER = 0xFFFFFFFF; // LV_NO_TIMER_READY
+
+static int failed = 0;
+
+static void check(bool ok, const char *what)
+{
+  if (!ok && failed++ < 10)
+    printf("FAIL %s\n", what);
+}
+
+/* A notification the task gets at `at` us */
+struct Event
+{
+  uint64_t at;
+  uint32_t bits;
+};
+
+struct Scenario
+{
+  const char *name;
+  uint64_t length;            // us
+  std::vector<Event> events;  // in time order
+  uint64_t pressFrom, pressTo; // finger down, us, equal for none
+  uint32_t timerPeriod;       // ms an LVGL timer keeps firing at, NO_TIMER for none
+};
+
+struct Outcome
+{
+  uint64_t busy;
+  uint32_t sample, touch, frame, timer;
+};
+
+/* Awake time per wakeup in us, by what woke the task */
+static uint32_t workFor(uint32_t bits)
+{
+  uint32_t us = 150; // lv_timer_handler with nothing to do
+  if (bits & IDLE_EVT_SAMPLE)
+    us += 400;
+  if (bits & IDLE_EVT_TOUCH)
+    us += 300;
+  if (bits & IDLE_EVT_FRAME)
+    us += 6000;
+  return us;
+}
+
+static Outcome run(const Scenario &s, IdlePolicy &policy)
+{
+  Outcome o = {};
+  uint64_t now = 0;
+  size_t next = 0;
+  uint32_t wait = 0;
+  policy.resetStats(0);
+
+  while (now < s.length)
+  {
+    /* Sleep until the timeout or the first notification, pending ones are merged */
+    uint64_t timeout = now + (uint64_t)wait * 1000;
+    uint32_t bits = 0;
+    if (next < s.events.size() && s.events[next].at <= timeout)
+    {
+      now = std::max(now, s.events[next].at);
+      while (next < s.events.size() && s.events[next].at <= now)
+        bits |= s.events[next++].bits;
+    }
+    else
+    {
+      now = timeout;
+    }
+    if (now >= s.length)
+      break;
+
+    policy.wake(now, bits);
+    if (bits & IDLE_EVT_SAMPLE)
+      o.sample++;
+    if (bits & IDLE_EVT_TOUCH)
+      o.touch++;
+    if (bits & IDLE_EVT_FRAME)
+      o.frame++;
+    if (!bits)
+      o.timer++;
+
+    uint32_t took = workFor(bits);
+    o.busy += took;
+    now += took;
+
+    uint32_t timerIdle = NO_TIMER;
+    if (s.timerPeriod != NO_TIMER)
+      timerIdle = s.timerPeriod - (uint32_t)(now / 1000 % s.timerPeriod);
+    bool touching = now >= s.pressFrom && now < s.pressTo;
+    wait = policy.sleep(now, timerIdle, touching);
+  }
+  /* Close the window at the end, the task is asleep */
+  policy.wake(s.length, 0);
+  return o;
+}
+
+static void periodic(std::vector<Event> &events, uint64_t from, uint64_t to, uint64_t period,
+                     uint32_t bits)
+{
+  for (uint64_t t = from; t < to; t += period)
+    events.push_back({t, bits});
+}
+
+static void sortEvents(std::vector<Event> &events)
+{
+  std::stable_sort(events.begin(), events.end(),
+                   [](const Event &a, const Event &b) { return a.at < b.at; });
+}
+
+static void checkWaits()
+{
+  IdlePolicy p(UI_MIN_WAIT, UI_MAX_WAIT, TOUCH_POLL);
+  check(p.sleep(0, NO_TIMER, false) == UI_MAX_WAIT, "no timer pending sleeps maxWait");
+  check(p.sleep(0, 33, false) == 33, "sleeps until the next timer");
+  check(p.sleep(0, 0, false) == UI_MIN_WAIT, "a due timer still yields minWait");
+  check(p.sleep(0, 500, true) == TOUCH_POLL, "pressed polls the touch");
+  check(p.sleep(0, 5, true) == 5, "a sooner timer wins over the touch poll");
+  check(p.sleep(0, NO_TIMER, true) == TOUCH_POLL, "pressed without timers polls the touch");
+}
+
+static void checkAccounting()
+{
+  IdlePolicy p(UI_MIN_WAIT, UI_MAX_WAIT, TOUCH_POLL);
+  p.resetStats(0);
+  p.sleep(1000, NO_TIMER, false);             // 1 ms awake
+  p.wake(4000, IDLE_EVT_SAMPLE);              // 3 ms asleep
+  p.sleep(5000, NO_TIMER, false);             // 1 ms awake
+  p.wake(10000, IDLE_EVT_TOUCH | IDLE_EVT_FRAME); // 5 ms asleep
+  check(p.dutyCycle() == 0.2f, "duty cycle is awake over awake plus asleep");
+  check(p.sampleWakeups() == 1 && p.touchWakeups() == 1 && p.frameWakeups() == 1 &&
+            p.timerWakeups() == 0,
+        "a merged notification counts under every cause");
+  p.sleep(10000, 10, false);
+  p.wake(20000, 0);
+  check(p.timerWakeups() == 1, "a timeout counts as a timer wakeup");
+
+  p.resetStats(20000);
+  check(p.dutyCycle() == 0 && p.sampleWakeups() == 0, "reset clears the window");
+  p.sleep(22000, NO_TIMER, false);
+  p.wake(30000, 0);
+  check(p.dutyCycle() == 0.2f, "reset keeps the awake state");
+}
+
+int main()
+{
+  checkWaits();
+  checkAccounting();
+
+  const uint64_t MINUTE = 60000000;
+  std::vector<Scenario> scenarios;
+
+  scenarios.push_back({"parked", MINUTE, {}, 0, 0, NO_TIMER});
+
+  Scenario driving = {"driving", MINUTE, {}, 0, 0, NO_TIMER};
+  periodic(driving.events, 70000, MINUTE, 100000, IDLE_EVT_SAMPLE);
+  periodic(driving.events, 130000, MINUTE, 1000000, IDLE_EVT_SAMPLE);
+  periodic(driving.events, 0, MINUTE, 16667, IDLE_EVT_FRAME);
+  sortEvents(driving.events);
+  scenarios.push_back(driving);
+
+  Scenario touched = {"touched", MINUTE, {}, 10000000, 12000000, NO_TIMER};
+  touched.events.push_back({10000000, IDLE_EVT_TOUCH});
+  scenarios.push_back(touched);
+
+  printf("%-8s %6s %7s %6s %6s %6s\n", "", "duty", "sample", "touch", "frame", "timer");
+  for (const Scenario &s : scenarios)
+  {
+    IdlePolicy policy(UI_MIN_WAIT, UI_MAX_WAIT, TOUCH_POLL);
+    Outcome o = run(s, policy);
+    float duty = (float)o.busy / s.length;
+
+    char what[64];
+    snprintf(what, sizeof(what), "%s: duty cycle", s.name);
+    check(policy.dutyCycle() > duty - 1e-4f && policy.dutyCycle() < duty + 1e-4f, what);
+    snprintf(what, sizeof(what), "%s: wakeups by cause", s.name);
+    check(policy.sampleWakeups() == o.sample && policy.touchWakeups() == o.touch &&
+              policy.frameWakeups() == o.frame && policy.timerWakeups() == o.timer + 1,
+          what); // +1, the wake closing the window
+
+    printf("%-8s %5.2f%% %7u %6u %6u %6u\n", s.name, duty * 100, o.sample, o.touch, o.frame,
+           o.timer);
+  }
+
+  /* Parked, the task only wakes when the longest sleep runs out */
+  IdlePolicy parked(UI_MIN_WAIT, UI_MAX_WAIT, TOUCH_POLL);
+  Outcome o = run(scenarios[0], parked);
+  check(o.timer <= 60 && o.sample + o.touch + o.frame == 0, "parked: one wakeup per maxWait");
+
+  /* A 2 s press is polled every TOUCH_POLL on top of that */
+  IdlePolicy touching(UI_MIN_WAIT, UI_MAX_WAIT, TOUCH_POLL);
+  o = run(scenarios[2], touching);
+  check(o.touch == 1 && o.timer >= 58 + 2000 / TOUCH_POLL - 2 && o.timer <= 60 + 2000 / TOUCH_POLL,
+        "touched: the press is polled until the release");
+
+  printf(failed ? "%d checks failed\n" : "all checks passed\n", failed);
+  return failed != 0;
+}
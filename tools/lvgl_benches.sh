@@ -0,0 +1,61 @@
+#!/bin/sh
+#
+# Builds and runs the host benchmarks against LVGL itself
+#
+# The benchmarks under tools/ compare the dashboard's drawing code with
+# LVGL's software renderer when built with their *_BENCH_LVGL define. This
+# builds LVGL 9.4 for the host once per configuration and runs each of them
+# with it, from the top of the repository:
+#
+#   tools/lvgl_benches.sh [<dir of lvgl>]
+#
+# Without a directory, the checkout PlatformIO fetched into .pio/libdeps is
+# used, or LVGL v9.4.0 is cloned next to the build output.
+
+set -e
+
+OUT=${TMPDIR:-/tmp}/lvgl_bench
+LVGL=${1:-$(ls -d .pio/libdeps/*/lvgl 2>/dev/null | head -n 1)}
+if [ -z "$LVGL" ]; then
+  LVGL=$OUT/lvgl
+  [ -d "$LVGL" ] || git clone --depth 1 --branch v9.4.0 https://github.com/lvgl/lvgl.git "$LVGL"
+fi
+LVGL=$(cd "$LVGL" && pwd)
+
+# Frames and canvases are larger than LVGL's own 64 KB heap
+FLAGS="-O2 -DLV_CONF_SKIP -DLV_USE_STDLIB_MALLOC=LV_STDLIB_CLIB -I$LVGL/.. -I$LVGL -Iinclude"
+
+# lvgl_lib <name> <defines> [<more sources>]: LVGL built with <defines> into $OUT/<name>.a
+lvgl_lib()
+{
+  mkdir -p "$OUT/$1"
+  for f in $(find "$LVGL/src" $3 -name '*.c'); do
+    gcc $FLAGS $2 -c "$f" -o "$OUT/$1/$(echo "$f" | tr / _).o"
+  done
+  rm -f "$OUT/$1.a"
+  ar rcs "$OUT/$1.a" "$OUT/$1"/*.o
+}
+
+# bench <name> <library> [<defines>]: tools/<name>.cpp linked with $OUT/<library>.a, then run
+bench()
+{
+  echo "== $1"
+  g++ $FLAGS $3 -std=gnu++17 "tools/$1.cpp" "$OUT/$2.a" -lpthread -lm -o "$OUT/$1"
+  "$OUT/$1"
+}
+
+lvgl_lib default "-DLV_DRAW_SW_SUPPORT_L8=1 -DLV_DRAW_SW_SUPPORT_RGB565_SWAPPED=1"
+
+bench ring_bench default -DRING_BENCH_LVGL
+bench rotate_bench default -DROTATE_BENCH_LVGL
+bench palette_bench default -DPALETTE_BENCH_LVGL
+bench glyph_bench default -DGLYPH_BENCH_LVGL
+
+# The dashboard with one and with two draw threads, LVGL built for each
+for n in 1 2; do
+  UNITS="-DLV_LVGL_H_INCLUDE_SIMPLE -DLV_USE_OBJ_NAME=1 -DLV_USE_FONT_COMPRESSED=1 \
+    -DLV_USE_OS=LV_OS_PTHREAD -DLV_DRAW_SW_DRAW_UNIT_CNT=$n -Ilib/hud_ui"
+  lvgl_lib units_$n "$UNITS" lib/hud_ui
+  echo "$n draw units"
+  bench parallel_bench units_$n "$UNITS"
+done
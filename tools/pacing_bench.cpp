@@ -0,0 +1,166 @@
+/*
+ * Host simulation of frame pacing (include/frame_pacer.hpp)
+ *
+ * Plays the same sequence of frame times, with BLE bursts in between, into
+ * three ways of starting frames against a panel refreshing at a little under
+ * 60 Hz, on a virtual clock:
+ *
+ *   LVGL timer   LVGL's refresh timer, as before, with LV_DEF_REFR_PERIOD
+ *                set to the target period
+ *   timer        FramePacer on a timer at the target rate
+ *   TE           FramePacer on the panel's tearing effect line
+ *
+ * and prints, per way, the frames drawn and skipped, the time between frame
+ * starts, which is the step animations move by, and where in the panel's
+ * refresh frames start. Whether a frame tears depends on how fast the panel
+ * scans against how fast the frame is written, which this does not model;
+ * a start at a fixed point of the refresh is what makes it predictable.
+ *
+ *   g++ -O2 -std=gnu++17 -Iinclude tools/pacing_bench.cpp -o pacing_bench
+ */
+
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <vector>
+#include "frame_pacer.hpp"
+
+static const uint32_t PANEL_PERIOD = 16720; // us, a 59.8 Hz panel
+static const uint32_t WAKE = 50;            // us from a notification to the task running
+static const uint64_t RUN = 20000000;       // us simulated
+
+/* Frame times in us: a steady part and a BLE burst now and then */
+struct Workload
+{
+  uint32_t base, spread, burst;
+
+  uint32_t next(uint32_t &seed) const
+  {
+    seed = seed * 1103515245u + 12345u;
+    uint32_t took = base + (seed >> 8) % spread;
+    if ((seed >> 4) % 100 < 5)
+      took += burst;
+    return took;
+  }
+};
+
+struct Frame
+{
+  uint64_t start, end;
+};
+
+struct Result
+{
+  std::vector<Frame> frames;
+  uint32_t skipped = 0;
+};
+
+/* LVGL's timer: runs once `period` us have passed since its last run, checked every ms */
+static Result lvglTimer(const Workload &w, uint32_t period)
+{
+  Result r;
+  uint32_t seed = 1;
+  uint64_t now = 0, last = 0;
+  while (now < RUN)
+  {
+    if (now - last >= period || now == 0)
+    {
+      last = now;
+      uint32_t took = w.next(seed);
+      r.frames.push_back({now, now + took});
+      now += took;
+    }
+    now = (now / 1000 + 1) * 1000;
+  }
+  return r;
+}
+
+/* FramePacer on a clock ticking every `tick` us, ticks while drawing are one pending notification */
+static Result paced(const Workload &w, uint32_t rate, uint32_t tick)
+{
+  Result r;
+  FramePacer pacer(1000000 / rate);
+  uint32_t seed = 1;
+  uint64_t busy = 0;    // drawing until here
+  uint64_t pending = 0; // last tick while drawing, 0 if none
+  auto wake = [&](uint64_t tick, uint64_t now) {
+    if (!pacer.due(tick, now))
+      return;
+    uint32_t took = w.next(seed);
+    r.frames.push_back({now, now + took});
+    pacer.done(now + took);
+    busy = now + took;
+  };
+  for (uint64_t t = tick; t < RUN; t += tick)
+  {
+    if (pending && busy <= t)
+    {
+      uint64_t last = pending;
+      pending = 0;
+      wake(last, busy + WAKE);
+    }
+    if (t < busy)
+      pending = t;
+    else
+      wake(t, t + WAKE);
+  }
+  r.skipped = pacer.skipped();
+  return r;
+}
+
+/* Mean and standard deviation */
+static void spread(const std::vector<double> &v, double &mean, double &sd)
+{
+  mean = 0;
+  for (double x : v)
+    mean += x;
+  mean /= v.size();
+  double var = 0;
+  for (double x : v)
+    var += (x - mean) * (x - mean);
+  sd = sqrt(var / v.size());
+}
+
+static void report(const char *name, const Result &r)
+{
+  /* Animations move by the time between frame starts */
+  std::vector<double> steps, phases;
+  for (size_t i = 0; i < r.frames.size(); i++)
+  {
+    if (i)
+      steps.push_back((double)(r.frames[i].start - r.frames[i - 1].start));
+    phases.push_back((double)(r.frames[i].start % PANEL_PERIOD));
+  }
+  double step, stepSd, phase, phaseSd;
+  spread(steps, step, stepSd);
+  spread(phases, phase, phaseSd);
+
+  printf("  %-11s %5.1f fps, %4u skipped, step %5.1f ms +- %4.1f ms, "
+         "start %4.1f ms +- %4.1f ms into the refresh\n",
+         name, r.frames.size() * 1e6 / RUN, r.skipped, step / 1000, stepSd / 1000, phase / 1000,
+         phaseSd / 1000);
+}
+
+int main()
+{
+  static const struct
+  {
+    const char *name;
+    Workload work;
+    uint32_t rate;
+  } cases[] = {
+      {"240 px SPI, 60 fps", {4000, 4000, 9000}, 60},
+      {"466 px QSPI, 30 fps", {13000, 8000, 12000}, 30},
+      {"466 px QSPI, 60 fps", {13000, 8000, 12000}, 60},
+  };
+  for (const auto &c : cases)
+  {
+    printf("%s, frames of %.0f-%.0f ms, +%.0f ms 5 %% of the time:\n", c.name, c.work.base / 1e3,
+           (c.work.base + c.work.spread) / 1e3, c.work.burst / 1e3);
+    report("LVGL timer", lvglTimer(c.work, 1000000 / c.rate));
+    report("timer", paced(c.work, c.rate, 1000000 / c.rate));
+    report("TE", paced(c.work, c.rate, PANEL_PERIOD));
+  }
+  return 0;
+}
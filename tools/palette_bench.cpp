@@ -0,0 +1,234 @@
+/*
+ * Host benchmark of the L8 render mode (include/l8_palette.hpp)
+ *
+ * Blends the same antialiased masks into an RGB565 (bytes swapped) and an
+ * L8 frame the way LVGL's software renderer mixes a color over a mask,
+ * expands the L8 frame through the palette as the flush does, checks the
+ * result against the RGB565 frame and prints the times and strip heights.
+ *
+ *   g++ -O2 -std=gnu++17 -Iinclude tools/palette_bench.cpp -o palette_bench
+ *
+ * Built with -DPALETTE_BENCH_LVGL and linked with LVGL (LV_DRAW_SW_SUPPORT_L8),
+ * it also times LVGL itself drawing a frame of a background, an arc and a
+ * label in both formats; tools/lvgl_benches.sh builds LVGL for the host and
+ * runs it that way.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "l8_palette.hpp"
+#ifdef PALETTE_BENCH_LVGL
+#include "lvgl/lvgl.h"
+#endif
+
+static const int32_t SIZE = 466;
+static const int32_t L8_EXPAND_LINES = 16;
+
+/* "1.23x slower" or "1.23x faster" for `time` against `base` */
+static void printRatio(double time, double base)
+{
+  if (time > base)
+    printf("%.2fx slower", time / base);
+  else
+    printf("%.2fx faster", base / time);
+}
+
+static double now()
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static uint16_t swap16(uint16_t c)
+{
+  return (uint16_t)((c >> 8) | (c << 8));
+}
+
+/* White over the frame by `a`, as lv_color_16_16_mix with the bytes swapped around it */
+static void blendRgb565(uint16_t *buf, const uint8_t *mask, int32_t n)
+{
+  for (int32_t i = 0; i < n; i++)
+  {
+    uint32_t a = mask[i];
+    if (a == 0)
+      continue;
+    if (a == 255)
+    {
+      buf[i] = 0xFFFF;
+      continue;
+    }
+    uint16_t bg = swap16(buf[i]);
+    uint32_t ia = 255 - a;
+    uint32_t r = (31 * a + (bg >> 11) * ia) / 255;
+    uint32_t g = (63 * a + ((bg >> 5) & 0x3F) * ia) / 255;
+    uint32_t b = (31 * a + (bg & 0x1F) * ia) / 255;
+    buf[i] = swap16((uint16_t)(r << 11 | g << 5 | b));
+  }
+}
+
+static void blendL8(uint8_t *buf, const uint8_t *mask, int32_t n)
+{
+  for (int32_t i = 0; i < n; i++)
+  {
+    uint32_t a = mask[i];
+    if (a == 0)
+      continue;
+    buf[i] = a == 255 ? 255 : (uint8_t)((255 * a + buf[i] * (255 - a)) / 255);
+  }
+}
+
+/* Rings and bars with soft edges, about what the dashboard covers */
+static void makeMask(uint8_t *mask, int32_t layer)
+{
+  int32_t c = SIZE / 2;
+  for (int32_t y = 0; y < SIZE; y++)
+  {
+    for (int32_t x = 0; x < SIZE; x++)
+    {
+      int32_t dx = x - c, dy = y - c;
+      int32_t d = (dx * dx + dy * dy) >> 6;
+      int32_t v = (d + layer * 37) & 0xFF;
+      mask[y * SIZE + x] = (uint8_t)(v < 96 ? 0 : v > 160 ? 255 : (v - 96) * 4);
+    }
+  }
+}
+
+#ifdef PALETTE_BENCH_LVGL
+static double drawLvgl(lv_color_format_t cf, int reps)
+{
+  lv_obj_t *canvas = lv_canvas_create(lv_screen_active());
+  lv_draw_buf_t *draw_buf = lv_draw_buf_create(SIZE, SIZE, cf, LV_STRIDE_AUTO);
+  lv_canvas_set_draw_buf(canvas, draw_buf);
+  double t0 = now();
+  for (int i = 0; i < reps; i++)
+  {
+    lv_layer_t layer;
+    lv_canvas_init_layer(canvas, &layer);
+    lv_draw_rect_dsc_t bg;
+    lv_draw_rect_dsc_init(&bg);
+    bg.bg_color = lv_color_black();
+    lv_area_t all = {0, 0, SIZE - 1, SIZE - 1};
+    lv_draw_rect(&layer, &bg, &all);
+    lv_draw_arc_dsc_t arc;
+    lv_draw_arc_dsc_init(&arc);
+    arc.color = lv_color_white();
+    arc.width = 30;
+    arc.radius = SIZE / 2;
+    arc.center.x = SIZE / 2;
+    arc.center.y = SIZE / 2;
+    arc.start_angle = 135;
+    arc.end_angle = 45;
+    lv_draw_arc(&layer, &arc);
+    lv_draw_label_dsc_t label;
+    lv_draw_label_dsc_init(&label);
+    label.color = lv_color_white();
+    label.text = "88 km/h 3500 rpm";
+    lv_area_t coords = {60, 200, SIZE - 60, 260};
+    lv_draw_label(&layer, &label, &coords);
+    lv_canvas_finish_layer(canvas, &layer);
+  }
+  double took = (now() - t0) / reps;
+  lv_obj_delete(canvas);
+  lv_draw_buf_destroy(draw_buf);
+  return took;
+}
+#endif
+
+int main()
+{
+  const int reps = 50;
+  const int32_t n = SIZE * SIZE;
+  uint8_t *masks[3];
+  for (int32_t k = 0; k < 3; k++)
+  {
+    masks[k] = (uint8_t *)malloc(n);
+    makeMask(masks[k], k);
+  }
+  uint16_t *rgb = (uint16_t *)malloc(n * 2);
+  uint8_t *l8 = (uint8_t *)malloc(n);
+  uint16_t *expanded = (uint16_t *)malloc(n * 2);
+  uint16_t lut[256];
+  l8PaletteRamp(lut, 0xFFFF, true);
+
+  double t0 = now();
+  for (int i = 0; i < reps; i++)
+  {
+    memset(rgb, 0, n * 2);
+    for (int32_t k = 0; k < 3; k++)
+      blendRgb565(rgb, masks[k], n);
+  }
+  double rgbTime = (now() - t0) / reps;
+
+  t0 = now();
+  for (int i = 0; i < reps; i++)
+  {
+    memset(l8, 0, n);
+    for (int32_t k = 0; k < 3; k++)
+      blendL8(l8, masks[k], n);
+  }
+  double l8Time = (now() - t0) / reps;
+
+  /* Strips of L8_EXPAND_LINES rows into one small buffer, as flushL8 does */
+  uint16_t *strip = (uint16_t *)malloc(SIZE * L8_EXPAND_LINES * 2);
+  t0 = now();
+  for (int i = 0; i < reps; i++)
+  {
+    for (int32_t y = 0; y < SIZE; y += L8_EXPAND_LINES)
+    {
+      int32_t rows = SIZE - y < L8_EXPAND_LINES ? SIZE - y : L8_EXPAND_LINES;
+      for (int32_t r = 0; r < rows; r++)
+        l8Expand(l8 + (y + r) * SIZE, strip + r * SIZE, SIZE, lut, false);
+    }
+  }
+  double expandTime = (now() - t0) / reps;
+
+  /* Same picture both ways, up to the rounding of the two mixes */
+  for (int32_t y = 0; y < SIZE; y++)
+    l8Expand(l8 + y * SIZE, expanded + y * SIZE, SIZE, lut, false);
+  int worst = 0;
+  for (int32_t i = 0; i < n; i++)
+  {
+    int a = (swap16(rgb[i]) >> 5) & 0x3F, b = (swap16(expanded[i]) >> 5) & 0x3F;
+    worst = abs(a - b) > worst ? abs(a - b) : worst;
+  }
+
+  printf("%d px frame, 3 masks blended white on black:\n", (int)SIZE);
+  printf("  RGB565 swapped  %7.1f us\n", rgbTime * 1e6);
+  printf("  L8              %7.1f us, expand %.1f us, together ", l8Time * 1e6, expandTime * 1e6);
+  printRatio(l8Time + expandTime, rgbTime);
+  printf("\n");
+  printf("  largest green difference %d/63\n", worst);
+
+  /* Strip heights for two buffers in the same internal RAM */
+  static const size_t budgets[] = {64 * 1024, 128 * 1024, 192 * 1024};
+  for (size_t budget : budgets)
+  {
+    size_t rgbLines = budget / 2 / (SIZE * 2);
+    size_t l8Lines = (budget - 2 * SIZE * 2 * L8_EXPAND_LINES) / 2 / SIZE; // less two expand buffers
+    printf("  %3u KB: RGB565 strips of %3u lines (%u flushes), L8 strips of %3u lines (%u flushes)\n",
+           (unsigned)(budget / 1024), (unsigned)rgbLines, (unsigned)((SIZE + rgbLines - 1) / rgbLines),
+           (unsigned)l8Lines, (unsigned)((SIZE + l8Lines - 1) / l8Lines));
+  }
+
+#ifdef PALETTE_BENCH_LVGL
+  lv_init();
+  lv_display_create(SIZE, SIZE);
+  double lvRgb = drawLvgl(LV_COLOR_FORMAT_RGB565_SWAPPED, reps);
+  double lvL8 = drawLvgl(LV_COLOR_FORMAT_L8, reps);
+  printf("  LVGL frame: RGB565 swapped %.1f us, L8 %.1f us + expand %.1f us, together ", lvRgb * 1e6,
+         lvL8 * 1e6, expandTime * 1e6);
+  printRatio(lvL8 + expandTime, lvRgb);
+  printf("\n");
+#endif
+
+  for (int32_t k = 0; k < 3; k++)
+    free(masks[k]);
+  free(rgb);
+  free(l8);
+  free(expanded);
+  free(strip);
+  return 0;
+}
@@ -0,0 +1,74 @@
+/*
+ * Host frame times of the dashboard with one or more software draw units
+ *
+ * Renders lib/hud_ui's dashboard at 466 px into full frame buffers, with a
+ * flush that only hands the buffer back, changing the speed, rpm, fuel and
+ * temperature every frame as a drive would. Prints the time per frame and
+ * the CPU time of the process, which exceeds the wall time by what the
+ * draw threads ran in parallel.
+ *
+ * LVGL's configuration is fixed at compile time, so it is built once for
+ * each unit count, with the pthread OS layer and lib/hud_ui, and this run
+ * against each; tools/lvgl_benches.sh does both.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "lvgl.h"
+#include "hud_ui.h"
+
+static const int32_t SIZE = 466;
+static const int FRAMES = 300;
+
+static double clockNow(clockid_t id)
+{
+  struct timespec ts;
+  clock_gettime(id, &ts);
+  return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static uint32_t tick()
+{
+  return (uint32_t)(clockNow(CLOCK_MONOTONIC) * 1000);
+}
+
+static void flush(lv_display_t *display, const lv_area_t *area, uint8_t *data)
+{
+  lv_display_flush_ready(display);
+}
+
+int main()
+{
+  lv_init();
+  lv_tick_set_cb(tick);
+  lv_display_t *display = lv_display_create(SIZE, SIZE);
+  lv_display_set_color_format(display, LV_COLOR_FORMAT_RGB565_SWAPPED);
+  size_t bytes = (size_t)SIZE * SIZE * 2;
+  lv_display_set_buffers(display, malloc(bytes), malloc(bytes), bytes, LV_DISPLAY_RENDER_MODE_FULL);
+  lv_display_set_flush_cb(display, flush);
+
+  hud_ui_init("");
+  lv_screen_load(dashboard_create());
+  lv_refr_now(display);
+
+  double wall = clockNow(CLOCK_MONOTONIC);
+  double cpu = clockNow(CLOCK_PROCESS_CPUTIME_ID);
+  for (int i = 0; i < FRAMES; i++)
+  {
+    lv_subject_set_int(&speed, i % 180);
+    lv_subject_set_int(&engine_rpm, (i * 37) % 7000);
+    lv_subject_set_int(&fuel_capacity, 60 - i % 60);
+    lv_subject_set_int(&coolant_temp, 40 + i % 60);
+    /* Whole frames, so every run draws the same amount */
+    lv_obj_invalidate(lv_screen_active());
+    lv_refr_now(display);
+  }
+  wall = clockNow(CLOCK_MONOTONIC) - wall;
+  cpu = clockNow(CLOCK_PROCESS_CPUTIME_ID) - cpu;
+
+  printf("%d draw unit%s: %.2f ms per frame, %.2f ms CPU per frame, %.2f cores busy\n",
+         LV_DRAW_SW_DRAW_UNIT_CNT, LV_DRAW_SW_DRAW_UNIT_CNT == 1 ? "" : "s", wall / FRAMES * 1e3,
+         cpu / FRAMES * 1e3, cpu / wall);
+  return 0;
+}
@@ -0,0 +1,35 @@
+"""
+PlatformIO pre-build step: subset the dashboard fonts before compiling
+
+Runs tools/font_subset.py with the fonts named in `custom_font_compress`
+compressed, so fonts freshly exported from the editor are subset and
+compressed again, and the build stops when a font lacks a glyph the screens
+need. Nothing is rewritten when the fonts are already up to date.
+
+    extra_scripts = pre:tools/pio_fonts.py
+"""
+
+import os
+import subprocess
+
+Import("env")  # noqa: F821, provided by PlatformIO
+
+script = os.path.join(env.subst("$PROJECT_DIR"), "tools", "font_subset.py")  # noqa: F821
+compress = env.GetProjectOption("custom_font_compress", "").split()  # noqa: F821
+
+args = [env.subst("$PYTHONEXE"), script]  # noqa: F821
+if compress:
+    args += ["--compress"] + compress
+result = subprocess.run(
+    args,
+    stdout=subprocess.PIPE,
+    stderr=subprocess.STDOUT,
+    universal_newlines=True,
+)
+if result.returncode != 0:
+    print(result.stdout)
+    print("Fonts: subsetting failed, export the fonts from the editor again")
+    env.Exit(1)  # noqa: F821
+for line in result.stdout.splitlines():
+    if line.startswith(("total", "globals.xml")):
+        print("Fonts: " + line.strip())
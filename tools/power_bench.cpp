@@ -0,0 +1,339 @@
+/*
+ * Trace replay of engine-off detection (include/power_mode.hpp)
+ *
+ * Runs PowerMode and the adapter low power of include/obd.hpp
+ * (AdapterSleep over ObdScheduler, as the OBD task uses them) against a
+ * vehicle model and an adapter model that loses whatever wakes it, on a
+ * virtual clock. Checks, for an adapter that only sleeps on ATLP and one
+ * that also dozes off by itself and wakes silently, that
+ *
+ *   parked      the engine stopping and the car standing still goes to sleep
+ *               after ENGINE_OFF_DELAY, not before, and within one poll after
+ *   ignition    the ECU going silent with the battery below CHARGE_VOLTS goes
+ *               to sleep the same way
+ *   restart     a start while asleep is seen on the next heartbeat poll
+ *   crank dip   a short dip below CHARGE_VOLTS while running does not sleep
+ *
+ * and that no request is ever written to a sleeping adapter or before the
+ * prompt of the previous one.
+ *
+ *   g++ -O2 -std=gnu++17 -Iinclude tools/power_bench.cpp -o power_bench
+ *   ./power_bench                 the scenarios above
+ *   ./power_bench capture.log     prints the transitions of a log recorded with -D TRACE_SAMPLES
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "obd.hpp"
+#include "power_mode.hpp"
+
+/* src/main.cpp */
+static const uint32_t FAST_INTERVAL = 100;
+static const uint32_t MEDIUM_INTERVAL = 1000;
+static const uint32_t SLOW_INTERVAL = 10000;
+static const uint32_t OBD_TIMEOUT = 1000;
+static const uint32_t ENGINE_OFF_DELAY = 60000;
+static const float CHARGE_VOLTS = 13.0f;
+static const uint32_t HEARTBEAT_INTERVAL = 5000;
+
+static const uint32_t RTT = 60; // ms from a request to its answer
+
+static int failed = 0;
+
+static void check(bool ok, const char *scenario, const char *what)
+{
+  if (!ok && failed++ < 10)
+    printf("FAIL %s: %s\n", scenario, what);
+}
+
+/* What the car does, by time in ms */
+struct Vehicle
+{
+  uint32_t engineOff;   // engine stops, car stands still
+  uint32_t ecuSilent;   // ignition off, the ECU stops answering, UINT32_MAX for never
+  uint32_t engineOn;    // engine starts again, UINT32_MAX for never
+  uint32_t dipFrom, dipTo; // battery below CHARGE_VOLTS while running
+
+  bool running(uint32_t t) const
+  {
+    return t < engineOff || t >= engineOn;
+  }
+
+  /* Answer to a request at t, false for NO DATA */
+  bool answer(uint8_t pid, uint32_t t, float &value) const
+  {
+    if (pid == OBD_PID_VOLTAGE)
+    {
+      value = running(t) && !(t >= dipFrom && t < dipTo) ? 14.2f : 12.4f;
+      return true;
+    }
+    if (t >= ecuSilent && !running(t))
+      return false;
+    if (pid == 0x0C)
+      value = running(t) ? 850 : 0;
+    else if (pid == 0x0D)
+      value = t < engineOff - 20000 ? 50 : 0; // stopped 20 s before the engine
+    else
+      value = 1;
+    return true;
+  }
+};
+
+/*
+ * An ELM327 as far as low power goes: ATLP puts it to sleep a second after
+ * its "OK", and optionally its own inactivity timer does after `doze` ms
+ * without input. A write to a sleeping adapter wakes it and is lost, as the
+ * adapter drops the character that woke it; `wakePrompt` adapters then print
+ * a prompt. A CR repeats the last command.
+ */
+struct Adapter
+{
+  bool wakePrompt;
+  uint32_t doze; // UINT32_MAX for never
+
+  bool asleep = false;
+  uint32_t sleepAt = UINT32_MAX;
+  uint32_t lastInput = 0;
+  uint8_t last = 0; // PID of the last command
+
+  /* Response in progress */
+  enum Kind : uint8_t
+  {
+    NONE,
+    PROMPT, // bare prompt, or "OK" and the prompt
+    ANSWER,
+  } pending = NONE;
+  uint8_t pid = 0;
+  uint32_t at = 0;
+
+  uint32_t sleeps = 0;
+  uint32_t lost = 0;    // requests written to a sleeping adapter
+  uint32_t aborted = 0; // writes before the prompt, "STOPPED" on a real adapter
+
+  void tick(uint32_t now)
+  {
+    if (!asleep && pending == NONE && (now >= sleepAt || now - lastInput >= doze))
+    {
+      asleep = true;
+      sleepAt = UINT32_MAX;
+      sleeps++;
+    }
+  }
+
+  void write(ObdWrite what, uint8_t request, uint32_t now)
+  {
+    lastInput = now;
+    if (pending != NONE)
+      aborted++;
+    pending = NONE;
+    if (asleep)
+    {
+      asleep = false;
+      if (what == OBD_WRITE_REQUEST)
+        lost++;
+      if (wakePrompt)
+        respond(PROMPT, 0, now + RTT);
+      return;
+    }
+    if (what == OBD_WRITE_SLEEP)
+    {
+      respond(PROMPT, 0, now + RTT);
+      sleepAt = now + RTT + 1000;
+    }
+    else if (what == OBD_WRITE_WAKE)
+    {
+      respond(last ? ANSWER : PROMPT, last, now + RTT);
+    }
+    else
+    {
+      last = request;
+      respond(ANSWER, request, now + RTT);
+    }
+  }
+
+  void respond(Kind kind, uint8_t p, uint32_t t)
+  {
+    pending = kind;
+    pid = p;
+    at = t;
+  }
+};
+
+struct Transition
+{
+  uint32_t t;
+  bool sleeping;
+};
+
+static const uint8_t CMD[] = {'0'};
+
+/*
+ * Feeds the adapter and vehicle models to AdapterSleep, ObdScheduler and
+ * PowerMode for `length` ms, returns the transitions
+ */
+static size_t replay(const Vehicle &v, Adapter &adapter, uint32_t length, Transition *out, size_t max)
+{
+  ObdPid pids[] = {
+      {0x0C, CMD, 1, FAST_INTERVAL, nullptr, true},
+      {0x0D, CMD, 1, MEDIUM_INTERVAL, nullptr, false},
+      {0x10, CMD, 1, MEDIUM_INTERVAL, nullptr, false},
+      {0x2F, CMD, 1, MEDIUM_INTERVAL, nullptr, false},
+      {0x05, CMD, 1, SLOW_INTERVAL, nullptr, false},
+      {OBD_PID_VOLTAGE, CMD, 1, SLOW_INTERVAL, nullptr, true},
+  };
+  const size_t N = sizeof(pids) / sizeof(pids[0]);
+  ObdScheduler<N> scheduler(pids, OBD_TIMEOUT);
+  AdapterSleep<N> sleep(scheduler, HEARTBEAT_INTERVAL, OBD_TIMEOUT);
+  PowerMode power(ENGINE_OFF_DELAY, CHARGE_VOLTS);
+  power.reset(1);
+  sleep.reset();
+
+  size_t n = 0;
+  for (uint32_t now = 1; now < length; now++)
+  {
+    adapter.tick(now);
+    if (adapter.pending != Adapter::NONE && now >= adapter.at)
+    {
+      /* handleResponse() */
+      Adapter::Kind kind = adapter.pending;
+      adapter.pending = Adapter::NONE;
+      float value = 0;
+      bool ok = kind == Adapter::ANSWER && v.answer(adapter.pid, now, value);
+      if (!sleep.onPrompt())
+      {
+        ObdStatus status = ok ? OBD_OK : kind == Adapter::ANSWER ? OBD_NO_DATA : OBD_PROMPT;
+        scheduler.onResponse(status, ok ? adapter.pid : 0, now);
+        scheduler.onPrompt();
+        if (ok && adapter.pid == OBD_PID_VOLTAGE)
+          power.voltage(value, now);
+        else if (ok && adapter.pid == 0x0C)
+          power.rpm(value, now);
+        else if (ok && adapter.pid == 0x0D)
+          power.speed(value, now);
+      }
+    }
+
+    /* updatePower() */
+    if (power.update(now))
+    {
+      sleep.setSleeping(power.sleeping());
+      if (n < max)
+        out[n++] = {now, power.sleeping()};
+    }
+
+    ObdPid *request;
+    ObdWrite what = sleep.next(now, &request);
+    if (what != OBD_WRITE_NONE)
+      adapter.write(what, request ? request->pid : 0, now);
+  }
+  return n;
+}
+
+static void scenarios(const char *name, const Adapter &model)
+{
+  const uint32_t NEVER = UINT32_MAX;
+  /* Worst case from the last sign of the engine to the sleep: a speed poll plus an answer */
+  const uint32_t POLL = MEDIUM_INTERVAL + RTT + 1;
+  /* Worst case from a heartbeat being due to its answer: a wake without a prompt */
+  const uint32_t WAKE = OBD_TIMEOUT + RTT + 1;
+  Transition t[8];
+  size_t n;
+
+  printf("%s\n", name);
+
+  Adapter a = model;
+  Vehicle parked = {120000, NEVER, NEVER, 0, 0};
+  n = replay(parked, a, 300000, t, 8);
+  check(n == 1 && t[0].sleeping, "parked", "one transition, to sleep");
+  check(n >= 1 && t[0].t >= parked.engineOff + ENGINE_OFF_DELAY - POLL,
+        "parked", "not before ENGINE_OFF_DELAY");
+  check(n >= 1 && t[0].t <= parked.engineOff + ENGINE_OFF_DELAY + POLL, "parked",
+        "within one poll after ENGINE_OFF_DELAY");
+  check(a.sleeps >= 1, "parked", "the adapter sleeps");
+  check(a.lost == 0, "parked", "no request written to a sleeping adapter");
+  check(a.aborted == 0, "parked", "nothing written before the prompt");
+  printf("  %-10s engine off at %.1f, sleep at %.1f, adapter asleep %u times\n", "parked",
+         parked.engineOff / 1e3, n ? t[0].t / 1e3 : 0, (unsigned)a.sleeps);
+
+  a = model;
+  Vehicle ignition = {120000, 120000, NEVER, 0, 0};
+  n = replay(ignition, a, 300000, t, 8);
+  check(n == 1 && t[0].sleeping, "ignition", "one transition, to sleep");
+  check(n >= 1 && t[0].t >= ignition.engineOff + ENGINE_OFF_DELAY - POLL &&
+            t[0].t <= ignition.engineOff + ENGINE_OFF_DELAY + SLOW_INTERVAL + RTT,
+        "ignition", "after ENGINE_OFF_DELAY, within one voltage poll");
+  check(a.lost == 0 && a.aborted == 0, "ignition", "every request reaches an awake adapter");
+  printf("  %-10s ECU silent at %.1f, sleep at %.1f\n", "ignition", ignition.ecuSilent / 1e3,
+         n ? t[0].t / 1e3 : 0);
+
+  a = model;
+  Vehicle restart = {120000, NEVER, 400000, 0, 0};
+  n = replay(restart, a, 500000, t, 8);
+  check(n == 2 && t[0].sleeping && !t[1].sleeping, "restart", "sleep, then wake");
+  check(n == 2 && t[1].t >= restart.engineOn &&
+            t[1].t <= restart.engineOn + HEARTBEAT_INTERVAL + WAKE,
+        "restart", "awake within one heartbeat poll");
+  check(a.lost == 0 && a.aborted == 0, "restart", "every request reaches an awake adapter");
+  printf("  %-10s sleep at %.1f, engine on at %.1f, awake at %.1f\n", "restart",
+         n ? t[0].t / 1e3 : 0, restart.engineOn / 1e3, n > 1 ? t[1].t / 1e3 : 0);
+
+  a = model;
+  Vehicle dip = {NEVER, NEVER, NEVER, 100000, 190000};
+  n = replay(dip, a, 300000, t, 8);
+  check(n == 0, "crank dip", "low voltage while running does not sleep");
+  printf("  %-10s %u transitions with the battery low for %.0f s\n", "crank dip", (unsigned)n,
+         (dip.dipTo - dip.dipFrom) / 1e3);
+}
+
+/* The "trace,<ms>,<pid>,<value>" lines of a TRACE_SAMPLES log through PowerMode */
+static void replayLog(const char *path)
+{
+  FILE *f = fopen(path, "r");
+  if (!f)
+  {
+    perror(path);
+    exit(1);
+  }
+  PowerMode power(ENGINE_OFF_DELAY, CHARGE_VOLTS);
+  bool started = false;
+  char line[256];
+  while (fgets(line, sizeof(line), f))
+  {
+    unsigned t, pid;
+    float value;
+    const char *p = line;
+    while (*p && sscanf(p, "trace,%u,%x,%f", &t, &pid, &value) != 3)
+      p++;
+    if (!*p)
+      continue;
+    if (!started)
+    {
+      power.reset(t);
+      started = true;
+    }
+    if (pid == OBD_PID_VOLTAGE)
+      power.voltage(value, t);
+    else if (pid == 0x0C)
+      power.rpm(value, t);
+    else if (pid == 0x0D)
+      power.speed(value, t);
+    if (power.update(t))
+      printf("%.1f s: %s\n", t / 1e3, power.sleeping() ? "sleep" : "awake");
+  }
+  fclose(f);
+  printf("%u transitions\n", power.transitionCount());
+}
+
+int main(int argc, char **argv)
+{
+  if (argc > 1)
+  {
+    replayLog(argv[1]);
+    return 0;
+  }
+  scenarios("ATLP only, prompt on waking", {true, UINT32_MAX});
+  scenarios("inactivity timer, silent on waking", {false, 4000});
+  printf(failed ? "%d checks failed\n" : "all checks passed\n", failed);
+  return failed != 0;
+}
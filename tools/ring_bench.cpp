@@ -0,0 +1,203 @@
+/*
+ * Host benchmark of the ring span tables (include/ring_span.hpp)
+ *
+ * Fills the dashboard gauge at 240 and 466 px with the tables and with a
+ * per pixel distance test, checks the tables against an 8x8 supersampled
+ * ring and prints the time per fill.
+ *
+ *   g++ -O2 -std=gnu++17 -Iinclude tools/ring_bench.cpp -o ring_bench -lm
+ *
+ * Built with -DRING_BENCH_LVGL and linked with LVGL, it also draws the same
+ * rings with lv_draw_arc, checks them against the reference and times them;
+ * tools/lvgl_benches.sh builds LVGL for the host and runs it that way.
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "ring_span.hpp"
+#ifdef RING_BENCH_LVGL
+#include "lvgl/lvgl.h"
+#endif
+
+static constexpr RingSpans<120, 15> ring240{};
+static constexpr RingSpans<233, 30> ring466{};
+
+/* Dashboard rpm arc: 135 to 45 degrees, drawn up to two thirds */
+static const int32_t START = 135;
+static const int32_t END = 135 + 180;
+
+static double now()
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static RingArc whiteArc(int32_t start, int32_t end)
+{
+  RingArc arc = {};
+  arc.startSin = (int32_t)lround(sin(start * M_PI / 180) * 32767);
+  arc.startCos = (int32_t)lround(cos(start * M_PI / 180) * 32767);
+  arc.endSin = (int32_t)lround(sin(end * M_PI / 180) * 32767);
+  arc.endCos = (int32_t)lround(cos(end * M_PI / 180) * 32767);
+  arc.wide = end - start > 180;
+  arc.full = end - start >= 360;
+  arc.color = 0xFFFF;
+  arc.opa = 255;
+  return arc;
+}
+
+/* Inside the wedge from `start` to `end`, sweep at most 360 */
+static bool inWedge(double x, double y, int32_t start, int32_t end)
+{
+  double a = atan2(y, x) * 180 / M_PI;
+  while (a < start)
+    a += 360;
+  return a <= end;
+}
+
+/* Per pixel distance and angle, what the tables replace */
+static void fillDirect(uint16_t *buf, int32_t size, int32_t radius, int32_t width, int32_t start,
+                       int32_t end)
+{
+  int32_t c = size / 2;
+  for (int32_t y = 0; y < size; y++)
+  {
+    for (int32_t x = 0; x < size; x++)
+    {
+      double dx = x - c, dy = y - c;
+      double d = sqrt(dx * dx + dy * dy);
+      double cov = fmin(fmax(radius + 0.5 - d, 0), 1) - fmin(fmax(radius - width + 0.5 - d, 0), 1);
+      if (cov <= 0 || !inWedge(dx, dy, start, end))
+        continue;
+      buf[y * size + x] = ringMix(0xFFFF, buf[y * size + x], (uint32_t)(cov * 255 + 0.5));
+    }
+  }
+}
+
+/* Coverage 0..255 of every pixel, 8x8 samples */
+static void reference(uint8_t *out, int32_t size, int32_t radius, int32_t width, int32_t start,
+                      int32_t end)
+{
+  int32_t c = size / 2;
+  double ro = radius + 0.5, ri = radius - width + 0.5;
+  for (int32_t y = 0; y < size; y++)
+  {
+    for (int32_t x = 0; x < size; x++)
+    {
+      int n = 0;
+      for (int sy = 0; sy < 8; sy++)
+      {
+        for (int sx = 0; sx < 8; sx++)
+        {
+          double dx = x - c - 0.5 + (sx + 0.5) / 8, dy = y - c - 0.5 + (sy + 0.5) / 8;
+          double d2 = dx * dx + dy * dy;
+          if (d2 <= ro * ro && d2 > ri * ri && inWedge(dx, dy, start, end))
+            n++;
+        }
+      }
+      out[y * size + x] = (uint8_t)((n * 255 + 32) / 64);
+    }
+  }
+}
+
+#ifdef RING_BENCH_LVGL
+static void fillLvgl(lv_obj_t *canvas, int32_t size, int32_t radius, int32_t width, int32_t start,
+                     int32_t end)
+{
+  lv_layer_t layer;
+  lv_canvas_init_layer(canvas, &layer);
+  lv_draw_arc_dsc_t dsc;
+  lv_draw_arc_dsc_init(&dsc);
+  dsc.color = lv_color_white();
+  dsc.width = width;
+  dsc.radius = radius;
+  dsc.center.x = size / 2;
+  dsc.center.y = size / 2;
+  dsc.start_angle = start;
+  dsc.end_angle = end > 360 ? end - 360 : end;
+  lv_draw_arc(&layer, &dsc);
+  lv_canvas_finish_layer(canvas, &layer);
+}
+#endif
+
+template <uint16_t R, uint16_t W>
+static void bench(const RingSpans<R, W> &ring, int32_t size)
+{
+  const int reps = 200;
+  uint16_t *buf = (uint16_t *)calloc(size * size, 2);
+  uint8_t *ref = (uint8_t *)malloc(size * size);
+  RingArc arc = whiteArc(START, END);
+
+  /* Accuracy against the supersampled ring, white on black so green is the coverage */
+  ring.fill(buf, size, 0, 0, 0, 0, size - 1, size - 1, size / 2, size / 2, arc);
+  reference(ref, size, R, W, START, END);
+  int worst = 0;
+  uint32_t off = 0;
+  for (int32_t i = 0; i < size * size; i++)
+  {
+    int got = (((buf[i] >> 5) & 0x3F) * 255 + 31) / 63;
+    int diff = abs(got - ref[i]);
+    worst = diff > worst ? diff : worst;
+    off += diff > 16;
+  }
+
+  double t = now();
+  for (int i = 0; i < reps; i++)
+    ring.fill(buf, size, 0, 0, 0, 0, size - 1, size - 1, size / 2, size / 2, arc);
+  double table = (now() - t) / reps;
+
+  t = now();
+  for (int i = 0; i < reps / 10; i++)
+    fillDirect(buf, size, R, W, START, END);
+  double direct = (now() - t) / (reps / 10);
+
+  printf("%3d px, %2d wide: tables %u B, max error %d/255 (%u px over 16), "
+         "table fill %.1f us, per pixel %.1f us\n",
+         (int)size, W, (unsigned)sizeof(ring), worst, (unsigned)off, table * 1e6, direct * 1e6);
+
+#ifdef RING_BENCH_LVGL
+  lv_obj_t *canvas = lv_canvas_create(lv_screen_active());
+  lv_draw_buf_t *draw_buf = lv_draw_buf_create(size, size, LV_COLOR_FORMAT_RGB565, LV_STRIDE_AUTO);
+  lv_canvas_set_draw_buf(canvas, draw_buf);
+  lv_canvas_fill_bg(canvas, lv_color_black(), LV_OPA_COVER);
+  fillLvgl(canvas, size, R, W, START, END);
+  worst = 0;
+  off = 0;
+  for (int32_t y = 0; y < size; y++)
+  {
+    const uint16_t *row = (const uint16_t *)lv_draw_buf_goto_xy(draw_buf, 0, y);
+    for (int32_t x = 0; x < size; x++)
+    {
+      int diff = abs((((row[x] >> 5) & 0x3F) * 255 + 31) / 63 - ref[y * size + x]);
+      worst = diff > worst ? diff : worst;
+      off += diff > 16;
+    }
+  }
+  t = now();
+  for (int i = 0; i < reps; i++)
+    fillLvgl(canvas, size, R, W, START, END);
+  double lvgl = (now() - t) / reps;
+  printf("%3d px, %2d wide: lv_draw_arc max error %d/255 (%u px over 16), %.1f us, %.1fx the tables\n",
+         (int)size, W, worst, (unsigned)off, lvgl * 1e6, lvgl / table);
+  lv_obj_delete(canvas);
+  lv_draw_buf_destroy(draw_buf);
+#endif
+
+  free(buf);
+  free(ref);
+}
+
+int main()
+{
+#ifdef RING_BENCH_LVGL
+  lv_init();
+  lv_display_create(480, 480);
+#endif
+  bench(ring240, 240);
+  bench(ring466, 466);
+  return 0;
+}
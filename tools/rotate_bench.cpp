@@ -0,0 +1,157 @@
+/*
+ * Host benchmark of the flush transforms (include/pixel_transform.hpp)
+ *
+ * Checks all eight transforms against a pixel by pixel reference, in place
+ * for the mirrors, then times them on a 466 px frame and a 20 line strip.
+ *
+ *   g++ -O2 -std=gnu++17 -Iinclude tools/rotate_bench.cpp -o rotate_bench
+ *
+ * Built with -DROTATE_BENCH_LVGL and linked with LVGL, the rotations are
+ * also checked against lv_draw_sw_rotate and timed next to it on the same
+ * areas; tools/lvgl_benches.sh builds LVGL for the host and runs it that way.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "pixel_transform.hpp"
+#ifdef ROTATE_BENCH_LVGL
+#include "lvgl/lvgl.h"
+#endif
+
+static int failed = 0;
+
+static double now()
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/* One pixel at a time, the definition the kernel has to match */
+static void reference(const uint16_t *src, uint16_t *dst, int32_t w, int32_t h, uint8_t t)
+{
+  int32_t dw = t & XFORM_SWAP_XY ? h : w, dh = t & XFORM_SWAP_XY ? w : h;
+  for (int32_t y = 0; y < h; y++)
+  {
+    for (int32_t x = 0; x < w; x++)
+    {
+      int32_t u = t & XFORM_SWAP_XY ? y : x, v = t & XFORM_SWAP_XY ? x : y;
+      if (t & XFORM_FLIP_X)
+        u = dw - 1 - u;
+      if (t & XFORM_FLIP_Y)
+        v = dh - 1 - v;
+      dst[v * dw + u] = src[y * w + x];
+    }
+  }
+}
+
+static bool check(int32_t w, int32_t h, uint8_t t, bool inPlace)
+{
+  size_t n = (size_t)w * h;
+  uint16_t *src = (uint16_t *)malloc(n * 2);
+  uint16_t *want = (uint16_t *)calloc(n, 2);
+  uint16_t *got = (uint16_t *)calloc(n, 2);
+  for (size_t i = 0; i < n; i++)
+    src[i] = (uint16_t)(i * 2654435761u >> 16);
+  reference(src, want, w, h, t);
+  if (inPlace)
+  {
+    memcpy(got, src, n * 2);
+    xformPixels(got, got, w, h, t);
+  }
+  else
+    xformPixels(src, got, w, h, t);
+  bool ok = memcmp(want, got, n * 2) == 0;
+  if (!ok)
+    printf("FAIL %dx%d transform %d%s\n", (int)w, (int)h, t, inPlace ? " in place" : "");
+  free(src);
+  free(want);
+  free(got);
+  return ok;
+}
+
+static const char *const names[8] = {"copy",    "flip x",       "flip y",       "rotate 180",
+                                     "swap xy", "rotate 90 cw", "rotate 90 ccw", "anti-transpose"};
+
+static void bench(int32_t w, int32_t h, int reps)
+{
+  size_t n = (size_t)w * h;
+  uint16_t *src = (uint16_t *)calloc(n, 2);
+  uint16_t *dst = (uint16_t *)calloc(n, 2);
+#ifdef ROTATE_BENCH_LVGL
+  uint16_t *want = (uint16_t *)calloc(n, 2);
+#endif
+  printf("%dx%d:\n", (int)w, (int)h);
+  for (uint8_t t = 1; t < 8; t++)
+  {
+    bool inPlace = !(t & XFORM_SWAP_XY);
+    double t0 = now();
+    for (int i = 0; i < reps; i++)
+      xformPixels(src, inPlace ? src : dst, w, h, t);
+    double kernel = (now() - t0) / reps;
+    t0 = now();
+    for (int i = 0; i < reps; i++)
+      reference(src, dst, w, h, t);
+    double naive = (now() - t0) / reps;
+    printf("  %-14s %7.1f us%s, per pixel %7.1f us\n", names[t], kernel * 1e6,
+           inPlace ? " in place" : "         ", naive * 1e6);
+  }
+#ifdef ROTATE_BENCH_LVGL
+  static const lv_display_rotation_t rotations[3] = {LV_DISPLAY_ROTATION_90, LV_DISPLAY_ROTATION_180,
+                                                     LV_DISPLAY_ROTATION_270};
+  for (int r = 0; r < 3; r++)
+  {
+    uint8_t t = xformRotation(rotations[r]);
+    bool swap = t & XFORM_SWAP_XY;
+    for (size_t i = 0; i < n; i++)
+      src[i] = (uint16_t)(i * 2654435761u >> 16);
+    lv_draw_sw_rotate(src, want, w, h, w * 2, (swap ? h : w) * 2, rotations[r],
+                      LV_COLOR_FORMAT_RGB565);
+    xformPixels(src, dst, w, h, t);
+    if (memcmp(want, dst, n * 2) != 0)
+    {
+      printf("FAIL %dx%d rotation %d differs from lv_draw_sw_rotate\n", (int)w, (int)h, 90 * (r + 1));
+      failed++;
+    }
+    double t0 = now();
+    for (int i = 0; i < reps; i++)
+      lv_draw_sw_rotate(src, dst, w, h, w * 2, (swap ? h : w) * 2, rotations[r],
+                        LV_COLOR_FORMAT_RGB565);
+    double lvgl = (now() - t0) / reps;
+    t0 = now();
+    for (int i = 0; i < reps; i++)
+      xformPixels(src, dst, w, h, t);
+    double kernel = (now() - t0) / reps;
+    printf("  lv_draw_sw_rotate %3d: %7.1f us, kernel %7.1f us, %.1fx\n", 90 * (r + 1), lvgl * 1e6,
+           kernel * 1e6, lvgl / kernel);
+  }
+  free(want);
+#endif
+  free(src);
+  free(dst);
+}
+
+int main()
+{
+  static const int32_t sizes[][2] = {{2, 2}, {3, 5}, {16, 16}, {18, 34}, {33, 17}, {466, 20}, {240, 40}};
+  for (const auto &s : sizes)
+  {
+    for (uint8_t t = 0; t < 8; t++)
+    {
+      failed += !check(s[0], s[1], t, false);
+      if (!(t & XFORM_SWAP_XY))
+        failed += !check(s[0], s[1], t, true);
+    }
+  }
+  printf("%s\n", failed ? "transforms differ from the reference" : "all transforms match");
+
+#ifdef ROTATE_BENCH_LVGL
+  lv_init();
+#endif
+  bench(466, 466, 50);
+  bench(466, 20, 1000);
+  bench(240, 40, 1000);
+  return failed != 0;
+}
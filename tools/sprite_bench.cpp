@@ -0,0 +1,199 @@
+/*
+ * Host benchmark of the speed digit sprites (lib/hud_ui/widgets/digit_sprite)
+ *
+ * Reads the glyphs of the 150 px font straight from its LVGL font source and
+ * draws the speed digits two ways onto a black RGB565 layer:
+ *
+ *   label    as LVGL's software renderer draws a label: the 4 bpp glyph is
+ *            unpacked to an A8 mask on every draw and blended pixel by pixel
+ *   sprite   as digit_sprite draws them: an RGB565 image built once per digit,
+ *            copied row by row
+ *
+ * and prints the time per digit and per 3 digit speed change, what building
+ * the sprites costs once and the memory they take. Both paths follow LVGL's
+ * code but are not LVGL itself, so they compare the work done per pixel,
+ * not the absolute times on the S3.
+ *
+ *   g++ -O2 -std=gnu++17 -Iinclude tools/sprite_bench.cpp -o sprite_bench
+ *   ./sprite_bench [lib/hud_ui/fonts/roboto_bold_150_data.c]
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <vector>
+#include "glyph_blit.hpp"
+
+static const uint16_t COLOR = 0xFFFF;
+static const int32_t LAYER_W = 466; // the speed is drawn into a strip this wide
+
+struct Glyph
+{
+  uint32_t index; // into the bitmap
+  int32_t w, h;
+};
+
+static double now()
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/* The glyph_bitmap bytes and glyph_dsc entries of an lv_font_conv output */
+static bool readFont(const char *path, std::vector<uint8_t> &bitmap, std::vector<Glyph> &glyphs)
+{
+  FILE *f = fopen(path, "r");
+  if (!f)
+  {
+    perror(path);
+    return false;
+  }
+  char line[512];
+  int section = 0; // 1 in glyph_bitmap, 2 in glyph_dsc
+  while (fgets(line, sizeof(line), f))
+  {
+    if (strstr(line, "glyph_bitmap[] = {"))
+      section = 1;
+    else if (strstr(line, "glyph_dsc[] = {"))
+      section = 2;
+    else if (section && strncmp(line, "};", 2) == 0)
+      section = 0;
+    else if (section == 1)
+    {
+      for (const char *p = strstr(line, "0x"); p; p = strstr(p + 2, "0x"))
+        bitmap.push_back((uint8_t)strtoul(p, nullptr, 16));
+    }
+    else if (section == 2)
+    {
+      Glyph g;
+      int adv;
+      if (sscanf(line, " {.bitmap_index = %u, .adv_w = %d, .box_w = %d, .box_h = %d", &g.index, &adv,
+                 &g.w, &g.h) == 4)
+        glyphs.push_back(g);
+    }
+  }
+  fclose(f);
+  return !bitmap.empty() && glyphs.size() >= 12;
+}
+
+/* lv_font_get_bitmap_fmt_txt for 4 bpp: rows are packed without padding */
+static void unpack4(const uint8_t *src, const Glyph &g, uint8_t *a8)
+{
+  static const uint8_t opa4[16] = {0,  17, 34,  51,  68,  85,  102, 119,
+                                   136, 153, 170, 187, 204, 221, 238, 255};
+  uint32_t bit = 0;
+  for (int32_t i = 0; i < g.w * g.h; i++, bit += 4)
+  {
+    uint8_t b = src[bit >> 3];
+    a8[i] = opa4[(bit & 4) ? b & 0x0F : b >> 4];
+  }
+}
+
+/* lv_draw_sw_blend of a color through an A8 mask into RGB565 */
+static void blendMask(uint16_t *dst, const uint8_t *mask, const Glyph &g)
+{
+  for (int32_t y = 0; y < g.h; y++, dst += LAYER_W, mask += g.w)
+  {
+    for (int32_t x = 0; x < g.w; x++)
+    {
+      uint8_t m = mask[x];
+      if (m >= 255)
+        dst[x] = COLOR;
+      else if (m > 0)
+        dst[x] = glyphMix(COLOR, dst[x], m);
+    }
+  }
+}
+
+/* lv_draw_sw_blend of an RGB565 image at full opacity */
+static void copyImage(uint16_t *dst, const uint16_t *src, const Glyph &g)
+{
+  for (int32_t y = 0; y < g.h; y++, dst += LAYER_W, src += g.w)
+    memcpy(dst, src, g.w * 2);
+}
+
+int main(int argc, char **argv)
+{
+  const char *path = argc > 1 ? argv[1] : "lib/hud_ui/fonts/roboto_bold_150_data.c";
+  std::vector<uint8_t> bitmap;
+  std::vector<Glyph> glyphs;
+  if (!readFont(path, bitmap, glyphs))
+  {
+    fprintf(stderr, "%s: no glyphs\n", path);
+    return 1;
+  }
+  const Glyph *digits = &glyphs[glyphs.size() - 10]; // '0'-'9' come last in the subset
+
+  int32_t maxW = 0, maxH = 0;
+  for (int d = 0; d < 10; d++)
+  {
+    maxW = digits[d].w > maxW ? digits[d].w : maxW;
+    maxH = digits[d].h > maxH ? digits[d].h : maxH;
+  }
+  std::vector<uint16_t> layer((size_t)LAYER_W * maxH);
+  std::vector<uint8_t> mask((size_t)maxW * maxH);
+
+  /* Build the sprites once, as digit_sprite does on first use */
+  std::vector<uint16_t> sprites[10];
+  size_t spriteBytes = 0;
+  double t0 = now();
+  for (int d = 0; d < 10; d++)
+  {
+    const Glyph &g = digits[d];
+    unpack4(&bitmap[g.index], g, mask.data());
+    sprites[d].resize((size_t)g.w * g.h);
+    for (int32_t i = 0; i < g.w * g.h; i++)
+      sprites[d][i] = glyphMix(COLOR, 0, mask[i]);
+    spriteBytes += sprites[d].size() * 2;
+  }
+  double build = now() - t0;
+
+  const int reps = 2000;
+  volatile uint16_t sink = 0;
+
+  t0 = now();
+  for (int r = 0; r < reps; r++)
+  {
+    for (int d = 0; d < 10; d++)
+    {
+      memset(layer.data(), 0, layer.size() * 2);
+      unpack4(&bitmap[digits[d].index], digits[d], mask.data());
+      blendMask(layer.data(), mask.data(), digits[d]);
+      sink = sink + layer[LAYER_W * 50 + 30];
+    }
+  }
+  double label = (now() - t0) / (reps * 10.0);
+
+  t0 = now();
+  for (int r = 0; r < reps; r++)
+  {
+    for (int d = 0; d < 10; d++)
+    {
+      memset(layer.data(), 0, layer.size() * 2);
+      copyImage(layer.data(), sprites[d].data(), digits[d]);
+      sink = sink + layer[LAYER_W * 50 + 30];
+    }
+  }
+  double sprite = (now() - t0) / (reps * 10.0);
+
+  /* The clear of the layer is in both, take it out */
+  t0 = now();
+  for (int r = 0; r < reps * 10; r++)
+  {
+    memset(layer.data(), 0, layer.size() * 2);
+    sink = sink + layer[r % layer.size()];
+  }
+  double clear = (now() - t0) / (reps * 10.0);
+  label -= clear;
+  sprite -= clear;
+
+  printf("%s: %d digits up to %dx%d px\n", path, 10, maxW, maxH);
+  printf("  label   %6.1f us per digit, %6.1f us per speed change\n", label * 1e6, label * 3e6);
+  printf("  sprite  %6.1f us per digit, %6.1f us per speed change (%.1fx)\n", sprite * 1e6,
+         sprite * 3e6, label / sprite);
+  printf("  sprites %u KB, built once in %.0f us\n", (unsigned)(spriteBytes / 1024), build * 1e6);
+  return 0;
+}